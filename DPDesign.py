@@ -292,54 +292,15 @@ def printPrintingLabels(hg):
     print "}"
     
 
-def GenCPP(hg, backwardsSwitch):
-    trans = {
-        "v1" : "i",
-        "v2" : "j",
-        "v1a" : "a1",
-        "v1b" : "b1",
-        "v1p" : "p1",
-        "v1s" : "s1",
-        "v2a" : "a2",
-        "v2b" : "b2",
-        "v2p" : "p2",
-        "v2s" : "s2",
-             }
-    outType = "RESULT_TYPE"
-    if (backwardsSwitch):
-        outType = "RESULT_TYPE***"
+def GenOutsideWeights(hg, nbop, trans):
     print """
-
-RESULT_TYPE** allocateMatrix(RecTree * t1, RecTree * t2)
+// Backward (outside) pass, followed by the weights of each case in each cell (W),
+// computed from filled C0/C1 tables (indexed by the positions of nodes in Dfo1/Dfo2)
+RESULT_TYPE*** computeOutsideWeights(RecTree * t1, RecTree * t2, vector<RecTree*> & Dfo1, vector<RecTree*> & Dfo2, RESULT_TYPE** C0, RESULT_TYPE** C1, map<string, map<string,string> > & adjacencies)
 {
-	RESULT_TYPE** R = new RESULT_TYPE*[t1->size()];
-	for(int i=0;i<t1->size();i++) 
-	{ R[i] = new RESULT_TYPE[t2->size()]; }
-	return R;
-}
-
-void deleteMatrix(RESULT_TYPE** R, RecTree * t1, RecTree * t2)
-{
-	for(int i=0;i<t1->size();i++) 
-	{
-		delete[] R[i];
-	}
-	delete[] R;
-}
-
-%s computeMatrix(RecTree * t1, RecTree * t2, bool adjacent, map<string, map<string,string> > & adjacencies){
-    RESULT_TYPE** C0 = allocateMatrix(t1,t2);
-    RESULT_TYPE** C1 = allocateMatrix(t1,t2);"""%(outType)
-
-    if (backwardsSwitch):
-        print """
     RESULT_TYPE** B0 = allocateMatrix(t1,t2);
     RESULT_TYPE** B1 = allocateMatrix(t1,t2);"""
-
     print """
-    vector<RecTree*> Dfo1 = computeDepthFirstOrder(t1);
-    vector<RecTree*> Dfo2 = computeDepthFirstOrder(t2);
-
     vector<EventType> event1;
     vector<EventType> event2;
     for(int i=0;i<Dfo1.size();i++) 
@@ -349,65 +310,9 @@ void deleteMatrix(RESULT_TYPE** R, RecTree * t1, RecTree * t2)
     for(int j=0;j<Dfo2.size();j++) 
     {
         event2.push_back(Dfo2[j]->getEvent());
-    }
-
-    for(int i=0;i<Dfo1.size();i++) 
-    {
-        RecTree * v1 = Dfo1[i];
-        for(int j=0;j<Dfo2.size();j++) 
-        {
-            RESULT_TYPE tmp;
-	    RecTree * v2 = Dfo2[j];
-            if (!sameSpecies(v1,v2))
-            { C1[i][j] = INF; C0[i][j] = INF; }
-            else
-            {
-              EventType t1 = event1[i];
-              EventType t2 = event2[j];
-              int a1 = (v1->getLeft()?  v1->getLeft()->getIndex():-1);
-              int b1 = (v1->getRight()? v1->getRight()->getIndex():-1);
-              int a2 = (v2->getLeft()?  v2->getLeft()->getIndex():-1);
-              int b2 = (v2->getRight()? v2->getRight()->getIndex():-1);
-"""
-    nbop = 1
-    for case in hg.getVertices():
-        print "              tmp = INF;"
-        for e in hg.getOutList(case):
-            ((v1cond,v2cond),costs,args) = e.getType()
-            dest = e.getDestinations()
-            precond  = "("+" || ".join(["(t1==%s)"%(et) for et in v1cond ])+")"
-            precond += " && ("+" || ".join(["(t2==%s)"%(et) for et in v2cond ])+")"
-            if "v1a" in [n1 for n1,n2 in args]:
-                precond += " && (a1 != -1)"
-            if "v1b" in [n1 for n1,n2 in args]:
-                precond += " && (b1 != -1)"
-            if "v2a" in [n2 for n1,n2 in args]:
-                precond += " && (a2 != -1)"
-            if "v2b" in [n2 for n1,n2 in args]:
-                precond += " && (b2 != -1)"
-            rescaling_factor = "(((t1!=GDup)&&(t2!=GDup))?1:0)"
-            if (("GLos" in v1cond) or ("GLos" in v2cond)):
-                rescaling_factor = "(v1->numNonGDup() + v2->numNonGDup() - 1)"
-                
-            rhs = reduce(lambda a,b : 'PLUS(%s,%s)' % (a, b),
-                         ["C%s[%s][%s]" % (d, trans[x1], trans[x2]) for (d,(x1,x2)) in zip(dest, args)] + costs + ["RESCALING_FACTOR(%s)"%(rescaling_factor)]  )
-            print "              // Op#%s: c%s[v1,v2] = %s"%(nbop,case,(" + ".join(["c%s[%s,%s]"%(d, x1, x2) for (d,(x1,x2)) in zip(dest,args)]+costs)))
-            print "              if (%s)"%(precond)
-            print "              {"
-            print "                 //cout << \"     \" << \"%s; Old val:\"<< tmp << \"; Cand: \" << %s << endl;"%(precond,rhs)
-            print "                 tmp = MIN(tmp, %s, (\"%s|\"+v1->getSpecies()), %s, v1->getND(), v2->getND());"%(rhs, formatLabel(case,v1cond,v2cond, dest,args), (repr(case==1)).lower())
-            print "              }"
-            nbop += 1
-        print "              C%s[%s][%s] = tmp;\n"%(case,trans["v1"], trans["v2"])
-
-    print """
-            }
-	    //cerr << "Node: " << v1->getLabel() << " (" << v1->getSpecies() << ") " << v2->getLabel() << " (" << v2->getSpecies() << ")" << endl;
-        }
     }"""
 
-    if (backwardsSwitch):
-        print """
+    print """
     for(int i=Dfo1.size()-1; i>=0; i--) 
     {
         RecTree * v1 = Dfo1[i];
@@ -451,14 +356,14 @@ void deleteMatrix(RESULT_TYPE** R, RecTree * t1, RecTree * t2)
 		   s2 = (v2IsLeftChild?v2p->getRight()->getIndex():v2p->getLeft()->getIndex());
 	      }
 """
-        buildBackwardDP(hg,1)
-        buildBackwardDP(hg,0)
-        print """
+    buildBackwardDP(hg,1)
+    buildBackwardDP(hg,0)
+    print """
             }
 	}
     }"""
 
-        print """
+    print """
     RESULT_TYPE*** W = new RESULT_TYPE**[t1->size()];
     for(int i=0;i<t1->size();i++) 
     { 
@@ -496,60 +401,271 @@ void deleteMatrix(RESULT_TYPE** R, RecTree * t1, RecTree * t2)
               int b2 = (v2->getRight()? v2->getRight()->getIndex():-1);
 """%(nbop-1,nbop-1,nbop-1)
 
-        nbop = 1
-        for case in hg.getVertices():
-            for e in hg.getOutList(case):
-                ((v1cond,v2cond),costs,args) = e.getType()
-                dest = e.getDestinations()
-                precond  = "("+" || ".join(["(t1==%s)"%(et) for et in v1cond ])+")"
-                precond += " && ("+" || ".join(["(t2==%s)"%(et) for et in v2cond ])+")"
-                if "v1a" in [n1 for n1,n2 in args]:
-                    precond += " && (a1 != -1)"
-                if "v1b" in [n1 for n1,n2 in args]:
-                    precond += " && (b1 != -1)"
-                if "v2a" in [n2 for n1,n2 in args]:
-                    precond += " && (a2 != -1)"
-                if "v2b" in [n2 for n1,n2 in args]:
-                    precond += " && (b2 != -1)"
-                rescaling_factor = "(((t1!=GDup)&&(t2!=GDup))?1:0)"
-                if (("GLos" in v1cond) or ("GLos" in v2cond)):
-                   rescaling_factor = "(v1->numNonGDup() + v2->numNonGDup() - 1)"
-
-                rhsW = reduce(lambda a,b : 'PLUS(%s,%s)' % (a, b),
-                              ["C%s[%s][%s]" % (d, trans[x1], trans[x2]) for (d,(x1,x2)) in zip(dest, args)] 
-                              + costs 
-                              + ["RESCALING_FACTOR(%s)"%(rescaling_factor)]
-                              + ["B%s[%s][%s]" % (case, trans["v1"], trans["v2"])])
-
-                lbl = formatLabel(case,v1cond,v2cond, dest,args)
-
-                print "              if (%s)"%(precond)
-                print "              {"
-                print "                 W[%s][%s][%s]"%(trans["v1"], trans["v2"], lbl);
-                print "                     = %s;" % (rhsW)
-                print "              }"
-                nbop += 1
-        print """
+    nbop = 1
+    for case in hg.getVertices():
+        for e in hg.getOutList(case):
+            ((v1cond,v2cond),costs,args) = e.getType()
+            dest = e.getDestinations()
+            precond  = "("+" || ".join(["(t1==%s)"%(et) for et in v1cond ])+")"
+            precond += " && ("+" || ".join(["(t2==%s)"%(et) for et in v2cond ])+")"
+            if "v1a" in [n1 for n1,n2 in args]:
+                precond += " && (a1 != -1)"
+            if "v1b" in [n1 for n1,n2 in args]:
+                precond += " && (b1 != -1)"
+            if "v2a" in [n2 for n1,n2 in args]:
+                precond += " && (a2 != -1)"
+            if "v2b" in [n2 for n1,n2 in args]:
+                precond += " && (b2 != -1)"
+            rescaling_factor = "(((t1!=GDup)&&(t2!=GDup))?1:0)"
+            if (("GLos" in v1cond) or ("GLos" in v2cond)):
+               rescaling_factor = "(v1->numNonGDup() + v2->numNonGDup() - 1)"
+
+            rhsW = reduce(lambda a,b : 'PLUS(%s,%s)' % (a, b),
+                          ["C%s[%s][%s]" % (d, trans[x1], trans[x2]) for (d,(x1,x2)) in zip(dest, args)] 
+                          + costs 
+                          + ["RESCALING_FACTOR(%s)"%(rescaling_factor)]
+                          + ["B%s[%s][%s]" % (case, trans["v1"], trans["v2"])])
+
+            lbl = formatLabel(case,v1cond,v2cond, dest,args)
+
+            print "              if (%s)"%(precond)
+            print "              {"
+            print "                 W[%s][%s][%s]"%(trans["v1"], trans["v2"], lbl);
+            print "                     = %s;" % (rhsW)
+            print "              }"
+            nbop += 1
+    print """
             }
         }
     }"""
 
 
 
-        print"""
-    RESULT_TYPE*** finalResult = W;
-    // We don't want to do that: this matrix is the output!
-    /*for(int i=0;i<t1->size();i++) 
-    { 
-      for(int j=0;j<t2->size();j++) 
-      { 
-        delete W[i][j]; 
-      }
-      delete W[i]; 
-    }
-    delete W;*/ 
+    print"""
     deleteMatrix(B0,t1,t2);
-    deleteMatrix(B1,t1,t2);"""
+    deleteMatrix(B1,t1,t2);
+    return W;
+}
+"""
+
+def GenCPP(hg, backwardsSwitch):
+    trans = {
+        "v1" : "i",
+        "v2" : "j",
+        "v1a" : "a1",
+        "v1b" : "b1",
+        "v1p" : "p1",
+        "v1s" : "s1",
+        "v2a" : "a2",
+        "v2b" : "b2",
+        "v2p" : "p2",
+        "v2s" : "s2",
+             }
+    outType = "RESULT_TYPE"
+    if (backwardsSwitch):
+        outType = "RESULT_TYPE***"
+    print """
+
+RESULT_TYPE** allocateMatrix(RecTree * t1, RecTree * t2)
+{
+	RESULT_TYPE** R = new RESULT_TYPE*[t1->size()];
+	for(int i=0;i<t1->size();i++) 
+	{ R[i] = new RESULT_TYPE[t2->size()]; }
+	return R;
+}
+
+void deleteMatrix(RESULT_TYPE** R, RecTree * t1, RecTree * t2)
+{
+	for(int i=0;i<t1->size();i++) 
+	{
+		delete[] R[i];
+	}
+	delete[] R;
+}
+
+// Fills the (v1,v2) cell of C0/C1, assuming that the cells it depends on are filled
+static void fillMatrixCell(RecTree * v1, RecTree * v2, RESULT_TYPE** C0, RESULT_TYPE** C1, map<string, map<string,string> > & adjacencies)
+{
+    int i = v1->getIndex();
+    int j = v2->getIndex();
+    RESULT_TYPE tmp;
+    if (!sameSpecies(v1,v2))
+    { C1[i][j] = INF; C0[i][j] = INF; }
+    else
+    {
+      EventType t1 = v1->getEvent();
+      EventType t2 = v2->getEvent();
+      int a1 = (v1->getLeft()?  v1->getLeft()->getIndex():-1);
+      int b1 = (v1->getRight()? v1->getRight()->getIndex():-1);
+      int a2 = (v2->getLeft()?  v2->getLeft()->getIndex():-1);
+      int b2 = (v2->getRight()? v2->getRight()->getIndex():-1);
+"""
+    nbop = 1
+    dependencies = []
+    for case in hg.getVertices():
+        print "      tmp = INF;"
+        for e in hg.getOutList(case):
+            ((v1cond,v2cond),costs,args) = e.getType()
+            dest = e.getDestinations()
+            precond  = "("+" || ".join(["(t1==%s)"%(et) for et in v1cond ])+")"
+            precond += " && ("+" || ".join(["(t2==%s)"%(et) for et in v2cond ])+")"
+            if "v1a" in [n1 for n1,n2 in args]:
+                precond += " && (a1 != -1)"
+            if "v1b" in [n1 for n1,n2 in args]:
+                precond += " && (b1 != -1)"
+            if "v2a" in [n2 for n1,n2 in args]:
+                precond += " && (a2 != -1)"
+            if "v2b" in [n2 for n1,n2 in args]:
+                precond += " && (b2 != -1)"
+            rescaling_factor = "(((t1!=GDup)&&(t2!=GDup))?1:0)"
+            if (("GLos" in v1cond) or ("GLos" in v2cond)):
+                rescaling_factor = "(v1->numNonGDup() + v2->numNonGDup() - 1)"
+            deps = [(trans[x1], trans[x2]) for (x1,x2) in args]
+            if len(deps)>0:
+                dependencies.append((precond, deps))
+                
+            terms = ["C%s[%s][%s]" % (d, trans[x1], trans[x2]) for (d,(x1,x2)) in zip(dest, args)] + costs + ["RESCALING_FACTOR(%s)"%(rescaling_factor)]
+            rhs = reduce(lambda a,b : 'PLUS(%s,%s)' % (a, b), terms)
+            # Chains of 3+ terms may also be summed as a whole by the semiring, 
+            # through PLUSk macros (e.g. to choose the order of the sums)
+            rhsChain = None
+            if len(terms)>2:
+                rhsChain = "PLUS%s(%s)"%(len(terms), ",".join(terms))
+            print "      // Op#%s: c%s[v1,v2] = %s"%(nbop,case,(" + ".join(["c%s[%s,%s]"%(d, x1, x2) for (d,(x1,x2)) in zip(dest,args)]+costs)))
+            print "      if (%s)"%(precond)
+            print "      {"
+            print "         //cout << \"     \" << \"%s; Old val:\"<< tmp << \"; Cand: \" << %s << endl;"%(precond,rhs)
+            if rhsChain is not None:
+                print "#ifdef PLUS_CHAINS"
+                print "         tmp = MIN(tmp, %s, (\"%s|\"+v1->getSpecies()), %s, v1->getND(), v2->getND());"%(rhsChain, formatLabel(case,v1cond,v2cond, dest,args), (repr(case==1)).lower())
+                print "#else"
+            print "         tmp = MIN(tmp, %s, (\"%s|\"+v1->getSpecies()), %s, v1->getND(), v2->getND());"%(rhs, formatLabel(case,v1cond,v2cond, dest,args), (repr(case==1)).lower())
+            if rhsChain is not None:
+                print "#endif"
+            print "      }"
+            nbop += 1
+        print "      C%s[%s][%s] = tmp;\n"%(case,trans["v1"], trans["v2"])
+
+    print """#ifdef CELL_STORE
+      CELL_STORE(i,j,v1,v2,C0[i][j],C1[i][j]);
+#endif
+    }
+    //cerr << "Node: " << v1->getLabel() << " (" << v1->getSpecies() << ") " << v2->getLabel() << " (" << v2->getSpecies() << ")" << endl;
+}
+
+// Fills the row of v1 in C0/C1. If mask is not NULL, only fills the cells marked as CELL_COMPUTE.
+static void fillMatrixRow(RecTree * v1, vector<RecTree*> & Dfo2, RESULT_TYPE** C0, RESULT_TYPE** C1, map<string, map<string,string> > & adjacencies, const char * mask)
+{
+    for(int j=0;j<Dfo2.size();j++) 
+    {
+        if ((mask==NULL) || (mask[j]==CELL_COMPUTE))
+        { fillMatrixCell(v1, Dfo2[j], C0, C1, adjacencies); }
+    }
+}
+
+#ifdef computeRow
+// Fills the row of v1 in tables kept by the caller, whose (stable) indices may 
+// not follow a depth-first order, as long as the rows of the children of v1 are filled
+void computeRow(RecTree * v1, vector<RecTree*> & Dfo2, RESULT_TYPE** C0, RESULT_TYPE** C1, map<string, map<string,string> > & adjacencies, const char * mask)
+{
+    fillMatrixRow(v1, Dfo2, C0, C1, adjacencies, mask);
+}
+#endif
+
+// Marks (as CELL_COMPUTE) the cells that the (v1,v2) cell depends on 
+static void markCellDependencies(RecTree * v1, RecTree * v2, char ** mask)
+{
+    int i = v1->getIndex();
+    int j = v2->getIndex();
+    EventType t1 = v1->getEvent();
+    EventType t2 = v2->getEvent();
+    int a1 = (v1->getLeft()?  v1->getLeft()->getIndex():-1);
+    int b1 = (v1->getRight()? v1->getRight()->getIndex():-1);
+    int a2 = (v2->getLeft()?  v2->getLeft()->getIndex():-1);
+    int b2 = (v2->getRight()? v2->getRight()->getIndex():-1);"""
+    grouped = []
+    for (precond, deps) in dependencies:
+        for (p, d) in grouped:
+            if p == precond:
+                for x in deps:
+                    if x not in d:
+                        d.append(x)
+                break
+        else:
+            grouped.append((precond, list(deps)))
+    for (precond, deps) in grouped:
+        print "    if (%s)"%(precond)
+        print "    {"
+        for (x1, x2) in deps:
+            if (x1, x2) != ("i", "j"):
+                print "      mask[%s][%s] = CELL_COMPUTE;"%(x1, x2)
+        print "    }"
+    print """}
+
+#ifdef CELL_LOOKUP
+// Top-down pass from the root cell, which finds the cells that are actually needed
+// to compute the root: cells retrieved through CELL_LOOKUP are marked CELL_KNOWN, 
+// and their dependencies are not explored further.
+static char ** planMatrixCells(vector<RecTree*> & Dfo1, vector<RecTree*> & Dfo2, RESULT_TYPE** C0, RESULT_TYPE** C1)
+{
+    char ** mask = new char*[Dfo1.size()];
+    for(int i=0;i<Dfo1.size();i++) 
+    {
+        mask[i] = new char[Dfo2.size()];
+        for(int j=0;j<Dfo2.size();j++) 
+        { mask[i][j] = CELL_SKIP; }
+    }
+    mask[Dfo1.size()-1][Dfo2.size()-1] = CELL_COMPUTE;
+    for(int i=Dfo1.size()-1;i>=0;i--) 
+    {
+        RecTree * v1 = Dfo1[i];
+        for(int j=Dfo2.size()-1;j>=0;j--) 
+        {
+            RecTree * v2 = Dfo2[j];
+            if ((mask[i][j]==CELL_COMPUTE) && sameSpecies(v1,v2))
+            {
+                if (CELL_LOOKUP(i,j,v1,v2,C0[i][j],C1[i][j]))
+                { mask[i][j] = CELL_KNOWN; }
+                else
+                { markCellDependencies(v1,v2,mask); }
+            }
+        }
+    }
+    return mask;
+}
+#endif
+"""
+    if (backwardsSwitch):
+        GenOutsideWeights(hg, nbop, trans)
+    print """
+%s computeMatrix(RecTree * t1, RecTree * t2, bool adjacent, map<string, map<string,string> > & adjacencies){
+    RESULT_TYPE** C0 = allocateMatrix(t1,t2);
+    RESULT_TYPE** C1 = allocateMatrix(t1,t2);"""%(outType)
+
+    print """
+    vector<RecTree*> Dfo1 = computeDepthFirstOrder(t1);
+    vector<RecTree*> Dfo2 = computeDepthFirstOrder(t2);
+
+    char ** mask = NULL;
+#ifdef CELL_LOOKUP
+    if (CELL_LOOKUP_ACTIVE)
+    { mask = planMatrixCells(Dfo1, Dfo2, C0, C1); }
+#endif
+    for(int i=0;i<Dfo1.size();i++) 
+    {
+        fillMatrixRow(Dfo1[i], Dfo2, C0, C1, adjacencies, (mask? mask[i] : NULL));
+    }
+    if (mask)
+    {
+        for(int i=0;i<Dfo1.size();i++) 
+        { delete[] mask[i]; }
+        delete[] mask;
+    }"""
+
+    if (backwardsSwitch):
+        print """
+    RESULT_TYPE*** finalResult = computeOutsideWeights(t1, t2, Dfo1, Dfo2, C0, C1, adjacencies);
+    // We don't want to delete W: this matrix is the output!"""
 
     else:
         print """
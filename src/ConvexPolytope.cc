@@ -32,6 +32,8 @@
 #include <algorithm>
 #include <vector>
 #include <iterator>     // std::distance
+#include <array>
+#include <cmath>
 
 
 using namespace std;
@@ -222,6 +224,8 @@ struct pointsComp {
 Polytope::Polytope()
 {
   dimension = -1;
+  normalsKnown = false;
+  error = 0.;
 }
 
 
@@ -229,11 +233,15 @@ Polytope::Polytope(size_type dim)
 {
   dimension = dim;
   points.resize(0);
+  normalsKnown = false;
+  error = 0.;
 }
 
 Polytope::Polytope(const size_t dim, const G* point)
 {
   dimension = dim;
+  normalsKnown = false;
+  error = 0.;
   points.resize(1);
   points[0].resize(dimension);
   for (int i=0;i<dim;i++)
@@ -254,6 +262,9 @@ Polytope::Polytope(const Polytope & p)
       points[i][j] = p.points[i][j];
     } 
   } 
+  normalsKnown = p.normalsKnown;
+  normals = p.normals;
+  error = p.error;
 }
 
 
@@ -261,6 +272,8 @@ Polytope::Polytope(const Polytope & p)
 Polytope::Polytope(size_type dim,points_type p)
 {
   dimension = dim;
+  normalsKnown = false;
+  error = 0.;
   std::set<point_type,pointsComp> tmppoints;
     
   for (point_type const pt : p) {
@@ -320,7 +333,7 @@ bool lastDimHomogenous(const points_type & p)
   for (int i=0;i<p.size();i++) {
     if (firstval){
       val = p[i][p[i].size()-1];
-      firstval = true;
+      firstval = false;
     }
     else
     {
@@ -332,6 +345,8 @@ bool lastDimHomogenous(const points_type & p)
 }
 
 
+std::vector<std::vector<size_t> > getConvexHullHullFacets(points_type points, int dimension);
+
 Polytope Polytope::convexHull()
 {
   if (points.size()<= dimension )
@@ -340,7 +355,18 @@ Polytope Polytope::convexHull()
   }
   else
   {
-    std::vector<std::vector<size_t> > facets_ = convexHullFacets();
+    std::vector<std::vector<size_t> > facets_;
+    if ((dimension>2) && lastDimHomogenous(points))
+    {
+      // Flat polytope (e.g. no occurrence of the adjacency yet), on which 
+      // quickhull fails: hull of the projection, whose vertices are those 
+      // of the polytope
+      facets_ = getConvexHullHullFacets(dropLastDim(points),dimension-1);
+    }
+    else
+    {
+      facets_ = convexHullFacets();
+    }
     std::set<size_t> indices;
     for (size_type i = 0; i < facets_.size(); ++i) 
     {
@@ -350,7 +376,6 @@ Polytope Polytope::convexHull()
         indices.insert(vertex_);
       }
     }
-
     if (indices.size()==0)
     {
       return Polytope(dimension,points);
@@ -378,7 +403,7 @@ void printMatrix(std::valarray<std::valarray<G> > & a ){
 
 void forwardSubstitution(std::valarray<std::valarray<G> > & a) {
     int i, j, k, max;
-    float t;
+    G t;
     for (i = 0; i < a.size(); ++i) {
         max = i;
         // Find largest at coordinate i among system of equations.         
@@ -538,7 +563,7 @@ bool badDirectionality(const point_type & planep, const vector<G> & normalvec, c
 }
 
 
-G l2Norm(valarray<G> vector){
+G l2Norm(const valarray<G> & vector){
   G sum = 0.;
   for (size_t i=0;i<vector.size();i++)
   {
@@ -707,10 +732,128 @@ NormalVector Polytope::computeNormal(std::vector<size_t> vertices_)
 }
 
 
+typedef std::array<long long,3> int_vector;
+
+static long long gcdAbs(long long a, long long b)
+{
+  a = (a<0)? -a : a;
+  b = (b<0)? -b : b;
+  while (b!=0)
+  {
+    long long t = a%b;
+    a = b;
+    b = t;
+  }
+  return a;
+}
+
+// Computes the normals of all the facets (edges in 2D, triangles in 3D, or 
+// edges of the projection of a flat 3D polytope if planar) at once, in closed
+// form with exact integer arithmetic, oriented towards the centroid of the 
+// points. Returns false, leaving the normals untouched, if some coordinate is
+// not an integer or some facet goes through the centroid (degenerate hull).
+bool Polytope::closedFormNormals(const std::vector<std::vector<size_t> > & facets_, bool planar)
+{
+  const G maxCoord = 1e9;
+  std::vector<int_vector> ipoints(points.size());
+  // Centroid, scaled by the number of points to remain integer
+  int_vector centroid = {0,0,0};
+  long long nbPoints = points.size();
+  for (size_t i=0;i<points.size();i++)
+  {
+    ipoints[i].fill(0);
+    for (size_t j=0;j<dimension;j++)
+    {
+      G c = points[i][j];
+      if ((c!=std::floor(c)) || (std::abs(c)>maxCoord))
+      {
+        return false;
+      }
+      ipoints[i][j] = (long long) c;
+      centroid[j] += ipoints[i][j];
+    }
+  }
+  size_t first = normals.size();
+  normals.reserve(first+facets_.size());
+  for (size_t f=0;f<facets_.size();f++)
+  {
+    const std::vector<size_t> & vertices_ = facets_[f];
+    const int_vector & o = ipoints[vertices_.back()];
+    int_vector u, v, n;
+    for (size_t j=0;j<3;j++)
+    {
+      u[j] = ipoints[vertices_[0]][j]-o[j];
+      v[j] = (vertices_.size()>2)? ipoints[vertices_[1]][j]-o[j] : 0;
+    }
+    if ((dimension==2) || planar)
+    {
+      n[0] = -u[1];
+      n[1] = u[0];
+      n[2] = 0;
+    }
+    else
+    {
+      n[0] = u[1]*v[2]-u[2]*v[1];
+      n[1] = u[2]*v[0]-u[0]*v[2];
+      n[2] = u[0]*v[1]-u[1]*v[0];
+    }
+    long long g = gcdAbs(gcdAbs(n[0],n[1]),n[2]);
+    if (g==0)
+    {
+      continue;
+    }
+    // Oriented towards the centroid, which lies strictly inside the hull
+    __int128 dot = 0;
+    for (size_t j=0;j<3;j++)
+    {
+      dot += (__int128)(n[j]/g)*(centroid[j]-nbPoints*o[j]);
+    }
+    if (dot==0)
+    {
+      normals.erase(normals.begin()+first,normals.end());
+      return false;
+    }
+    normals.emplace_back(dimension);
+    NormalVector & normal = normals.back();
+    for (size_t j=0;j<dimension;j++)
+    {
+      normal.vec[j] = (G)((dot<0)? -n[j]/g : n[j]/g);
+    }
+    normal.normalize();
+    normal.sigs.resize(vertices_.size());
+    for (size_t i=0;i<vertices_.size();i++)
+    {
+      const point_type & p = points[vertices_[i]];
+      normal.support += p;
+      normal.sigs[i].resize(dimension);
+      normal.sigs[i] = p;
+    }
+    normal.support /= (G)dimension;
+  }
+  return true;
+}
+
 std::vector<NormalVector> Polytope::normalVectors()
 {
-  std::vector<NormalVector > normals;
+  if (normalsKnown)
+  {
+    return normals;
+  }
+  normalsKnown = true;
+  if ((dimension==3) && (points.size()>dimension) && lastDimHomogenous(points))
+  {
+    // Flat polytope: normals of the edges, within its plane
+    std::vector<std::vector<size_t> > edges_ = getConvexHullHullFacets(dropLastDim(points),dimension-1);
+    if (closedFormNormals(edges_,true))
+    {
+      return normals;
+    }
+  }
   std::vector<std::vector<size_t> > facets_ = convexHullFacets();
+  if (((dimension==2) || (dimension==3)) && closedFormNormals(facets_,false))
+  {
+    return normals;
+  }
   if (facets_.size()>0)
   {
     for (size_type i = 0; i < facets_.size(); ++i) 
@@ -765,15 +908,36 @@ std::vector<std::vector<size_t> > Polytope::convexHullFacets()
   if (points.size()> dimension )
   {    
     result = getConvexHullHullFacets(points,dimension);
-    /*if ((result.size()==0) && lastDimHomogenous(points) && dimension > 2)
-    {
-      result = getConvexHullHullFacets(dropLastDim(points),dimension-1); 
-    }*/
   }
   return result;
 }
 
 
+size_type Polytope::size() const
+{
+  return points.size();
+}
+
+size_type Polytope::getDimension() const
+{
+  return dimension;
+}
+
+const points_type & Polytope::getPoints() const
+{
+  return points;
+}
+
+G Polytope::getError() const
+{
+  return error;
+}
+
+void Polytope::setError(G e)
+{
+  error = e;
+}
+
 Polytope Polytope::unionSum(Polytope p2)
 {
   points_type pres(points.size()+p2.points.size());
@@ -68,7 +68,12 @@ class Polytope{
   private:
     size_type dimension;
     points_type points;                      // Actual list of points
+    // Normals, computed on demand and kept until points change
+    bool normalsKnown;
+    std::vector<NormalVector> normals;
+    G error;                                 // Hausdorff bound, if approximate
     NormalVector computeNormal(std::vector<size_t> vertices_);
+    bool closedFormNormals(const std::vector<std::vector<size_t> > & facets_, bool planar);
    
    public: 
     Polytope();
@@ -82,6 +87,12 @@ class Polytope{
     
     Polytope convexHull();
 
+    size_type size() const;
+    size_type getDimension() const;
+    const points_type & getPoints() const;
+    G getError() const;
+    void setError(G e);
+
     Polytope unionSum(Polytope p2);
 
     Polytope minkovskiSum(Polytope p2);
@@ -94,6 +105,6 @@ class Polytope{
 std::ostream & operator<<(std::ostream & o, const point_type & p);
 std::ostream & operator<<(std::ostream & o, const points_type & p);
 
-G l2Norm(std::valarray<G> vector);
+G l2Norm(const std::valarray<G> & vector);
 
 #endif
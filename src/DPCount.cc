@@ -42,14 +42,32 @@
 #define allocateMatricesTASK allocateMatricesCount
 #define fillMatricesTASK fillMatricesCount
 #define deleteMatricesTASK deleteMatricesCount
+#define allocateBandedMatricesTASK allocateBandedMatricesCount
+#define fillBandedMatricesTASK fillBandedMatricesCount
+#define deleteBandedMatricesTASK deleteBandedMatricesCount
 
+#define TRANSFER_COST(c) 1.
+#define incomparableTASK incomparableCount
+#define fillTransferMatricesTASK fillTransferMatricesCount
 
 #include "DPRaw.cc"
+#include "DPTransferRaw.cc"
 
 double countReconciliations(Tree * GeneTree, Tree * SpeciesTree)
 {
-	TYPEDATA** R = allocateMatricesTASK(GeneTree, SpeciesTree);
-  fillMatricesTASK(GeneTree, SpeciesTree, R);
-	deleteMatricesTASK(GeneTree, SpeciesTree, R);
-	return R[GeneTree->getIndex()][SpeciesTree->getIndex()];
+	SpeciesTreeIndex species(SpeciesTree);
+	GeneSpeciesBands bands(GeneTree, species);
+	TYPEDATA** R = allocateBandedMatricesTASK(bands);
+	fillBandedMatricesTASK(GeneTree, species, bands, R);
+	double res = BANDED_CELL(R,bands,species,GeneTree->getIndex(),species.size()-1);
+	deleteBandedMatricesTASK(bands, R);
+	return res;
+}
+
+double countDTLReconciliations(Tree * GeneTree, Tree * SpeciesTree)
+{
+	SpeciesTreeIndex species(SpeciesTree);
+	vector<TYPEDATA> F;
+	fillTransferMatricesTASK(GeneTree, species, 1., F);
+	return F[GeneTree->getIndex()*species.size()+species.size()-1];
 }
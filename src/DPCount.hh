@@ -34,5 +34,7 @@
 #define DPCOUNT_HH
 
 double countReconciliations(Tree * GeneTree, Tree * SpeciesTree);
+// Same, under the DTL model of DPTransferRaw.cc
+double countDTLReconciliations(Tree * GeneTree, Tree * SpeciesTree);
 
 #endif
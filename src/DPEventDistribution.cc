@@ -0,0 +1,136 @@
+/*  DeClone: A software for computing and analyzing ancestral adjacency scenarios.
+ *  Copyright (C) 2015 Cedric Chauve, Yann Ponty, Ashok Rajaraman, Joao P.P. Zanetti
+ *
+ *  This file is part of DeClone.
+ *  
+ *  DeClone is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  DeClone is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with DeClone.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Contact: <yann.ponty@lix.polytechnique.fr>.
+ *
+ *
+ *  DeClone uses the Quickhull algorithm implementation programmed by 
+ *  Anatoly V. Tomilov. The code is available on <https://bitbucket.org/tomilov/quickhull/src/585267abb3a63794c04fc8325aa9ec9f726112ed/include/quickhull.hpp?at=master>.
+ *
+ *  Contact: <tomilovanatoliy@gmail.com>
+ */
+
+// Dyn. Prog.
+
+#include <iostream>
+#include "DPEventDistribution.hh"
+#include "math.h"
+
+// Polynomials in x (coefficients by degree), x marking the counted events: 
+// the coefficient of x^k in the partition function is the total Boltzmann 
+// weight of the reconciliations having k such events.
+typedef vector<double> polynomial;
+
+polynomial polySum(const polynomial & a, const polynomial & b)
+{
+	polynomial result(max(a.size(),b.size()),0.);
+	for (int i=0;i<a.size();i++)
+	{ result[i] += a[i]; }
+	for (int i=0;i<b.size();i++)
+	{ result[i] += b[i]; }
+	return result;
+}
+
+polynomial polyProduct(const polynomial & a, const polynomial & b)
+{
+	if (a.empty() || b.empty())
+	{ return polynomial(); }
+	polynomial result(a.size()+b.size()-1,0.);
+	for (int i=0;i<a.size();i++)
+	{
+		for (int j=0;j<b.size();j++)
+		{ result[i+j] += a[i]*b[j]; }
+	}
+	return result;
+}
+
+// Boltzmann weight of an event, marked by x if it is counted
+polynomial eventWeight(bool counted)
+{
+	polynomial result(counted? 2 : 1, 0.);
+	result[result.size()-1] = exp(-1./kT);
+	return result;
+}
+
+#define PLUS(a,b) polyProduct(a,b)
+#define MIN(a,b) polySum(a,b)
+#define ZERO polynomial(1,1.)
+
+#define TYPEDATA polynomial
+#define INFTY polynomial()
+
+// Two instances of the DP, marking duplications and losses respectively
+#define DUP_COST eventWeight(true)
+#define LOSS_COST eventWeight(false)
+
+#define allocateMatricesTASK allocateMatricesDupDistribution
+#define fillMatricesTASK fillMatricesDupDistribution
+#define deleteMatricesTASK deleteMatricesDupDistribution
+#define allocateBandedMatricesTASK allocateBandedMatricesDupDistribution
+#define fillBandedMatricesTASK fillBandedMatricesDupDistribution
+#define deleteBandedMatricesTASK deleteBandedMatricesDupDistribution
+
+#include "DPRaw.cc"
+
+#undef DUP_COST
+#undef LOSS_COST
+#undef allocateMatricesTASK
+#undef fillMatricesTASK
+#undef deleteMatricesTASK
+#undef allocateBandedMatricesTASK
+#undef fillBandedMatricesTASK
+#undef deleteBandedMatricesTASK
+
+#define DUP_COST eventWeight(false)
+#define LOSS_COST eventWeight(true)
+
+#define allocateMatricesTASK allocateMatricesLossDistribution
+#define fillMatricesTASK fillMatricesLossDistribution
+#define deleteMatricesTASK deleteMatricesLossDistribution
+#define allocateBandedMatricesTASK allocateBandedMatricesLossDistribution
+#define fillBandedMatricesTASK fillBandedMatricesLossDistribution
+#define deleteBandedMatricesTASK deleteBandedMatricesLossDistribution
+
+#include "DPRaw.cc"
+
+vector<double> getEventDistribution(Tree * GeneTree, Tree * SpeciesTree, bool countLosses)
+{
+	SpeciesTreeIndex species(SpeciesTree);
+	GeneSpeciesBands bands(GeneTree, species);
+	polynomial Z;
+	if (countLosses)
+	{
+		TYPEDATA** R = allocateBandedMatricesLossDistribution(bands);
+		fillBandedMatricesLossDistribution(GeneTree, species, bands, R);
+		Z = BANDED_CELL(R,bands,species,GeneTree->getIndex(),species.size()-1);
+		deleteBandedMatricesLossDistribution(bands, R);
+	}
+	else
+	{
+		TYPEDATA** R = allocateBandedMatricesDupDistribution(bands);
+		fillBandedMatricesDupDistribution(GeneTree, species, bands, R);
+		Z = BANDED_CELL(R,bands,species,GeneTree->getIndex(),species.size()-1);
+		deleteBandedMatricesDupDistribution(bands, R);
+	}
+	double total = 0.;
+	for (int k=0;k<Z.size();k++)
+	{ total += Z[k]; }
+	for (int k=0;k<Z.size();k++)
+	{ Z[k] /= total; }
+	return Z;
+}
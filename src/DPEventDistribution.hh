@@ -0,0 +1,42 @@
+/*  DeClone: A software for computing and analyzing ancestral adjacency scenarios.
+ *  Copyright (C) 2015 Cedric Chauve, Yann Ponty, Ashok Rajaraman, Joao P.P. Zanetti
+ *
+ *  This file is part of DeClone.
+ *  
+ *  DeClone is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  DeClone is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with DeClone.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Contact: <yann.ponty@lix.polytechnique.fr>.
+ *
+ *
+ *  DeClone uses the Quickhull algorithm implementation programmed by 
+ *  Anatoly V. Tomilov. The code is available on <https://bitbucket.org/tomilov/quickhull/src/585267abb3a63794c04fc8325aa9ec9f726112ed/include/quickhull.hpp?at=master>.
+ *
+ *  Contact: <tomilovanatoliy@gmail.com>
+ */
+
+#include <vector>
+#include <string>
+#include "Trees.hh"
+#include "float.h"
+#include "utils.hh"
+
+#ifndef DPEVENTDISTRIBUTION_HH
+#define DPEVENTDISTRIBUTION_HH
+
+// Distribution of the number of duplications (or losses if countLosses is set)
+// of reconciliations under the Boltzmann distribution: the k-th entry is the 
+// probability of k events.
+vector<double> getEventDistribution(Tree * GeneTree, Tree * SpeciesTree, bool countLosses);
+
+#endif
@@ -115,6 +115,9 @@ ostream & operator<<(ostream & o, vector<scenario_t> v)
 #define allocateMatricesTASK allocateMatricesGenAll
 #define fillMatricesTASK fillMatricesGenAll
 #define deleteMatricesTASK deleteMatricesGenAll
+#define allocateBandedMatricesTASK allocateBandedMatricesGenAll
+#define fillBandedMatricesTASK fillBandedMatricesGenAll
+#define deleteBandedMatricesTASK deleteBandedMatricesGenAll
 
 using namespace std;
 
@@ -31,6 +31,7 @@
 #include "DPInsideOutside.hh"
 #include "math.h"
 #include "SVGDriver.hh"
+#include "DPMarginals.hh"
 
 #define PLUS(a,b) (a*b)
 #define MIN(a,b) (a+b)
@@ -47,112 +48,64 @@
 #define allocateMatricesTASK allocateMatricesInsideOutside
 #define fillMatricesTASK fillMatricesInsideOutside
 #define deleteMatricesTASK deleteMatricesInsideOutside
+#define allocateBandedMatricesTASK allocateBandedMatricesInsideOutside
+#define fillBandedMatricesTASK fillBandedMatricesInsideOutside
+#define deleteBandedMatricesTASK deleteBandedMatricesInsideOutside
 
 #include "DPRaw.cc"
 
-TYPEDATA** computeOutside(Tree * GeneTree, Tree * SpeciesTree,TYPEDATA** FwR);
 
 
+double getPartitionFunction(Tree * GeneTree, const SpeciesTreeIndex & species)
+{
+	GeneSpeciesBands bands(GeneTree, species);
+	TYPEDATA** FwR = allocateBandedMatricesTASK(bands);
+	fillBandedMatricesTASK(GeneTree, species, bands, FwR);
+	double res = BANDED_CELL(FwR,bands,species,GeneTree->getIndex(),species.size()-1);
+	deleteBandedMatricesTASK(bands, FwR);
+	return res;
+}
 
 double getPartitionFunction(Tree * GeneTree, Tree * SpeciesTree)
 {
-	TYPEDATA** FwR = allocateMatricesTASK(GeneTree, SpeciesTree);
-	fillMatricesTASK(GeneTree, SpeciesTree, FwR);
-	double res = 	FwR[GeneTree->getIndex()][SpeciesTree->getIndex()];
-	deleteMatricesTASK(GeneTree, SpeciesTree, FwR);
-	return res;
+	return getPartitionFunction(GeneTree, SpeciesTreeIndex(SpeciesTree));
 }
 
-void getProbasDupl(Tree * GeneTree, Tree * SpeciesTree, double** probas)
+double getProbasDupl(Tree * GeneTree, Tree * SpeciesTree, const SpeciesTreeIndex & species, double** probas)
 {
-	TYPEDATA** FwR = allocateMatricesTASK(GeneTree, SpeciesTree);
-	fillMatricesTASK(GeneTree, SpeciesTree, FwR);
-  //cerr << "Forward:"<< FwR[GeneTree->getIndex()][SpeciesTree->getIndex()]<<endl;
-	TYPEDATA** BcR = computeOutside(GeneTree,SpeciesTree,FwR);
-	vector<Tree*> DfoG = computeDepthFirstOrder(GeneTree);
-	vector<Tree*> DfoS = computeDepthFirstOrder(SpeciesTree);
-	for(int i=0;i<DfoG.size();i++) 
+	ReconciliationMarginals marginals(GeneTree, species);
+	int n = GeneTree->size();
+	for(int i=0;i<n;i++) 
 	{
-		Tree * g = DfoG[i];
-		for(int j=0;j<DfoS.size();j++) 
-		{
-			Tree * s = DfoS[j];
-			int ag = (g->getLeft()?  g->getLeft()->getIndex():-1);
-			int bg = (g->getRight()? g->getRight()->getIndex():-1);
-			int as = (s->getLeft()?  s->getLeft()->getIndex():-1);
-			int bs = (s->getRight()? s->getRight()->getIndex():-1);
-			probas[i][j] = 0.;
-			if (ag!=-1 && bg!=-1 )
-			{ 
-				probas[i][j] = (DUP_COST*BcR[i][j]*FwR[ag][j]*FwR[bg][j]) / FwR[GeneTree->getIndex()][SpeciesTree->getIndex()]; 
-			}
-		}
-	}	
-	deleteMatricesTASK(GeneTree, SpeciesTree, FwR);
-	deleteMatricesTASK(GeneTree, SpeciesTree, BcR);
+		const double * dup = marginals.row(DUP_TYPE,i);
+		for(int j=0;j<species.size();j++) 
+		{ probas[i][j] = dup[j]; }
+	}
+	return marginals.Z;
 }
 
-TYPEDATA** computeOutside(Tree * GeneTree, Tree * SpeciesTree,TYPEDATA** FwR)
+void getProbasDupl(Tree * GeneTree, Tree * SpeciesTree, double** probas)
+{
+	getProbasDupl(GeneTree, SpeciesTree, SpeciesTreeIndex(SpeciesTree), probas);
+}
+
+double getExpectedEvents(Tree * GeneTree, Tree * SpeciesTree, vector<double> & dups, vector<double> & losses)
 {
-	TYPEDATA** R = allocateMatricesTASK(GeneTree, SpeciesTree);
-	vector<Tree*> DfoG = computeDepthFirstOrder(GeneTree);
-	vector<Tree*> DfoS = computeDepthFirstOrder(SpeciesTree);
-	for(int i=DfoG.size()-1;i>=0;i--) 
+	SpeciesTreeIndex species(SpeciesTree);
+	ReconciliationMarginals marginals(GeneTree, species);
+	dups.assign(species.size(),0.);
+	losses.assign(species.size(),0.);
+	int n = GeneTree->size();
+	for(int i=0;i<n;i++) 
 	{
-		Tree * g = DfoG[i];
-		for(int j=DfoS.size()-1;j>=0;j--) 
+		for(int j=0;j<species.size();j++) 
 		{
-			Tree * s = DfoS[j];
-			if (g->isRoot() && s->isRoot())
-			{				
-					R[i][j] = ZERO;
-			}
-			else
-			{
-				TYPEDATA tmp = INFTY;
-				bool sIsLeftChild = (s->getParent()?(s->getParent()->getLeft()==s):false);
-				bool gIsLeftChild = (g->getParent()?(g->getParent()->getLeft()==g):false);
-				int pg = (g->getParent()?  g->getParent()->getIndex():-1);
-				int ps = (s->getParent()?  s->getParent()->getIndex():-1);
-				int xg = (g->getParent()?
-				  (g==g->getParent()->getLeft()?
-					   g->getParent()->getRight()->getIndex()
-					  :g->getParent()->getLeft()->getIndex())
-					:-1);
-				int xs = (s->getParent()?
-				  (s==s->getParent()->getLeft()?
-					   s->getParent()->getRight()->getIndex()
-					  :s->getParent()->getLeft()->getIndex())
-					:-1);
-				if (pg!=-1)
-				{ tmp = MIN(tmp,PLUS(DUP_COST,PLUS(R[pg][j],FwR[xg][j]))); }
-//				if ((pg!=-1)&&(ps!=-1)&&(sIsLeftChild))
-//				{
-//					tmp = MIN(tmp,PLUS(R[pg][ps],FwR[xg][j])); 
-//				}
-				if ((pg!=-1)&&(ps!=-1)&&!(gIsLeftChild^sIsLeftChild))
-				{
-					tmp = MIN(tmp,PLUS(R[pg][ps],FwR[xg][xs])); 
-				}
-				if ((pg!=-1)&&(ps!=-1)&&(gIsLeftChild^sIsLeftChild))
-				{
-					tmp = MIN(tmp,PLUS(R[pg][ps],FwR[xg][xs])); 
-				}
-//				if ((pg!=-1)&&(ps!=-1)&&(!sIsLeftChild))
-//				{
-//					tmp = MIN(tmp,PLUS(R[pg][ps],FwR[xg][j])); 
-//				}
-				if ((ps!=-1)&&(!sIsLeftChild))
-				{	tmp = MIN(tmp,PLUS(LOSS_COST,R[i][ps])); }
-				if ((ps!=-1)&&(sIsLeftChild))
-				{	tmp = MIN(tmp,PLUS(LOSS_COST,R[i][ps])); }
-				
-				R[i][j] = tmp;
-			}
-		  //cout << "f("<<g->getLabel()<<","<<s->getLabel()<<") -> "<< R[i][j]<<endl;
+			dups[j] += marginals.get(DUP_TYPE,i,j);
+			if (species.left[j]!=-1)
+			{ losses[species.left[j]] += marginals.get(LOSS_A_TYPE,i,j); }
+			if (species.right[j]!=-1)
+			{ losses[species.right[j]] += marginals.get(LOSS_B_TYPE,i,j); }
 		}
 	}
-	return R;
-}		
-
-
+	return marginals.Z;
+}
@@ -35,6 +35,14 @@
 #define DPINSIDEOUTSIDE_HH
 
 double getPartitionFunction(Tree * GeneTree, Tree * SpeciesTree);
+double getPartitionFunction(Tree * GeneTree, const SpeciesTreeIndex & species);
 void getProbasDupl(Tree * GeneTree, Tree * SpeciesTree, double** probas);
+// Same, against the tables of a species tree shared by concurrent calls, 
+// returning the partition function
+double getProbasDupl(Tree * GeneTree, Tree * SpeciesTree, const SpeciesTreeIndex & species, double** probas);
+// Expected numbers of duplications in, and of losses along the branch above, 
+// each species node (by index) under the Boltzmann distribution. Returns the
+// partition function.
+double getExpectedEvents(Tree * GeneTree, Tree * SpeciesTree, vector<double> & dups, vector<double> & losses);
 
 #endif
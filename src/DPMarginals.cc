@@ -0,0 +1,314 @@
+/*  DeClone: A software for computing and analyzing ancestral adjacency scenarios.
+ *  Copyright (C) 2015 Cedric Chauve, Yann Ponty, Ashok Rajaraman, Joao P.P. Zanetti
+ *
+ *  This file is part of DeClone.
+ *  
+ *  DeClone is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  DeClone is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with DeClone.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Contact: <yann.ponty@lix.polytechnique.fr>.
+ *
+ *
+ *  DeClone uses the Quickhull algorithm implementation programmed by 
+ *  Anatoly V. Tomilov. The code is available on <https://bitbucket.org/tomilov/quickhull/src/585267abb3a63794c04fc8325aa9ec9f726112ed/include/quickhull.hpp?at=master>.
+ *
+ *  Contact: <tomilovanatoliy@gmail.com>
+ */
+
+// Dyn. Prog.
+
+#include "DPMarginals.hh"
+#include "math.h"
+
+#define PLUS(a,b) (a*b)
+#define MIN(a,b) (a+b)
+#define ZERO 1.
+#define TYPEDATA double
+#define INFTY 0.
+#define DUP_COST exp(-1./kT)
+#define LOSS_COST exp(-1./kT)
+#define TRANSFER_COST(c) exp(-(c)/kT)
+#define incomparableTASK incomparableMarginals
+#define fillTransferMatricesTASK fillTransferMatricesMarginals
+
+#include "DPTransferRaw.cc"
+
+// Each row is filled in two passes: the terms combining other rows are 
+// computed for all species at once (elementwise products over contiguous 
+// rows, then gathers through the children/parent arrays), and the losses, 
+// which chain cells of the same row, are added afterwards in (reverse) 
+// depth-first order of the species.
+
+ReconciliationMarginals::ReconciliationMarginals(Tree * GeneTree, const SpeciesTreeIndex & species)
+{
+	vector<Tree*> DfoG = computeDepthFirstOrder(GeneTree);
+	LeafSpeciesIndex leaves(GeneTree, species);
+	vector<int> leafSpecies(DfoG.size(),-1);
+	for(int i=0;i<DfoG.size();i++) 
+	{ leafSpecies[i] = leaves.getSpecies(i); }
+	nbSpecies = species.size();
+	computeInside(DfoG, species, leafSpecies);
+	Z = inside[(DfoG.size()-1)*nbSpecies+nbSpecies-1];
+	computeOutside(DfoG, species);
+	computeEvents(DfoG, species);
+}
+
+void ReconciliationMarginals::computeInside(const vector<Tree*> & DfoG, const SpeciesTreeIndex & species, const vector<int> & leaves)
+{
+	const int m = nbSpecies;
+	const double dupW = exp(-1./kT);
+	const double lossW = exp(-1./kT);
+	const int * L = &species.left[0];
+	const int * R = &species.right[0];
+	inside.assign(DfoG.size()*m,0.);
+	for(int i=0;i<DfoG.size();i++) 
+	{
+		Tree * g = DfoG[i];
+		double * Fi = &inside[i*m];
+		if (g->isLeaf())
+		{
+			if (leaves[i]!=-1)
+			{ Fi[leaves[i]] = 1.; }
+		}
+		else if (g->getLeft() && g->getRight())
+		{
+			const double * Fa = &inside[g->getLeft()->getIndex()*m];
+			const double * Fb = &inside[g->getRight()->getIndex()*m];
+			for(int j=0;j<m;j++) 
+			{ Fi[j] = dupW*Fa[j]*Fb[j]; }
+			for(int j=0;j<m;j++) 
+			{
+				if (L[j]!=-1 && R[j]!=-1)
+				{ Fi[j] += Fa[L[j]]*Fb[R[j]] + Fa[R[j]]*Fb[L[j]]; }
+			}
+		}
+		for(int j=0;j<m;j++) 
+		{
+			if (L[j]!=-1)
+			{ Fi[j] += lossW*Fi[L[j]]; }
+			if (R[j]!=-1)
+			{ Fi[j] += lossW*Fi[R[j]]; }
+		}
+	}
+}
+
+// Passes shared by ReconciliationMarginals and TransferMarginals
+
+// Sibling of each species node, -1 if none
+static vector<int> speciesSiblings(const SpeciesTreeIndex & species)
+{
+	const int m = species.size();
+	const int * L = &species.left[0];
+	const int * R = &species.right[0];
+	const int * P = &species.parent[0];
+	vector<int> sibling(m,-1);
+	for(int j=0;j<m;j++) 
+	{
+		if (P[j]!=-1)
+		{ sibling[j] = (L[P[j]]==j)? R[P[j]] : L[P[j]]; }
+	}
+	return sibling;
+}
+
+// Outside row Bi of a child of a binary gene node, through the duplications 
+// and speciations of its parent (outside row Bp), its sibling having the 
+// inside row Fx. Losses are added afterwards by chainOutsideLosses.
+static void outsideDLTerms(const SpeciesTreeIndex & species, const vector<int> & sibling, const double * Bp, const double * Fx, double * Bi)
+{
+	const int m = species.size();
+	const double dupW = exp(-1./kT);
+	const int * P = &species.parent[0];
+	for(int j=0;j<m;j++) 
+	{ Bi[j] = dupW*Bp[j]*Fx[j]; }
+	for(int j=0;j<m;j++) 
+	{
+		if (sibling[j]!=-1)
+		{ Bi[j] += Bp[P[j]]*Fx[sibling[j]]; }
+	}
+}
+
+static void chainOutsideLosses(const SpeciesTreeIndex & species, double * Bi)
+{
+	const double lossW = exp(-1./kT);
+	const int * P = &species.parent[0];
+	for(int j=species.size()-1;j>=0;j--) 
+	{
+		if (P[j]!=-1)
+		{ Bi[j] += lossW*Bi[P[j]]; }
+	}
+}
+
+// Probabilities of the duplication/loss events, given the inside and outside 
+// matrices and the partition function
+static void computeDLEvents(const vector<Tree*> & DfoG, const SpeciesTreeIndex & species, const vector<double> & inside, const vector<double> & outside, double Z, vector<double> * events)
+{
+	const int m = species.size();
+	const double dupW = exp(-1./kT);
+	const double lossW = exp(-1./kT);
+	const int * L = &species.left[0];
+	const int * R = &species.right[0];
+	for (int t=0;t<NONE_TYPE;t++)
+	{ events[t].assign(DfoG.size()*m,0.); }
+	if (Z==0.)
+	{ return; }
+	const double invZ = 1./Z;
+	for(int i=0;i<DfoG.size();i++) 
+	{
+		Tree * g = DfoG[i];
+		const double * Bi = &outside[i*m];
+		const double * Fi = &inside[i*m];
+		if (g->isLeaf())
+		{
+			double * match = &events[MATCH_TYPE][i*m];
+			for(int j=0;j<m;j++) 
+			{
+				if (L[j]==-1 && R[j]==-1)
+				{ match[j] = Bi[j]*Fi[j]*invZ; }
+			}
+		}
+		else if (g->getLeft() && g->getRight())
+		{
+			const double * Fa = &inside[g->getLeft()->getIndex()*m];
+			const double * Fb = &inside[g->getRight()->getIndex()*m];
+			double * dup = &events[DUP_TYPE][i*m];
+			for(int j=0;j<m;j++) 
+			{ dup[j] = dupW*invZ*Bi[j]*Fa[j]*Fb[j]; }
+			double * specAB = &events[SPEC_AB_TYPE][i*m];
+			double * specBA = &events[SPEC_BA_TYPE][i*m];
+			for(int j=0;j<m;j++) 
+			{
+				if (L[j]!=-1 && R[j]!=-1)
+				{
+					specAB[j] = invZ*Bi[j]*Fa[L[j]]*Fb[R[j]];
+					specBA[j] = invZ*Bi[j]*Fa[R[j]]*Fb[L[j]];
+				}
+			}
+		}
+		double * lossA = &events[LOSS_A_TYPE][i*m];
+		double * lossB = &events[LOSS_B_TYPE][i*m];
+		for(int j=0;j<m;j++) 
+		{
+			if (L[j]!=-1)
+			{ lossB[j] = lossW*invZ*Bi[j]*Fi[L[j]]; }
+			if (R[j]!=-1)
+			{ lossA[j] = lossW*invZ*Bi[j]*Fi[R[j]]; }
+		}
+	}
+}
+
+void ReconciliationMarginals::computeOutside(const vector<Tree*> & DfoG, const SpeciesTreeIndex & species)
+{
+	const int m = nbSpecies;
+	vector<int> sibling = speciesSiblings(species);
+	outside.assign(DfoG.size()*m,0.);
+	for(int i=DfoG.size()-1;i>=0;i--) 
+	{
+		Tree * g = DfoG[i];
+		double * Bi = &outside[i*m];
+		Tree * pg = g->getParent();
+		if (g->isRoot())
+		{ Bi[m-1] = 1.; }
+		else if (pg->getLeft() && pg->getRight())
+		{
+			const double * Bp = &outside[pg->getIndex()*m];
+			const double * Fx = &inside[((pg->getLeft()==g)? pg->getRight() : pg->getLeft())->getIndex()*m];
+			outsideDLTerms(species, sibling, Bp, Fx, Bi);
+		}
+		chainOutsideLosses(species, Bi);
+	}
+}
+
+void ReconciliationMarginals::computeEvents(const vector<Tree*> & DfoG, const SpeciesTreeIndex & species)
+{
+	computeDLEvents(DfoG, species, inside, outside, Z, events);
+}
+
+TransferMarginals::TransferMarginals(Tree * GeneTree, const SpeciesTreeIndex & species, double transferCost)
+{
+	vector<Tree*> DfoG = computeDepthFirstOrder(GeneTree);
+	nbSpecies = species.size();
+	transferW = TRANSFER_COST(transferCost);
+	fillTransferMatricesTASK(GeneTree, species, transferCost, inside);
+	Z = inside[(DfoG.size()-1)*nbSpecies+nbSpecies-1];
+	computeOutside(DfoG, species);
+	computeEvents(DfoG, species);
+}
+
+// A child received in j was sent by its parent from any species node k 
+// incomparable with j, where its sibling stayed: the receivers are summed 
+// with the same table as in the inside pass, incomparability being symmetric.
+void TransferMarginals::computeOutside(const vector<Tree*> & DfoG, const SpeciesTreeIndex & species)
+{
+	const int m = nbSpecies;
+	vector<int> sibling = speciesSiblings(species);
+	vector<double> sub(m), Ox(m), donors(m);
+	outside.assign(DfoG.size()*m,0.);
+	received.assign(DfoG.size()*m,0.);
+	for(int i=DfoG.size()-1;i>=0;i--) 
+	{
+		Tree * g = DfoG[i];
+		double * Bi = &outside[i*m];
+		Tree * pg = g->getParent();
+		if (g->isRoot())
+		{ Bi[m-1] = 1.; }
+		else if (pg->getLeft() && pg->getRight())
+		{
+			const double * Bp = &outside[pg->getIndex()*m];
+			const double * Fx = &inside[((pg->getLeft()==g)? pg->getRight() : pg->getLeft())->getIndex()*m];
+			double * Ri = &received[i*m];
+			outsideDLTerms(species, sibling, Bp, Fx, Bi);
+			incomparableTASK(species, Fx, &sub[0], &Ox[0]);
+			for(int j=0;j<m;j++) 
+			{ donors[j] = Bp[j]*Fx[j]; }
+			incomparableTASK(species, &donors[0], &sub[0], Ri);
+			for(int j=0;j<m;j++) 
+			{
+				Ri[j] *= transferW;
+				Bi[j] += transferW*Bp[j]*Ox[j] + Ri[j];
+			}
+		}
+		chainOutsideLosses(species, Bi);
+	}
+}
+
+void TransferMarginals::computeEvents(const vector<Tree*> & DfoG, const SpeciesTreeIndex & species)
+{
+	const int m = nbSpecies;
+	computeDLEvents(DfoG, species, inside, outside, Z, events);
+	transfers.assign(DfoG.size()*m,0.);
+	receptions.assign(DfoG.size()*m,0.);
+	if (Z==0.)
+	{ return; }
+	const double invZ = 1./Z;
+	vector<double> sub(m), Oa(m), Ob(m);
+	for(int i=0;i<DfoG.size();i++) 
+	{
+		Tree * g = DfoG[i];
+		const double * Bi = &outside[i*m];
+		const double * Fi = &inside[i*m];
+		const double * Ri = &received[i*m];
+		double * recv = &receptions[i*m];
+		for(int j=0;j<m;j++) 
+		{ recv[j] = invZ*Ri[j]*Fi[j]; }
+		if (!g->isLeaf() && g->getLeft() && g->getRight())
+		{
+			const double * Fa = &inside[g->getLeft()->getIndex()*m];
+			const double * Fb = &inside[g->getRight()->getIndex()*m];
+			incomparableTASK(species, Fa, &sub[0], &Oa[0]);
+			incomparableTASK(species, Fb, &sub[0], &Ob[0]);
+			double * trans = &transfers[i*m];
+			for(int j=0;j<m;j++) 
+			{ trans[j] = transferW*invZ*Bi[j]*(Fa[j]*Ob[j]+Fb[j]*Oa[j]); }
+		}
+	}
+}
@@ -0,0 +1,101 @@
+/*  DeClone: A software for computing and analyzing ancestral adjacency scenarios.
+ *  Copyright (C) 2015 Cedric Chauve, Yann Ponty, Ashok Rajaraman, Joao P.P. Zanetti
+ *
+ *  This file is part of DeClone.
+ *  
+ *  DeClone is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  DeClone is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with DeClone.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Contact: <yann.ponty@lix.polytechnique.fr>.
+ *
+ *
+ *  DeClone uses the Quickhull algorithm implementation programmed by 
+ *  Anatoly V. Tomilov. The code is available on <https://bitbucket.org/tomilov/quickhull/src/585267abb3a63794c04fc8325aa9ec9f726112ed/include/quickhull.hpp?at=master>.
+ *
+ *  Contact: <tomilovanatoliy@gmail.com>
+ */
+
+#include <vector>
+#include <string>
+#include "Trees.hh"
+#include "EditTrees.hh"
+#include "utils.hh"
+
+#ifndef DPMARGINALS_HH
+#define DPMARGINALS_HH
+
+// Inside-outside over the reconciliations of a gene tree with a species tree, 
+// under the Boltzmann distribution. Matrices are flat arrays, with one row of 
+// species nodes (by index) per gene node (by index), so that the loops over 
+// the species run on contiguous memory.
+// Gives the probability of each event (one array per NodeType, except 
+// NONE_TYPE) at each pair (gene node, species node): DUP_TYPE, SPEC_AB_TYPE, 
+// SPEC_BA_TYPE, LOSS_A_TYPE (speciation at the species node, gene lost along
+// its left child), LOSS_B_TYPE (lost along its right child) and MATCH_TYPE. 
+class ReconciliationMarginals{
+private:
+     int nbSpecies;
+     vector<double> inside;
+     vector<double> outside;
+     vector<double> events[NONE_TYPE];
+
+     void computeInside(const vector<Tree*> & DfoG, const SpeciesTreeIndex & species, const vector<int> & leaves);
+     void computeOutside(const vector<Tree*> & DfoG, const SpeciesTreeIndex & species);
+     void computeEvents(const vector<Tree*> & DfoG, const SpeciesTreeIndex & species);
+		
+public:
+     // Partition function
+     double Z;
+
+     ReconciliationMarginals(Tree * GeneTree, const SpeciesTreeIndex & species);
+     double get(NodeType t, int i, int j) const
+     { return events[t][i*nbSpecies+j]; }
+     const double * row(NodeType t, int i) const
+     { return &events[t][i*nbSpecies]; }
+};
+
+// Same, under the DTL model of DPTransferRaw.cc. In addition to the events of
+// ReconciliationMarginals, gives the probability that gene node i, in species
+// node j, keeps one child in j and transfers the other (transfer), and that
+// gene node i is received in species node j from a transfer of its parent
+// (reception).
+class TransferMarginals{
+private:
+     int nbSpecies;
+     double transferW;
+     vector<double> inside;
+     vector<double> outside;
+     vector<double> received;
+     vector<double> events[NONE_TYPE];
+     vector<double> transfers;
+     vector<double> receptions;
+
+     void computeOutside(const vector<Tree*> & DfoG, const SpeciesTreeIndex & species);
+     void computeEvents(const vector<Tree*> & DfoG, const SpeciesTreeIndex & species);
+		
+public:
+     // Partition function
+     double Z;
+
+     TransferMarginals(Tree * GeneTree, const SpeciesTreeIndex & species, double transferCost);
+     double get(NodeType t, int i, int j) const
+     { return events[t][i*nbSpecies+j]; }
+     const double * row(NodeType t, int i) const
+     { return &events[t][i*nbSpecies]; }
+     const double * transferRow(int i) const
+     { return &transfers[i*nbSpecies]; }
+     const double * receptionRow(int i) const
+     { return &receptions[i*nbSpecies]; }
+};
+
+#endif
@@ -41,106 +41,124 @@
 #define allocateMatricesTASK allocateMatricesMaxParsimony
 #define fillMatricesTASK fillMatricesMaxParsimony
 #define deleteMatricesTASK deleteMatricesMaxParsimony
+#define allocateBandedMatricesTASK allocateBandedMatricesMaxParsimony
+#define fillBandedMatricesTASK fillBandedMatricesMaxParsimony
+#define deleteBandedMatricesTASK deleteBandedMatricesMaxParsimony
+
+#define TRANSFER_COST(c) (c)
+#define incomparableTASK incomparableMaxParsimony
+#define fillTransferMatricesTASK fillTransferMatricesMaxParsimony
 
 #include "DPRaw.cc"
+#include "DPTransferRaw.cc"
 
-EditTree * backtrackMaxParsimony(Tree * g, Tree * s,TYPEDATA** R);
+bool backtrackMaxParsimony(Tree * GeneTree, const SpeciesTreeIndex & species, const GeneSpeciesBands & bands, TYPEDATA** R, ScenarioPool & pool);
 
 
 EditTree * computeMaxParsimony(Tree * GeneTree, Tree * SpeciesTree)
 {
-	TYPEDATA** R = allocateMatricesTASK(GeneTree, SpeciesTree);
-  fillMatricesTASK(GeneTree, SpeciesTree, R);
-  EditTree * t = NULL;
-  if (R[GeneTree->getIndex()][SpeciesTree->getIndex()] != INFTY)
-  {
-		t = backtrackMaxParsimony(GeneTree, SpeciesTree, R);
-	}
-		deleteMatricesTASK(GeneTree, SpeciesTree, R);
-		return t;
+	ScenarioPool pool;
+	if (!computeMaxParsimony(GeneTree, SpeciesTree, pool))
+	{ return NULL; }
+	return pool.asEditTree(0, GeneTree, SpeciesTree);
+}
+
+bool computeMaxParsimony(Tree * GeneTree, Tree * SpeciesTree, ScenarioPool & pool)
+{
+	SpeciesTreeIndex species(SpeciesTree);
+	GeneSpeciesBands bands(GeneTree, species);
+	TYPEDATA** R = allocateBandedMatricesTASK(bands);
+	fillBandedMatricesTASK(GeneTree, species, bands, R);
+	bool res = false;
+	if (BANDED_CELL(R,bands,species,GeneTree->getIndex(),species.size()-1) != INFTY)
+	{ res = backtrackMaxParsimony(GeneTree, species, bands, R, pool); }
+	deleteBandedMatricesTASK(bands, R);
+	return res;
+}
+
+double computeMaxParsimonyCost(Tree * GeneTree, Tree * SpeciesTree, const SpeciesTreeIndex & species)
+{
+	GeneSpeciesBands bands(GeneTree, species);
+	TYPEDATA** R = allocateBandedMatricesTASK(bands);
+	fillBandedMatricesTASK(GeneTree, species, bands, R);
+	double res = BANDED_CELL(R,bands,species,GeneTree->getIndex(),species.size()-1);
+	deleteBandedMatricesTASK(bands, R);
+	return res;
 }
 
+double computeDTLParsimonyCost(Tree * GeneTree, Tree * SpeciesTree, double transferCost)
+{
+	SpeciesTreeIndex species(SpeciesTree);
+	vector<TYPEDATA> F;
+	fillTransferMatricesTASK(GeneTree, species, transferCost, F);
+	double res = F[GeneTree->getIndex()*species.size()+species.size()-1];
+	return (res>=INFTY)? INFTY : res;
+}
 
-EditTree * backtrackMaxParsimony(Tree * g, Tree * s,TYPEDATA** R)
+// Explicit stack of the pairs (gene node, species node) left to backtrack, 
+// so that deep gene trees do not exhaust the call stack
+bool backtrackMaxParsimony(Tree * GeneTree, const SpeciesTreeIndex & species, const GeneSpeciesBands & bands, TYPEDATA** R, ScenarioPool & pool)
 {
-	int i = g->getIndex();
-	int j = s->getIndex();
-	TYPEDATA tmp = INFTY;
-	int ag = (g->getLeft()?  g->getLeft()->getIndex():-1);
-	int bg = (g->getRight()? g->getRight()->getIndex():-1);
-	int as = (s->getLeft()?  s->getLeft()->getIndex():-1);
-	int bs = (s->getRight()? s->getRight()->getIndex():-1);
-	Tree* agt = g->getLeft() ;
-	Tree* bgt = g->getRight();
-	Tree* ast = s->getLeft() ;
-	Tree* bst = s->getRight();
-	if (g->isLeaf() && s->isLeaf())
-	{				
-			if (extentCompatible(g, s))
+	vector<Tree*> DfoG = computeDepthFirstOrder(GeneTree);
+	vector<pair<int,int> > todo;
+	todo.push_back(pair<int,int>(GeneTree->getIndex(),species.size()-1));
+	pool.newScenario();
+	while (!todo.empty())
+	{
+		int i = todo.back().first;
+		int j = todo.back().second;
+		todo.pop_back();
+		Tree * g = DfoG[i];
+		int ag = (g->getLeft()?  g->getLeft()->getIndex():-1);
+		int bg = (g->getRight()? g->getRight()->getIndex():-1);
+		int as = species.left[j];
+		int bs = species.right[j];
+		TYPEDATA v = BANDED_CELL(R,bands,species,i,j);
+		// Children are pushed right first, to be popped in pre-order
+		if (g->isLeaf() && as==-1 && bs==-1)
+		{				
+			if (v == ZERO)
 			{ 
-				//cout << "Match("<<g->getLabel()<< "," << s->getLabel()<<")";
-				return new EditTree(formatLabel("Match",s),MATCH_TYPE);
+				pool.addEvent(i,j,MATCH_TYPE);
+				continue;
 			}
-	}
-	else
-	{
-		if ((ag!=-1) && (bg!=-1) && (R[i][j] == PLUS(DUP_COST,PLUS(R[ag][j],R[bg][j]))))
+		}
+		else if ((ag!=-1) && (bg!=-1) && (v == PLUS(DUP_COST,PLUS(BANDED_CELL(R,bands,species,ag,j),BANDED_CELL(R,bands,species,bg,j)))))
 		{ 
-			//cout << "Dup_" <<s->getLabel()<< "(";
-			EditTree * rec1 = backtrackMaxParsimony(agt, s, R);	
-			EditTree * rec2 = backtrackMaxParsimony(bgt, s, R);	
-			//cout << ")";
-			return new EditTree(formatLabel("Dup",s),rec1,rec2,DUP_TYPE);
+			pool.addEvent(i,j,DUP_TYPE);
+			todo.push_back(pair<int,int>(bg,j));
+			todo.push_back(pair<int,int>(ag,j));
+			continue;
 		}
-//		if ((ag!=-1) && (as!=-1) && (bg!=-1) && (R[i][j] == PLUS(R[ag][as],R[bg][as])))
-//		{ 
-//			//cout << "Map_(a_g->a_s,b_g->a_s)" <<s->getLabel()<< "(";
-//			EditTree * rec1 = backtrackMaxParsimony(agt, ast, R);	
-//			EditTree * rec2 = backtrackMaxParsimony(bgt, ast, R);	
-//			//cout << ")";
-//			return new EditTree(formatLabel("Spec_aa",s),rec1,rec2,SPEC_AA_TYPE);
-//		}
-		if ((ag!=-1) && (as!=-1) && (bg!=-1) && (bs!=-1) && (R[i][j] == PLUS(R[ag][as],R[bg][bs]))) 
+		else if ((ag!=-1) && (as!=-1) && (bg!=-1) && (bs!=-1) && (v == PLUS(BANDED_CELL(R,bands,species,ag,as),BANDED_CELL(R,bands,species,bg,bs)))) 
 		{ 
-			//cout << "Map_(a_g->a_s,b_g->b_s)" <<s->getLabel()<< "(";
-			EditTree * rec1 = backtrackMaxParsimony(agt, ast, R);	
-			EditTree * rec2 = backtrackMaxParsimony(bgt, bst, R);	
-			//cout << ")";
-			return new EditTree(formatLabel("Spec_ab",s),rec1,rec2,SPEC_AB_TYPE);
+			pool.addEvent(i,j,SPEC_AB_TYPE);
+			todo.push_back(pair<int,int>(bg,bs));
+			todo.push_back(pair<int,int>(ag,as));
+			continue;
 		}
-		if ((ag!=-1) && (as!=-1) && (bg!=-1) && (bs!=-1) && (R[i][j] == PLUS(R[ag][bs],R[bg][as])))
+		else if ((ag!=-1) && (as!=-1) && (bg!=-1) && (bs!=-1) && (v == PLUS(BANDED_CELL(R,bands,species,ag,bs),BANDED_CELL(R,bands,species,bg,as))))
 		{ 
-			//cout << "Map_(a_g->b_s,b_g->a_s)" <<s->getLabel()<< "(";
-			EditTree * rec1 = backtrackMaxParsimony(agt, bst, R);	
-			EditTree * rec2 = backtrackMaxParsimony(bgt, ast, R);	
-			//cout << ")";
-			return new EditTree(formatLabel("Spec_ba",s),rec1,rec2,SPEC_BA_TYPE);
+			pool.addEvent(i,j,SPEC_BA_TYPE);
+			todo.push_back(pair<int,int>(bg,as));
+			todo.push_back(pair<int,int>(ag,bs));
+			continue;
 		}
-//		if ((ag!=-1) && (bg!=-1) && (bs!=-1) && (R[i][j] == PLUS(R[ag][bs],R[bg][bs]))) 
-//		{ 
-//			//cout << "Map_(a_g->b_s,b_g->b_s)" <<s->getLabel()<< "(";
-//			EditTree * rec1 = backtrackMaxParsimony(agt, bst, R);	
-//			EditTree * rec2 = backtrackMaxParsimony(bgt, bst, R);	
-//			//cout << ")";
-//			return new EditTree(formatLabel("Spec_bb",s),rec1,rec2,SPEC_BB_TYPE);
-//		}
-		if ((as!=-1) && (R[i][j] == PLUS(LOSS_COST,R[i][as])))
+		else if ((as!=-1) && (v == PLUS(LOSS_COST,BANDED_CELL(R,bands,species,i,as))))
 		{ 
-			//cout << "Loss_b_s" <<s->getLabel()<< "(";
-			EditTree * rec = backtrackMaxParsimony(g, ast, R);	
-			//cout << ")";
-			return new EditTree(formatLabel("Loss_b",s),rec,NULL,LOSS_B_TYPE);
+			pool.addEvent(i,j,LOSS_B_TYPE);
+			todo.push_back(pair<int,int>(i,as));
+			continue;
 		}
-		if ((bs!=-1) && (R[i][j] == PLUS(LOSS_COST,R[i][bs])))
+		else if ((bs!=-1) && (v == PLUS(LOSS_COST,BANDED_CELL(R,bands,species,i,bs))))
 		{ 
-			//cout << "Loss_a_s" <<s->getLabel()<< "(";
-			EditTree * rec = backtrackMaxParsimony(g, bst, R);	
-			//cout << ")";
-			return new EditTree(formatLabel("Loss_a",s),NULL,rec,LOSS_A_TYPE);
+			pool.addEvent(i,j,LOSS_A_TYPE);
+			todo.push_back(pair<int,int>(i,bs));
+			continue;
 		}
+		cerr << "Error: Could not backtrack for subtrees "<<g << " and "<<species.dfo[j]<<endl;
+		pool.dropScenario();
+		return false;
 	}
-	cerr << "Error: Could not backtrack for subtrees "<<g << " and "<<s<<endl;
-	return NULL;
+	return true;
 }
-
-
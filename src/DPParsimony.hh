@@ -34,5 +34,13 @@
 #define DPPARSIMONY_HH
 
 EditTree* computeMaxParsimony(Tree * GeneTree, Tree * SpeciesTree);
+// Same, adding the reconciliation to a pool (false if none)
+bool computeMaxParsimony(Tree * GeneTree, Tree * SpeciesTree, ScenarioPool & pool);
+// Min. cost (DBL_MAX if none) against the tables of a species tree shared by
+// concurrent calls
+double computeMaxParsimonyCost(Tree * GeneTree, Tree * SpeciesTree, const SpeciesTreeIndex & species);
+// Min. cost (DBL_MAX if none) under the DTL model of DPTransferRaw.cc, with
+// transfers of cost transferCost
+double computeDTLParsimonyCost(Tree * GeneTree, Tree * SpeciesTree, double transferCost);
 
 #endif
@@ -42,20 +42,21 @@ void deleteMatricesTASK(Tree * GeneTree, Tree * SpeciesTree, TYPEDATA** R)
 	delete[] R;
 }
 
-void fillMatricesTASK(Tree * GeneTree, Tree * SpeciesTree, TYPEDATA** R)
+// Only reads the tables of the species tree, which may thus be shared by 
+// concurrent reconciliations
+void fillMatricesTASK(Tree * GeneTree, const SpeciesTreeIndex & species, TYPEDATA** R)
 {
 	vector<Tree*> DfoG = computeDepthFirstOrder(GeneTree);
-	vector<Tree*> DfoS = computeDepthFirstOrder(SpeciesTree);
+	LeafSpeciesIndex leaves(GeneTree, species);
 	for(int i=0;i<DfoG.size();i++) 
 	{
 		Tree * g = DfoG[i];
-		for(int j=0;j<DfoS.size();j++) 
+		for(int j=0;j<species.size();j++) 
 		{
-			Tree * s = DfoS[j];
 			// Deplacer le cas Feuille * Noeud Interne vers le cas gnral
-			if (g->isLeaf() && s->isLeaf())
+			if (g->isLeaf() && species.left[j]==-1 && species.right[j]==-1)
 			{				
-					if (extentCompatible(g, s))
+					if (leaves.compatible(i, j))
 					{ R[i][j] = ZERO;	}
 					else
 					{ R[i][j] = INFTY;	}
@@ -65,8 +66,8 @@ void fillMatricesTASK(Tree * GeneTree, Tree * SpeciesTree, TYPEDATA** R)
 				TYPEDATA tmp = INFTY;
 				int ag = (g->getLeft()?  g->getLeft()->getIndex():-1);
 				int bg = (g->getRight()? g->getRight()->getIndex():-1);
-				int as = (s->getLeft()?  s->getLeft()->getIndex():-1);
-				int bs = (s->getRight()? s->getRight()->getIndex():-1);
+				int as = species.left[j];
+				int bs = species.right[j];
 				// TODO: Deal with unary nodes in a better way
 				if (ag!=-1 && bg!=-1)
 				{ tmp = MIN(tmp,PLUS(DUP_COST,PLUS(R[ag][j],R[bg][j]))); }
@@ -88,3 +89,64 @@ void fillMatricesTASK(Tree * GeneTree, Tree * SpeciesTree, TYPEDATA** R)
 		}
 	}
 }
+
+void fillMatricesTASK(Tree * GeneTree, Tree * SpeciesTree, TYPEDATA** R)
+{
+	fillMatricesTASK(GeneTree, SpeciesTreeIndex(SpeciesTree), R);
+}
+
+// Same DP, restricted to the band of species nodes of each gene node (see 
+// GeneSpeciesBands), out of which cells are INFTY. Row i only stores the 
+// ancestors of the LCA of gene node i, by depth, i.e. |G|.depth(S) cells at most.
+#define BANDED_CELL(R,bands,species,i,j) ((bands).contains(i,j)? R[i][(species).depth[j]] : INFTY)
+
+TYPEDATA** allocateBandedMatricesTASK(const GeneSpeciesBands & bands)
+{
+	TYPEDATA** R = new TYPEDATA*[bands.size()];
+	for(int i=0;i<bands.size();i++) 
+	{ R[i] = new TYPEDATA[bands.width(i)]; }
+	return R;
+}
+
+void deleteBandedMatricesTASK(const GeneSpeciesBands & bands, TYPEDATA** R)
+{
+	for(int i=0;i<bands.size();i++) 
+	{
+		delete[] R[i];
+	}
+	delete[] R;
+}
+
+void fillBandedMatricesTASK(Tree * GeneTree, const SpeciesTreeIndex & species, const GeneSpeciesBands & bands, TYPEDATA** R)
+{
+	vector<Tree*> DfoG = computeDepthFirstOrder(GeneTree);
+	for(int i=0;i<DfoG.size();i++) 
+	{
+		Tree * g = DfoG[i];
+		// From the LCA up to the root, so that R[i][as] and R[i][bs] are known
+		for(int j=bands.getLCA(i);j!=-1;j=species.parent[j]) 
+		{
+			if (g->isLeaf() && species.left[j]==-1 && species.right[j]==-1)
+			{	R[i][species.depth[j]] = ZERO; }
+			else
+			{
+				TYPEDATA tmp = INFTY;
+				int ag = (g->getLeft()?  g->getLeft()->getIndex():-1);
+				int bg = (g->getRight()? g->getRight()->getIndex():-1);
+				int as = species.left[j];
+				int bs = species.right[j];
+				if (ag!=-1 && bg!=-1)
+				{ tmp = MIN(tmp,PLUS(DUP_COST,PLUS(BANDED_CELL(R,bands,species,ag,j),BANDED_CELL(R,bands,species,bg,j)))); }
+				if (ag!=-1 && bg!=-1 && as!=-1 && bs!=-1)
+				{ tmp = MIN(tmp,PLUS(BANDED_CELL(R,bands,species,ag,as),BANDED_CELL(R,bands,species,bg,bs))); }
+				if (ag!=-1 && bg!=-1 && as!=-1 && bs!=-1)
+				{	tmp = MIN(tmp,PLUS(BANDED_CELL(R,bands,species,ag,bs),BANDED_CELL(R,bands,species,bg,as))); }
+				if (as!=-1)
+				{	tmp = MIN(tmp,PLUS(LOSS_COST,BANDED_CELL(R,bands,species,i,as))); }
+				if (bs!=-1)
+				{	tmp = MIN(tmp,PLUS(LOSS_COST,BANDED_CELL(R,bands,species,i,bs))); }
+				R[i][species.depth[j]] = tmp;
+			}
+		}
+	}
+}
@@ -45,123 +45,126 @@
 #define allocateMatricesTASK allocateMatricesStochasticBacktrack
 #define fillMatricesTASK fillMatricesStochasticBacktrack
 #define deleteMatricesTASK deleteMatricesStochasticBacktrack
+#define allocateBandedMatricesTASK allocateBandedMatricesStochasticBacktrack
+#define fillBandedMatricesTASK fillBandedMatricesStochasticBacktrack
+#define deleteBandedMatricesTASK deleteBandedMatricesStochasticBacktrack
 
 
 #include "DPRaw.cc"
 
-EditTree * stochasticBacktrack(Tree * g, Tree * s,TYPEDATA** R);
+void stochasticBacktrack(const vector<Tree*> & DfoG, const SpeciesTreeIndex & species, const GeneSpeciesBands & bands, TYPEDATA** R, ScenarioPool & pool);
 
 vector<EditTree*> stochasticReconciliations(Tree * GeneTree, Tree * SpeciesTree, int numTrees)
 {
+	ScenarioPool pool;
+	stochasticReconciliations(GeneTree, SpeciesTree, numTrees, pool);
 	vector<EditTree*> result;
-	TYPEDATA** R = allocateMatricesTASK(GeneTree, SpeciesTree);
-  fillMatricesTASK(GeneTree, SpeciesTree, R);
-  //srand((unsigned int) time(0));
-  //srand();
-  for(int i=0;i<numTrees;i++)
-  {
-		EditTree * scenario = stochasticBacktrack(GeneTree, SpeciesTree,R);
-		result.push_back(scenario);
+	for(int k=0;k<pool.size();k++)
+	{
+		result.push_back(pool.asEditTree(k, GeneTree, SpeciesTree));
 	}
-	deleteMatricesTASK(GeneTree, SpeciesTree, R);
 	return result;
 }
 
-
-EditTree * stochasticBacktrack(Tree * g, Tree * s,TYPEDATA** R)
+void stochasticReconciliations(Tree * GeneTree, Tree * SpeciesTree, int numTrees, ScenarioPool & pool)
 {
-	int i = g->getIndex();
-	int j = s->getIndex();
-	int ag = (g->getLeft()?  g->getLeft()->getIndex():-1);
-	int bg = (g->getRight()? g->getRight()->getIndex():-1);
-	int as = (s->getLeft()?  s->getLeft()->getIndex():-1);
-	int bs = (s->getRight()? s->getRight()->getIndex():-1);
-	Tree* agt = g->getLeft() ;
-	Tree* bgt = g->getRight();
-	Tree* ast = s->getLeft() ;
-	Tree* bst = s->getRight();
-	double r = (R[i][j]*rand())/(RAND_MAX+1.0); 
-	if (g->isLeaf() && s->isLeaf())
-	{				
-			if (extentCompatible(g, s))
-			{ 
-				if (r<ZERO)
-				{ return new EditTree(formatLabel("Match",s),MATCH_TYPE); }
-			}
+	SpeciesTreeIndex species(SpeciesTree);
+	GeneSpeciesBands bands(GeneTree, species);
+	TYPEDATA** R = allocateBandedMatricesTASK(bands);
+	fillBandedMatricesTASK(GeneTree, species, bands, R);
+	vector<Tree*> DfoG = computeDepthFirstOrder(GeneTree);
+  //srand((unsigned int) time(0));
+  //srand();
+	for(int i=0;i<numTrees;i++)
+	{
+		stochasticBacktrack(DfoG, species, bands, R, pool);
 	}
-	else
+	deleteBandedMatricesTASK(bands, R);
+}
+
+// Explicit stack of the pairs (gene node, species node) left to backtrack, 
+// popped in pre-order (i.e. in the order of the draws of the recursive version)
+void stochasticBacktrack(const vector<Tree*> & DfoG, const SpeciesTreeIndex & species, const GeneSpeciesBands & bands, TYPEDATA** R, ScenarioPool & pool)
+{
+	vector<pair<int,int> > todo;
+	todo.push_back(pair<int,int>(DfoG.size()-1,species.size()-1));
+	pool.newScenario();
+	while (!todo.empty())
 	{
-		if ((ag!=-1) && (bg!=-1))
-		{ 
-			r -= PLUS(DUP_COST,PLUS(R[ag][j],R[bg][j]));
-			if (r<0)
+		int i = todo.back().first;
+		int j = todo.back().second;
+		todo.pop_back();
+		Tree * g = DfoG[i];
+		int ag = (g->getLeft()?  g->getLeft()->getIndex():-1);
+		int bg = (g->getRight()? g->getRight()->getIndex():-1);
+		int as = species.left[j];
+		int bs = species.right[j];
+		double r = (BANDED_CELL(R,bands,species,i,j)*rand())/(RAND_MAX+1.0); 
+		if (g->isLeaf() && as==-1 && bs==-1)
+		{				
+			if (bands.contains(i,j) && r<ZERO)
 			{ 
-				EditTree * rec1 = stochasticBacktrack(agt, s, R);	
-				EditTree * rec2 = stochasticBacktrack(bgt, s, R);	
-				return new EditTree(formatLabel("Dup",s),rec1,rec2,DUP_TYPE);
+				pool.addEvent(i,j,MATCH_TYPE);
+				continue;
 			}
 		}
-//		if ((ag!=-1) && (as!=-1) && (bg!=-1))
-//		{ 
-//			r -= PLUS(R[ag][as],R[bg][as]);
-//			if (r<0) 
-//			{ 
-//				EditTree * rec1 = stochasticBacktrack(agt, ast, R);	
-//				EditTree * rec2 = stochasticBacktrack(bgt, ast, R);	
-//				return new EditTree(formatLabel("Spec_aa",s),rec1,rec2,SPEC_AA_TYPE);
-//			}
-//		}
-		if ((ag!=-1) && (as!=-1) && (bg!=-1) && (bs!=-1)) 
-		{ 
-			r -= PLUS(R[ag][as],R[bg][bs]);
-			if (r<0) 
+		else
+		{
+			if ((ag!=-1) && (bg!=-1))
 			{ 
-				EditTree * rec1 = stochasticBacktrack(agt, ast, R);	
-				EditTree * rec2 = stochasticBacktrack(bgt, bst, R);	
-				return new EditTree(formatLabel("Spec_ab",s),rec1,rec2,SPEC_AB_TYPE);
+				r -= PLUS(DUP_COST,PLUS(BANDED_CELL(R,bands,species,ag,j),BANDED_CELL(R,bands,species,bg,j)));
+				if (r<0)
+				{ 
+					pool.addEvent(i,j,DUP_TYPE);
+					todo.push_back(pair<int,int>(bg,j));
+					todo.push_back(pair<int,int>(ag,j));
+					continue;
+				}
 			}
-		}
-		if ((ag!=-1) && (as!=-1) && (bg!=-1) && (bs!=-1))
-		{ 
-			r -= PLUS(R[ag][bs],R[bg][as]);
-			if (r<0) 
+			if ((ag!=-1) && (as!=-1) && (bg!=-1) && (bs!=-1)) 
 			{ 
-				EditTree * rec1 = stochasticBacktrack(agt, bst, R);	
-				EditTree * rec2 = stochasticBacktrack(bgt, ast, R);	
-				return new EditTree(formatLabel("Spec_ba",s),rec1,rec2,SPEC_BA_TYPE);
+				r -= PLUS(BANDED_CELL(R,bands,species,ag,as),BANDED_CELL(R,bands,species,bg,bs));
+				if (r<0) 
+				{ 
+					pool.addEvent(i,j,SPEC_AB_TYPE);
+					todo.push_back(pair<int,int>(bg,bs));
+					todo.push_back(pair<int,int>(ag,as));
+					continue;
+				}
 			}
-		}
-//		if ((ag!=-1) && (bg!=-1) && (bs!=-1)) 
-//		{ 
-//			r -= PLUS(R[ag][bs],R[bg][bs]);
-//			if (r<0) 
-//			{ 
-//				EditTree * rec1 = stochasticBacktrack(agt, bst, R);	
-//				EditTree * rec2 = stochasticBacktrack(bgt, bst, R);	
-//				return new EditTree(formatLabel("Spec_bb",s),rec1,rec2,SPEC_BB_TYPE);
-//			}
-//		}
-		if ((as!=-1))
-		{ 
-			r -= PLUS(LOSS_COST,R[i][as]);
-			if (r<0) 
+			if ((ag!=-1) && (as!=-1) && (bg!=-1) && (bs!=-1))
 			{ 
-				EditTree * rec = stochasticBacktrack(g, ast, R);	
-				return new EditTree(formatLabel("Loss_b",s),rec,NULL,LOSS_B_TYPE);
+				r -= PLUS(BANDED_CELL(R,bands,species,ag,bs),BANDED_CELL(R,bands,species,bg,as));
+				if (r<0) 
+				{ 
+					pool.addEvent(i,j,SPEC_BA_TYPE);
+					todo.push_back(pair<int,int>(bg,as));
+					todo.push_back(pair<int,int>(ag,bs));
+					continue;
+				}
 			}
-		}
-		if ((bs!=-1))
-		{
-			r -= PLUS(LOSS_COST,R[i][bs]);
-			if (r<0) 
+			if ((as!=-1))
 			{ 
-				EditTree * rec = stochasticBacktrack(g, bst, R);	
-				return new EditTree(formatLabel("Loss_a",s),NULL,rec,LOSS_A_TYPE);
+				r -= PLUS(LOSS_COST,BANDED_CELL(R,bands,species,i,as));
+				if (r<0) 
+				{ 
+					pool.addEvent(i,j,LOSS_B_TYPE);
+					todo.push_back(pair<int,int>(i,as));
+					continue;
+				}
+			}
+			if ((bs!=-1))
+			{
+				r -= PLUS(LOSS_COST,BANDED_CELL(R,bands,species,i,bs));
+				if (r<0) 
+				{ 
+					pool.addEvent(i,j,LOSS_A_TYPE);
+					todo.push_back(pair<int,int>(i,bs));
+					continue;
+				}
 			}
 		}
+		cout << "Error: Could not backtrack for subtrees "<<g << " and "<<species.dfo[j]<<endl;
+		exit(2);
 	}
-	cout << "Error: Could not backtrack for subtrees "<<g << " and "<<s<<endl;
-	exit(2);
 }
-
-
@@ -36,5 +36,7 @@
 #define DPSTOCHASTICBACKTRACK_HH
 
 vector<EditTree*> stochasticReconciliations(Tree * GeneTree, Tree * SpeciesTree, int numTrees);
+// Same, adding the reconciliations to a pool
+void stochasticReconciliations(Tree * GeneTree, Tree * SpeciesTree, int numTrees, ScenarioPool & pool);
 
 #endif
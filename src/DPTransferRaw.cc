@@ -0,0 +1,117 @@
+/*  DeClone: A software for computing and analyzing ancestral adjacency scenarios.
+ *  Copyright (C) 2015 Cedric Chauve, Yann Ponty, Ashok Rajaraman, Joao P.P. Zanetti
+ *
+ *  This file is part of DeClone.
+ *  
+ *  DeClone is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  DeClone is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with DeClone.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Contact: <yann.ponty@lix.polytechnique.fr>.
+ *
+ *
+ *  DeClone uses the Quickhull algorithm implementation programmed by 
+ *  Anatoly V. Tomilov. The code is available on <https://bitbucket.org/tomilov/quickhull/src/585267abb3a63794c04fc8325aa9ec9f726112ed/include/quickhull.hpp?at=master>.
+ *
+ *  Contact: <tomilovanatoliy@gmail.com>
+ */
+
+// Duplication-Transfer-Loss (DTL) variant of the DP of DPRaw.cc, over the same
+// semirings (PLUS/MIN/ZERO/INFTY, DUP_COST, LOSS_COST) plus TRANSFER_COST(c),
+// the weight of a transfer of cost c. Undated model: a gene node in species
+// node j may, instead of duplicating or speciating, keep one child in j and
+// send the other to any species node incomparable with j (neither an ancestor
+// nor a descendant). Time consistency of the transfers is not enforced.
+// Matrices are flat arrays, one row of species nodes (by index) per gene node
+// (by index). Summing over the receivers of each donor naively would take
+// O(|G|.|S|^2); instead, the incomparable nodes of j are the subtrees of the 
+// siblings of j and of its ancestors, so a table of best receivers per gene 
+// node is built in O(|S|) (see incomparableTASK), for O(|G|.|S|) overall.
+
+// out[j] = MIN of X[k] over the species nodes k incomparable with j (INFTY if 
+// none); sub is a work array of species.size() cells.
+void incomparableTASK(const SpeciesTreeIndex & species, const TYPEDATA * X, TYPEDATA * sub, TYPEDATA * out)
+{
+	const int m = species.size();
+	const int * L = &species.left[0];
+	const int * R = &species.right[0];
+	const int * P = &species.parent[0];
+	// Children precede their parent in the order of the indices
+	for(int j=0;j<m;j++) 
+	{
+		TYPEDATA tmp = X[j];
+		if (L[j]!=-1)
+		{ tmp = MIN(tmp,sub[L[j]]); }
+		if (R[j]!=-1)
+		{ tmp = MIN(tmp,sub[R[j]]); }
+		sub[j] = tmp;
+	}
+	for(int j=m-1;j>=0;j--) 
+	{
+		if (P[j]==-1)
+		{ out[j] = INFTY; }
+		else
+		{
+			int s = (L[P[j]]==j)? R[P[j]] : L[P[j]];
+			out[j] = (s==-1)? out[P[j]] : MIN(out[P[j]],sub[s]);
+		}
+	}
+}
+
+void fillTransferMatricesTASK(Tree * GeneTree, const SpeciesTreeIndex & species, double transferCost, vector<TYPEDATA> & F)
+{
+	vector<Tree*> DfoG = computeDepthFirstOrder(GeneTree);
+	LeafSpeciesIndex leaves(GeneTree, species);
+	const int m = species.size();
+	const int * L = &species.left[0];
+	const int * R = &species.right[0];
+	const TYPEDATA transferW = TRANSFER_COST(transferCost);
+	vector<TYPEDATA> sub(m), Oa(m), Ob(m);
+	F.assign(DfoG.size()*m,INFTY);
+	for(int i=0;i<DfoG.size();i++) 
+	{
+		Tree * g = DfoG[i];
+		TYPEDATA * Fi = &F[i*m];
+		if (g->isLeaf())
+		{
+			if (leaves.getSpecies(i)!=-1)
+			{ Fi[leaves.getSpecies(i)] = ZERO; }
+		}
+		else if (g->getLeft() && g->getRight())
+		{
+			const TYPEDATA * Fa = &F[g->getLeft()->getIndex()*m];
+			const TYPEDATA * Fb = &F[g->getRight()->getIndex()*m];
+			// Best receivers of each child
+			incomparableTASK(species, Fa, &sub[0], &Oa[0]);
+			incomparableTASK(species, Fb, &sub[0], &Ob[0]);
+			for(int j=0;j<m;j++) 
+			{
+				TYPEDATA tmp = PLUS(DUP_COST,PLUS(Fa[j],Fb[j]));
+				if (L[j]!=-1 && R[j]!=-1)
+				{
+					tmp = MIN(tmp,PLUS(Fa[L[j]],Fb[R[j]]));
+					tmp = MIN(tmp,PLUS(Fa[R[j]],Fb[L[j]]));
+				}
+				tmp = MIN(tmp,PLUS(transferW,PLUS(Fa[j],Ob[j])));
+				tmp = MIN(tmp,PLUS(transferW,PLUS(Fb[j],Oa[j])));
+				Fi[j] = tmp;
+			}
+		}
+		for(int j=0;j<m;j++) 
+		{
+			if (L[j]!=-1)
+			{ Fi[j] = MIN(Fi[j],PLUS(LOSS_COST,Fi[L[j]])); }
+			if (R[j]!=-1)
+			{ Fi[j] = MIN(Fi[j],PLUS(LOSS_COST,Fi[R[j]])); }
+		}
+	}
+}
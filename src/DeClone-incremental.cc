@@ -0,0 +1,309 @@
+/*  DeClone: A software for computing and analyzing ancestral adjacency scenarios.
+ *  Copyright (C) 2015 Cedric Chauve, Yann Ponty, Ashok Rajaraman, Joao P.P. Zanetti
+ *
+ *  This file is part of DeClone.
+ *  
+ *  DeClone is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  DeClone is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with DeClone.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Contact: <yann.ponty@lix.polytechnique.fr>.
+ *
+ *
+ *  DeClone uses the Quickhull algorithm implementation programmed by 
+ *  Anatoly V. Tomilov. The code is available on <https://bitbucket.org/tomilov/quickhull/src/585267abb3a63794c04fc8325aa9ec9f726112ed/include/quickhull.hpp?at=master>.
+ *
+ *  Contact: <tomilovanatoliy@gmail.com>
+ */
+
+#include "DeClone-incremental.hh"
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include "DeClone-parsimony.hh"
+#include "DeClone-inside.hh"
+#include "DeClone-outside.hh"
+#include "utils.hh"
+
+AdjacencyDiff loadAdjacencyDiff(string path)
+{
+     AdjacencyDiff diff;
+     ifstream in(path.c_str());
+     string line;
+     while (getline(in,line))
+     {
+          istringstream fields(line);
+          string op, g1, g2;
+          if (!(fields >> op >> g1 >> g2))
+          { continue; }
+          if (op=="+")
+          { diff.added.push_back(pair<string,string>(g1,g2)); }
+          else if (op=="-")
+          { diff.removed.push_back(pair<string,string>(g1,g2)); }
+     }
+     return diff;
+}
+
+// Leaves of a tree, indexed by gene name
+map<string, vector<RecTree*> > leavesByGeneName(RecTree * t)
+{
+     map<string, vector<RecTree*> > result;
+     vector<RecTree*> Dfo = computeDepthFirstOrder(t,false);
+     for (int i=0; i<Dfo.size(); i++)
+     {
+          if (Dfo[i]->isLeaf())
+          { result[split(Dfo[i]->getLabel(),'|')[0]].push_back(Dfo[i]); }
+     }
+     return result;
+}
+
+// Pairs of leaves (of t1 and t2) that are involved in a diff
+vector<pair<RecTree*,RecTree*> > modifiedLeafPairs(RecTree * t1, RecTree * t2, AdjacencyDiff & diff)
+{
+     vector<pair<RecTree*,RecTree*> > result;
+     map<string, vector<RecTree*> > leaves1 = leavesByGeneName(t1);
+     map<string, vector<RecTree*> > leaves2 = leavesByGeneName(t2);
+     vector<pair<string,string> > all(diff.added);
+     all.insert(all.end(),diff.removed.begin(),diff.removed.end());
+     for (int k=0; k<all.size(); k++)
+     {
+          for (int o=0; o<2; o++)
+          {
+               string g1 = (o==0)? all[k].first : all[k].second;
+               string g2 = (o==0)? all[k].second : all[k].first;
+               map<string, vector<RecTree*> >::iterator l1 = leaves1.find(g1);
+               map<string, vector<RecTree*> >::iterator l2 = leaves2.find(g2);
+               if ((l1 != leaves1.end()) && (l2 != leaves2.end()))
+               {
+                    for (int a=0; a<l1->second.size(); a++)
+                    {
+                         for (int b=0; b<l2->second.size(); b++)
+                         { result.push_back(pair<RecTree*,RecTree*>(l1->second[a],l2->second[b])); }
+                    }
+               }
+          }
+     }
+     return result;
+}
+
+bool adjacencyDiffTouches(RecTree * t1, RecTree * t2, AdjacencyDiff & diff)
+{
+     return modifiedLeafPairs(t1,t2,diff).size()>0;
+}
+
+IncrementalDeClone::IncrementalDeClone(RecTree * t1, RecTree * t2, map<string, map<string,string> > & adjacencies, IncrementalSemiring semiring, double kTval)
+{
+     this->semiring = semiring;
+     this->kTval = kTval;
+     this->adjacencies = adjacencies;
+     tree1 = t1;
+     tree2 = t2;
+     rowsComputed = 0;
+     Dfo2 = computeDepthFirstOrder(tree2);
+     vector<RecTree*> Dfo1 = computeDepthFirstOrder(tree1);
+     nodes1 = Dfo1;
+     for (int i=0; i<Dfo1.size(); i++)
+     {
+          C0.push_back(new double[Dfo2.size()]);
+          C1.push_back(new double[Dfo2.size()]);
+     }
+     for (int i=0; i<Dfo1.size(); i++)
+     { computeRow(Dfo1[i]); }
+}
+
+IncrementalDeClone::~IncrementalDeClone()
+{
+     for (int i=0; i<C0.size(); i++)
+     {
+          delete[] C0[i];
+          delete[] C1[i];
+     }
+}
+
+void IncrementalDeClone::assignIndex(RecTree * v)
+{
+     if (freeIndices.size()>0)
+     {
+          int i = freeIndices.back();
+          freeIndices.pop_back();
+          v->setIndex(i);
+          nodes1[i] = v;
+     }
+     else
+     {
+          v->setIndex(nodes1.size());
+          nodes1.push_back(v);
+          C0.push_back(new double[Dfo2.size()]);
+          C1.push_back(new double[Dfo2.size()]);
+     }
+}
+
+void IncrementalDeClone::computeRow(RecTree * v, const char * mask)
+{
+     if (semiring==INCREMENTAL_PARSIMONY)
+     { computeRowParsimony(v, Dfo2, &C0[0], &C1[0], adjacencies, mask); }
+     else
+     {
+          kT = kTval;
+          computeRowInside(v, Dfo2, &C0[0], &C1[0], adjacencies, mask);
+     }
+     rowsComputed++;
+}
+
+void IncrementalDeClone::computeAncestorRows(RecTree * v)
+{
+     for (RecTree * a = v->getParent(); a != NULL; a = a->getParent())
+     { computeRow(a); }
+}
+
+double IncrementalDeClone::getResult()
+{
+     int i = tree1->getIndex();
+     int j = tree2->getIndex();
+     if (semiring==INCREMENTAL_PARSIMONY)
+     { return min(C1[i][j],C0[i][j]); }
+     else
+     { return C1[i][j]+C0[i][j]; }
+}
+
+RecTree * IncrementalDeClone::getTree1()
+{
+     return tree1;
+}
+
+RecTree * IncrementalDeClone::findNode(string nd)
+{
+     for (int i=0; i<nodes1.size(); i++)
+     {
+          if ((nodes1[i]!=NULL) && (nodes1[i]->getND()==nd))
+          { return nodes1[i]; }
+     }
+     return NULL;
+}
+
+void IncrementalDeClone::replaceSubtree(RecTree * old, RecTree * replacement)
+{
+     RecTree * parent = old->getParent();
+     if (parent==NULL)
+     {
+          tree1 = replacement;
+          replacement->setParent(NULL);
+     }
+     else if (parent->getLeft()==old)
+     { parent->setLeft(replacement); }
+     else
+     { parent->setRight(replacement); }
+
+     // Rows of the removed nodes become available
+     vector<RecTree*> removed = computeDepthFirstOrder(old,false);
+     for (int i=0; i<removed.size(); i++)
+     {
+          nodes1[removed[i]->getIndex()] = NULL;
+          freeIndices.push_back(removed[i]->getIndex());
+     }
+     old->setParent(NULL);
+     delete old;
+
+     // Children are computed before their parents, whatever their indices
+     vector<RecTree*> added = computeDepthFirstOrder(replacement,false);
+     for (int i=0; i<added.size(); i++)
+     { assignIndex(added[i]); }
+     for (int i=0; i<added.size(); i++)
+     { computeRow(added[i]); }
+     computeAncestorRows(replacement);
+}
+
+void IncrementalDeClone::nodeChanged(RecTree * v)
+{
+     computeRow(v);
+     computeAncestorRows(v);
+}
+
+long IncrementalDeClone::getRowsComputed()
+{
+     return rowsComputed;
+}
+
+void IncrementalDeClone::applyAdjacencyDiff(AdjacencyDiff & diff)
+{
+     for (int k=0; k<diff.removed.size(); k++)
+     {
+          string g1 = diff.removed[k].first;
+          string g2 = diff.removed[k].second;
+          if (adjacencies.count(g1)>0)
+          { adjacencies[g1].erase(g2); }
+          if (adjacencies.count(g2)>0)
+          { adjacencies[g2].erase(g1); }
+     }
+     for (int k=0; k<diff.added.size(); k++)
+     { adjacencies[diff.added[k].first][diff.added[k].second] = ""; }
+
+     vector<pair<RecTree*,RecTree*> > leaves = modifiedLeafPairs(tree1,tree2,diff);
+     if (leaves.size()==0)
+     { return; }
+     vector<vector<char> > mask(nodes1.size(), vector<char>(Dfo2.size(), CELL_SKIP));
+     vector<bool> dirtyRow(nodes1.size(), false);
+     for (int k=0; k<leaves.size(); k++)
+     {
+          for (RecTree * a1 = leaves[k].first; a1 != NULL; a1 = a1->getParent())
+          {
+               dirtyRow[a1->getIndex()] = true;
+               for (RecTree * a2 = leaves[k].second; a2 != NULL; a2 = a2->getParent())
+               { mask[a1->getIndex()][a2->getIndex()] = CELL_COMPUTE; }
+          }
+     }
+     // Rows are filled children first
+     vector<RecTree*> Dfo1 = computeDepthFirstOrder(tree1,false);
+     for (int i=0; i<Dfo1.size(); i++)
+     {
+          int r = Dfo1[i]->getIndex();
+          if (dirtyRow[r])
+          { computeRow(Dfo1[i], &mask[r][0]); }
+     }
+}
+
+// Renumbers the nodes of tree1 in depth-first order, as expected by the outside DP 
+void IncrementalDeClone::compactIndices()
+{
+     vector<RecTree*> Dfo1 = computeDepthFirstOrder(tree1,false);
+     vector<double*> newC0(Dfo1.size());
+     vector<double*> newC1(Dfo1.size());
+     for (int i=0; i<Dfo1.size(); i++)
+     {
+          int r = Dfo1[i]->getIndex();
+          newC0[i] = C0[r];
+          newC1[i] = C1[r];
+          C0[r] = NULL;
+          C1[r] = NULL;
+     }
+     for (int r=0; r<C0.size(); r++)
+     {
+          delete[] C0[r];
+          delete[] C1[r];
+     }
+     C0 = newC0;
+     C1 = newC1;
+     for (int i=0; i<Dfo1.size(); i++)
+     { Dfo1[i]->setIndex(i); }
+     nodes1 = Dfo1;
+     freeIndices.clear();
+}
+
+double*** IncrementalDeClone::computeWeights(vector<RecTree*> & Dfo1, vector<RecTree*> & Dfo2)
+{
+     compactIndices();
+     Dfo1 = nodes1;
+     Dfo2 = this->Dfo2;
+     kT = kTval;
+     return computeOutsideWeights(tree1, tree2, Dfo1, Dfo2, &C0[0], &C1[0], adjacencies);
+}
@@ -0,0 +1,106 @@
+/*  DeClone: A software for computing and analyzing ancestral adjacency scenarios.
+ *  Copyright (C) 2015 Cedric Chauve, Yann Ponty, Ashok Rajaraman, Joao P.P. Zanetti
+ *
+ *  This file is part of DeClone.
+ *  
+ *  DeClone is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  DeClone is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with DeClone.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Contact: <yann.ponty@lix.polytechnique.fr>.
+ *
+ *
+ *  DeClone uses the Quickhull algorithm implementation programmed by 
+ *  Anatoly V. Tomilov. The code is available on <https://bitbucket.org/tomilov/quickhull/src/585267abb3a63794c04fc8325aa9ec9f726112ed/include/quickhull.hpp?at=master>.
+ *
+ *  Contact: <tomilovanatoliy@gmail.com>
+ */
+
+#include <map>
+#include <string>
+#include <vector>
+#include "RecTrees.hh"
+
+#ifndef DECO_INCREMENTAL_HH
+#define DECO_INCREMENTAL_HH
+
+using namespace std;
+
+// Extant adjacencies added to, and removed from, an adjacency list
+struct AdjacencyDiff{
+     vector<pair<string,string> > added;
+     vector<pair<string,string> > removed;
+};
+
+// Loads a diff, consisting of lines '+ g1 g2' (added) or '- g1 g2' (removed)
+AdjacencyDiff loadAdjacencyDiff(string path);
+
+// Checks whether a diff involves a gene of t1 and a gene of t2 
+bool adjacencyDiffTouches(RecTree * t1, RecTree * t2, AdjacencyDiff & diff);
+
+typedef enum{ INCREMENTAL_PARSIMONY, 
+              INCREMENTAL_INSIDE 
+            } IncrementalSemiring;
+
+// Keeps the C0/C1 tables of a pair of gene trees, and updates them when a 
+// subtree of the first tree is edited.
+// 
+// Nodes of the first tree keep their index (i.e. row) for their whole lifetime,
+// and new nodes are given free (or fresh) indices, so that only the rows of 
+// the edited nodes and of their ancestors need to be recomputed.
+class IncrementalDeClone{
+private:
+     IncrementalSemiring semiring;
+     double kTval;
+     RecTree * tree1;
+     RecTree * tree2;
+     map<string, map<string,string> > adjacencies;
+     vector<RecTree*> Dfo2;
+     vector<RecTree*> nodes1;
+     vector<int> freeIndices;
+     vector<double*> C0;
+     vector<double*> C1;
+     long rowsComputed;
+
+     void assignIndex(RecTree * v);
+     void computeRow(RecTree * v, const char * mask = NULL);
+     void computeAncestorRows(RecTree * v);
+     void compactIndices();
+
+public:
+     IncrementalDeClone(RecTree * t1, RecTree * t2, map<string, map<string,string> > & adjacencies, IncrementalSemiring semiring, double kTval = 1.0);
+     ~IncrementalDeClone();
+
+     // Min. cost (parsimony) or partition function (inside) of the current pair
+     double getResult();
+
+     RecTree * getTree1();
+     RecTree * findNode(string nd);
+
+     // Replaces a subtree of the first tree (which is deleted) by another one
+     void replaceSubtree(RecTree * old, RecTree * replacement);
+     // To be called after the event and/or species of a node have been changed
+     void nodeChanged(RecTree * v);
+
+     // Updates the list of adjacencies. Only the cells (v1,v2) such that v1 and
+     // v2 are ancestors of a pair of modified leaves are recomputed.
+     void applyAdjacencyDiff(AdjacencyDiff & diff);
+
+     // Weights of each case in each cell (see computeOutside), from the current 
+     // C0/C1 tables (inside semiring only). The outside tables depend on every 
+     // extant adjacency outside of their cell, and are thus fully recomputed.
+     double*** computeWeights(vector<RecTree*> & Dfo1, vector<RecTree*> & Dfo2);
+
+     long getRowsComputed();
+};
+
+#endif
@@ -33,6 +33,7 @@
 #include <utility>
 #include "RecTrees.hh"
 #include "utils.hh"
+#include "DeClone-memo.hh"
 
 
 #define RESULT_TYPE double
@@ -49,14 +50,30 @@
 #define allocateMatrix allocateMatrixInside
 #define deleteMatrix deleteMatrixInside 
 #define computeMatrix computeMatrixInside
+#define computeRow computeRowInside
+
+static SubtreePairCache insideCache;
+
+#define CELL_LOOKUP_ACTIVE subtreeCacheEnabled
+#define CELL_LOOKUP(i,j,v1,v2,c0,c1) insideCache.lookup(i,j,c0,c1)
+#define CELL_STORE(i,j,v1,v2,c0,c1) insideCache.store(i,j,c0,c1)
 
 #include "DeCoDP.cc"
 
+SubtreePairCache & getInsideCache()
+{
+     return insideCache;
+}
+
 double computeInside(RecTree *tree1, RecTree *tree2,  map<string, map<string,string> > & adjacencies, double kTval)
 {
   kT = kTval;
-  return MIN(
+  if (subtreeCacheEnabled)
+  { insideCache.prepare(tree1,tree2,adjacencies,cacheParameters(adjacency_gain,adjacency_break,kT,scalingFactor)); }
+  double result = MIN(
       MIN(INF,computeMatrixInside(tree1,tree2,true, adjacencies),"Root",true,"",""),
 	   	computeMatrixInside(tree1,tree2,false, adjacencies),"Root",false,"",""
 	);
+  insideCache.release();
+  return result;
 }
@@ -30,6 +30,7 @@
 #include <cmath>
 #include <map>
 #include "RecTrees.hh"
+#include "DeClone-memo.hh"
 #include "float.h"
 
 #ifndef DECO_INSIDE_HH
@@ -37,4 +38,11 @@
 
 double computeInside(RecTree *tree1, RecTree *tree2,  map<string, map<string,string> > & adjacencies, double kTval);
 
+// Fills the row of v1 in C0/C1 tables indexed by the (stable) indices of the nodes.
+// If mask is not NULL, only fills the cells marked as CELL_COMPUTE.
+void computeRowInside(RecTree * v1, vector<RecTree*> & Dfo2, double** C0, double** C1, map<string, map<string,string> > & adjacencies, const char * mask = NULL);
+
+// Cache used by the above when subtreeCacheEnabled is set
+SubtreePairCache & getInsideCache();
+
 #endif
@@ -0,0 +1,189 @@
+/*  DeClone: A software for computing and analyzing ancestral adjacency scenarios.
+ *  Copyright (C) 2015 Cedric Chauve, Yann Ponty, Ashok Rajaraman, Joao P.P. Zanetti
+ *
+ *  This file is part of DeClone.
+ *  
+ *  DeClone is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  DeClone is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with DeClone.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Contact: <yann.ponty@lix.polytechnique.fr>.
+ *
+ *
+ *  DeClone uses the Quickhull algorithm implementation programmed by 
+ *  Anatoly V. Tomilov. The code is available on <https://bitbucket.org/tomilov/quickhull/src/585267abb3a63794c04fc8325aa9ec9f726112ed/include/quickhull.hpp?at=master>.
+ *
+ *  Contact: <tomilovanatoliy@gmail.com>
+ */
+
+#include "DeClone-memo.hh"
+
+#include <sstream>
+#include "utils.hh"
+
+bool subtreeCacheEnabled = false;
+
+SubtreePairCache::SubtreePairCache(size_t maxEntries)
+{
+     this->maxEntries = maxEntries;
+     ready = false;
+     param = -1;
+     hits = 0;
+     misses = 0;
+}
+
+// Assigns the same id to identical subtrees (events, species, children), regardless of gene names
+int SubtreePairCache::internShape(RecTree * t, vector<int> & shapes)
+{
+     ostringstream o;
+     o << t->getEvent() << "|" << t->getSpecies() << "|";
+     o << (t->getLeft()?  shapes[t->getLeft()->getIndex()]:-1) << "|";
+     o << (t->getRight()? shapes[t->getRight()->getIndex()]:-1);
+     string s = o.str();
+     map<string,int>::iterator it = shapeIds.find(s);
+     if (it != shapeIds.end())
+     { return it->second; }
+     int id = shapeIds.size();
+     shapeIds[s] = id;
+     return id;
+}
+
+void markAncestorPairs(RecTree * l1, RecTree * l2, vector<vector<bool> > & hasAdjacency)
+{
+     for (RecTree * a1 = l1; a1 != NULL; a1 = a1->getParent())
+     {
+          if (hasAdjacency[a1->getIndex()][l2->getIndex()])
+          { break; }
+          for (RecTree * a2 = l2; a2 != NULL; a2 = a2->getParent())
+          { hasAdjacency[a1->getIndex()][a2->getIndex()] = true; }
+     }
+}
+
+void SubtreePairCache::prepare(RecTree * t1, RecTree * t2, map<string, map<string,string> > & adjacencies, const string & params)
+{
+     if (entries.size() > maxEntries)
+     { clear(); }
+     vector<RecTree*> Dfo1 = computeDepthFirstOrder(t1);
+     vector<RecTree*> Dfo2 = computeDepthFirstOrder(t2);
+     shapes1.assign(Dfo1.size(), -1);
+     shapes2.assign(Dfo2.size(), -1);
+     for (int i=0; i<Dfo1.size(); i++)
+     { shapes1[i] = internShape(Dfo1[i], shapes1); }
+     for (int j=0; j<Dfo2.size(); j++)
+     { shapes2[j] = internShape(Dfo2[j], shapes2); }
+
+     map<string,int>::iterator it = paramIds.find(params);
+     if (it == paramIds.end())
+     {
+          param = paramIds.size();
+          paramIds[params] = param;
+     }
+     else
+     { param = it->second; }
+
+     // Cells having an adjacent pair of leaves in their subtrees
+     hasAdjacency.assign(Dfo1.size(), vector<bool>(Dfo2.size(), false));
+     map<string, vector<RecTree*> > leaves2;
+     for (int j=0; j<Dfo2.size(); j++)
+     {
+          if (Dfo2[j]->isLeaf())
+          { leaves2[split(Dfo2[j]->getLabel(),'|')[0]].push_back(Dfo2[j]); }
+     }
+     for (int i=0; i<Dfo1.size(); i++)
+     {
+          if (!Dfo1[i]->isLeaf())
+          { continue; }
+          string g1 = split(Dfo1[i]->getLabel(),'|')[0];
+          map<string, map<string,string> >::iterator adj = adjacencies.find(g1);
+          if (adj != adjacencies.end())
+          {
+               for (map<string,string>::iterator g2 = adj->second.begin(); g2 != adj->second.end(); g2++)
+               {
+                    map<string, vector<RecTree*> >::iterator l2 = leaves2.find(g2->first);
+                    if (l2 != leaves2.end())
+                    {
+                         for (int k=0; k<l2->second.size(); k++)
+                         { markAncestorPairs(Dfo1[i], l2->second[k], hasAdjacency); }
+                    }
+               }
+          }
+          // Adjacencies are not necessarily symmetric in the input
+          for (map<string, vector<RecTree*> >::iterator l2 = leaves2.begin(); l2 != leaves2.end(); l2++)
+          {
+               map<string, map<string,string> >::iterator rev = adjacencies.find(l2->first);
+               if ((rev != adjacencies.end()) && (rev->second.count(g1)>0))
+               {
+                    for (int k=0; k<l2->second.size(); k++)
+                    { markAncestorPairs(Dfo1[i], l2->second[k], hasAdjacency); }
+               }
+          }
+     }
+     ready = true;
+}
+
+void SubtreePairCache::release()
+{
+     ready = false;
+}
+
+SubtreePairCache::CellKey SubtreePairCache::key(int i, int j)
+{
+     return CellKey(pair<int,int>(shapes1[i],shapes2[j]),param);
+}
+
+bool SubtreePairCache::lookup(int i, int j, double & c0, double & c1)
+{
+     if (!ready || hasAdjacency[i][j])
+     { return false; }
+     map<CellKey, pair<double,double> >::iterator it = entries.find(key(i,j));
+     if (it == entries.end())
+     { 
+          misses++;
+          return false; 
+     }
+     hits++;
+     c0 = it->second.first;
+     c1 = it->second.second;
+     return true;
+}
+
+void SubtreePairCache::store(int i, int j, double c0, double c1)
+{
+     if (!ready || hasAdjacency[i][j])
+     { return; }
+     entries[key(i,j)] = pair<double,double>(c0,c1);
+}
+
+long SubtreePairCache::getHits()
+{ return hits; }
+
+long SubtreePairCache::getMisses()
+{ return misses; }
+
+size_t SubtreePairCache::size()
+{ return entries.size(); }
+
+void SubtreePairCache::clear()
+{
+     entries.clear();
+     shapeIds.clear();
+     paramIds.clear();
+     ready = false;
+}
+
+string cacheParameters(double p1, double p2, double p3, double p4)
+{
+     ostringstream o;
+     o.precision(17);
+     o << p1 << "|" << p2 << "|" << p3 << "|" << p4;
+     return o.str();
+}
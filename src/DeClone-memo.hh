@@ -0,0 +1,91 @@
+/*  DeClone: A software for computing and analyzing ancestral adjacency scenarios.
+ *  Copyright (C) 2015 Cedric Chauve, Yann Ponty, Ashok Rajaraman, Joao P.P. Zanetti
+ *
+ *  This file is part of DeClone.
+ *  
+ *  DeClone is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  DeClone is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with DeClone.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Contact: <yann.ponty@lix.polytechnique.fr>.
+ *
+ *
+ *  DeClone uses the Quickhull algorithm implementation programmed by 
+ *  Anatoly V. Tomilov. The code is available on <https://bitbucket.org/tomilov/quickhull/src/585267abb3a63794c04fc8325aa9ec9f726112ed/include/quickhull.hpp?at=master>.
+ *
+ *  Contact: <tomilovanatoliy@gmail.com>
+ */
+
+#include <map>
+#include <string>
+#include <vector>
+#include <utility>
+#include "RecTrees.hh"
+
+#ifndef DECOMEMO_HH
+#define DECOMEMO_HH
+
+using namespace std;
+
+// When set, the parsimony and inside DPs reuse the values of previously seen 
+// pairs of subtrees (see SubtreePairCache), e.g. across the pairs of a batch.
+extern bool subtreeCacheEnabled;
+
+// Process-wide cache of (C0,C1) values for pairs of subtrees.
+// 
+// The value of a DP cell (v1,v2) only depends on the shapes of the subtrees 
+// rooted at v1 and v2 (topology, events and species), as long as no extant 
+// adjacency links a leaf of v1 to a leaf of v2. Such cells are keyed by the 
+// canonical ids of both subtree shapes, together with the current cost 
+// parameters, and can be reused across (and within) pairs of gene trees.
+class SubtreePairCache{
+private:
+     typedef pair<pair<int,int>,int> CellKey;
+     map<string,int> shapeIds;
+     map<string,int> paramIds;
+     map<CellKey, pair<double,double> > entries;
+     size_t maxEntries;
+
+     // Current pair of trees, set by prepare
+     bool ready;
+     int param;
+     vector<int> shapes1;
+     vector<int> shapes2;
+     vector<vector<bool> > hasAdjacency;
+
+     long hits;
+     long misses;
+
+     int internShape(RecTree * t, vector<int> & shapes);
+     CellKey key(int i, int j);
+
+public:
+     SubtreePairCache(size_t maxEntries = 4000000);
+
+     // Computes shape ids and adjacency-free cells for a new pair of trees. 
+     // params must encode every parameter that the cell values depend on.
+     void prepare(RecTree * t1, RecTree * t2, map<string, map<string,string> > & adjacencies, const string & params);
+     void release();
+
+     bool lookup(int i, int j, double & c0, double & c1);
+     void store(int i, int j, double c0, double c1);
+
+     long getHits();
+     long getMisses();
+     size_t size();
+     void clear();
+};
+
+// Encodes a list of parameters as a cache key
+string cacheParameters(double p1, double p2, double p3 = 0., double p4 = 0.);
+
+#endif
@@ -33,4 +33,7 @@
 
 double*** computeOutside(RecTree *tree1, RecTree *tree2, map<string, map<string,string> > & adjacencies);
 
+// Outside pass, from C0/C1 tables already filled by the inside DP (see IncrementalDeClone)
+double*** computeOutsideWeights(RecTree * t1, RecTree * t2, vector<RecTree*> & Dfo1, vector<RecTree*> & Dfo2, double** C0, double** C1, map<string, map<string,string> > & adjacencies);
+
 #endif
@@ -32,6 +32,7 @@
 #include <utility>
 #include "RecTrees.hh"
 #include "utils.hh"
+#include "DeClone-memo.hh"
 
 
 #define RESULT_TYPE double
@@ -47,12 +48,28 @@
 #define allocateMatrix allocateMatrixParsimony 
 #define deleteMatrix deleteMatrixParsimony 
 #define computeMatrix computeMatrixParsimony 
+#define computeRow computeRowParsimony
+
+static SubtreePairCache parsimonyCache;
+
+#define CELL_LOOKUP_ACTIVE subtreeCacheEnabled
+#define CELL_LOOKUP(i,j,v1,v2,c0,c1) parsimonyCache.lookup(i,j,c0,c1)
+#define CELL_STORE(i,j,v1,v2,c0,c1) parsimonyCache.store(i,j,c0,c1)
 
 #include "DeCoDP.cc"
 
+SubtreePairCache & getParsimonyCache()
+{
+     return parsimonyCache;
+}
+
 RESULT_TYPE computeMaxParsimony(RecTree *tree1, RecTree *tree2, map<string, map<string,string> > & adjacencies)
 {
-     return MIN(computeMatrixParsimony(tree1,tree2,true, adjacencies),
+     if (subtreeCacheEnabled)
+     { parsimonyCache.prepare(tree1,tree2,adjacencies,cacheParameters(adjacency_gain,adjacency_break)); }
+     RESULT_TYPE result = MIN(computeMatrixParsimony(tree1,tree2,true, adjacencies),
 		computeMatrixParsimony(tree1,tree2,false, adjacencies),
 		"","","","");
+     parsimonyCache.release();
+     return result;
 }
@@ -26,11 +26,19 @@
  */
 
 #include "RecTrees.hh"
+#include "DeClone-memo.hh"
 
 #ifndef DECOPARS_HH
 #define DECOPARS_HH
 
 double computeMaxParsimony(RecTree *tree1, RecTree *tree2, map<string, map<string,string> > & adjacencies);
 
+// Fills the row of v1 in C0/C1 tables indexed by the (stable) indices of the nodes.
+// If mask is not NULL, only fills the cells marked as CELL_COMPUTE.
+void computeRowParsimony(RecTree * v1, vector<RecTree*> & Dfo2, double** C0, double** C1, map<string, map<string,string> > & adjacencies, const char * mask = NULL);
+
+// Cache used by the above when subtreeCacheEnabled is set
+SubtreePairCache & getParsimonyCache();
+
 
 #endif
@@ -33,77 +33,205 @@
 #include "RecTrees.hh"
 #include "utils.hh"
 #include "ConvexPolytope.hh"
+#include "IntPolytope.hh"
+#include "PolytopeChains.hh"
+#include "TaskGraph.hh"
 #include <fstream>
 #include <iostream>
 #include <cstdlib>
 
-#define RESULT_TYPE Polytope
 #define DIMENSION 3
+#define RESULT_TYPE IntPolytope<DIMENSION>
 
 #define allocateMatrix allocateMatrixAdjPolytope
 #define deleteMatrix deleteMatrixAdjPolytope
 #define computeMatrix computeMatrixAdjPolytope
 
-#define AdjGain Polytope(DIMENSION,adjgain)
-#define AdjBreak Polytope(DIMENSION,adjbreak)
-#define ZERO Polytope(DIMENSION,origin)
-#define INF Polytope(DIMENSION)
+#define AdjGain RESULT_TYPE(adjgain)
+#define AdjBreak RESULT_TYPE(adjbreak)
+#define ZERO RESULT_TYPE(origin)
+#define INF RESULT_TYPE()
 #define RESCALING_FACTOR(a) ZERO 
 
 #define PLUS(a,b) minkowski_addition_adj(a,b) 
-#define MIN(a,b,c,adj,g1,g2) convex_hull_adj(a,b,adj,g1,g2)
+#define PLUS_CHAINS
+#define PLUS3(a,b,c) minkowskiChain<RESULT_TYPE>({a,b,c},minkowski_addition_adj) 
+#define PLUS4(a,b,c,d) minkowskiChain<RESULT_TYPE>({a,b,c,d},minkowski_addition_adj) 
+#define PLUS5(a,b,c,d,e) minkowskiChain<RESULT_TYPE>({a,b,c,d,e},minkowski_addition_adj) 
+#define PLUS6(a,b,c,d,e,f) minkowskiChain<RESULT_TYPE>({a,b,c,d,e,f},minkowski_addition_adj) 
+#define PLUS7(a,b,c,d,e,f,g) minkowskiChain<RESULT_TYPE>({a,b,c,d,e,f,g},minkowski_addition_adj) 
+#define MIN(a,b,c,adj,g1,g2) coneConvexSum<RESULT_TYPE>(a,b)
 
+#define CELL_STORE(i,j,v1,v2,c0,c1) { applyVertexBudget(c0,adjacency_gain,adjacency_break); \
+                                      applyVertexBudget(c1,adjacency_gain,adjacency_break); \
+                                      vertexGrowth.recordCell(v1->getND(),v2->getND(),(c0).size(),(c1).size()); }
 
-std::pair<std::string,std::string> adj_pair;
-const double adjgain[] = {1.,0.,0.};
-const double adjbreak[] = {0.,1.,0.};
-const double origin[] = {0.,0.,0.};
 
+const int32_t adjgain[] = {1,0,0};
+const int32_t adjbreak[] = {0,1,0};
+const int32_t origin[] = {0,0,0};
+const int32_t adjacency_param[] = {0,0,1};
 
-Polytope minkowski_addition_adj(Polytope p1, Polytope p2)
+
+// Reduced to its extreme points, so that chained sums do not multiply points
+RESULT_TYPE minkowski_addition_adj(RESULT_TYPE p1, RESULT_TYPE p2)
 {
-  return p1.minkovskiSum(p2);
+  RESULT_TYPE res = p1.minkovskiSum(p2);
+  vertexGrowth.recordSum(res.size());
+  return res;
 }
 
-Polytope adjacency_parameter_shift(Polytope p, const bool adj, const std::string& g1, const std::string& g2){
-  
-    //if (((g1 == adj_pair.first)) ){
-    //  cout << g1 << " ("<< g1.size() << ") "<<g2<< " ("<< g2.size() << ") "<<" "<<adj_pair.first<<" ("<<adj_pair.first.size()<<") "<<adj_pair.second<<" ("<<adj_pair.second.size() << ") -> YES "  << endl;
-    //}
-    
-    if (adj && ((g1 == adj_pair.first && g2 == adj_pair.second)) ){
-       const double adjacency_param[] = {0.,0.,1.};
-       return p.minkovskiSum(Polytope(DIMENSION,adjacency_param));     
-    }
-    else{
-        return p;
-    }
-}
+#include "DeCoDP.cc"
+
 
-Polytope convex_hull_adj(Polytope p1, \
-                            Polytope p2, \
-                            const bool adj, \
-                            const std::string& g1, \
-                            const std::string& g2){
-    //cout << g1 << " "<<g2<<" "<<adj_pair.first<<" "<<adj_pair.second << " -> " << adjacency_parameter_shift(p2,adj,g1,g2) << endl;
-    //cout << "Convx: "<< p1 << " "<<p2<<" ["<< adjacency_parameter_shift(p2,adj,g1,g2)<<"]=> "<< p1.convexSum(adjacency_parameter_shift(p2,adj,g1,g2)) << endl;
-    Polytope result = p1.convexSum(adjacency_parameter_shift(p2,adj,g1,g2));
-    return result;
+static RESULT_TYPE adjpolyRootResult(RESULT_TYPE** C0, RESULT_TYPE** C1, int i, int j)
+{
+    return MIN(MIN(INF,C1[i][j],"Root",true,"N/A","N/A"),
+               C0[i][j],
+  	           "Root",false,"N/A","N/A");
 }
 
+static void indexNodes(vector<RecTree*> & Dfo, map<string,RecTree*> & nodes)
+{
+    for(int i=0;i<Dfo.size();i++) 
+    { nodes[Dfo[i]->getND()] = Dfo[i]; }
+}
 
-#include "DeCoDP.cc"
+// Tables of a thread answering queries: the rows of the ancestors of the first
+// node of the adjacency point to private copies, the other rows to the tables 
+// of the shared propagation
+class AdjQueryWorkspace{
+  public:
+    vector<RESULT_TYPE*> rows0, rows1;
+    vector<RESULT_TYPE*> own0, own1;
+    vector<char> mask;
+
+    AdjQueryWorkspace(RESULT_TYPE** C0, RESULT_TYPE** C1, int n1, int n2) : 
+      rows0(C0,C0+n1), rows1(C1,C1+n1), mask(n2,CELL_SKIP)
+    {
+    }
 
+    ~AdjQueryWorkspace()
+    {
+        for(int l=0;l<own0.size();l++) 
+        {
+            delete[] own0[l];
+            delete[] own1[l];
+        }
+    }
+};
 
-Polytope adjpolycomputeValidAdjacencyTrees(RecTree *tree1, RecTree *tree2,  map<string, map<string,string> > & adjacencies, const std::string& gene1, const std::string& gene2)
+// The adjacency (v1,v2) only shifts the C1 cell of (v1,v2), so only the cells of 
+// pairs of ancestors of v1 and v2 are recomputed from the shared propagation
+static RESULT_TYPE adjpolyQuery(RecTree * v1, RecTree * v2, RESULT_TYPE** C0, RESULT_TYPE** C1, 
+                                vector<RecTree*> & Dfo2, AdjQueryWorkspace & ws,
+                                map<string, map<string,string> > & adjacencies)
 {
-    adj_pair.first = gene1;
-    adj_pair.second = gene2;
+    vector<RecTree*> anc1, anc2;
+    for(RecTree * v=v1;v!=NULL;v=v->getParent()) 
+    { anc1.push_back(v); }
+    for(RecTree * v=v2;v!=NULL;v=v->getParent()) 
+    { anc2.push_back(v); }
+    // Columns read when computing the cells of anc2
+    vector<int> cols;
+    for(int b=0;b<anc2.size();b++) 
+    {
+        cols.push_back(anc2[b]->getIndex());
+        if (anc2[b]->getLeft())
+        { cols.push_back(anc2[b]->getLeft()->getIndex()); }
+        if (anc2[b]->getRight())
+        { cols.push_back(anc2[b]->getRight()->getIndex()); }
+    }
+    while (ws.own0.size()<anc1.size())
+    {
+        ws.own0.push_back(new RESULT_TYPE[Dfo2.size()]);
+        ws.own1.push_back(new RESULT_TYPE[Dfo2.size()]);
+    }
+    for(int a=0;a<anc1.size();a++) 
+    {
+        int i = anc1[a]->getIndex();
+        for(int c=0;c<cols.size();c++) 
+        {
+            ws.own0[a][cols[c]] = C0[i][cols[c]];
+            ws.own1[a][cols[c]] = C1[i][cols[c]];
+        }
+        ws.rows0[i] = ws.own0[a];
+        ws.rows1[i] = ws.own1[a];
+    }
+    int i1 = v1->getIndex();
+    int i2 = v2->getIndex();
+    ws.rows1[i1][i2] = ws.rows1[i1][i2].minkovskiSum(RESULT_TYPE(adjacency_param));
+    for(int b=1;b<anc2.size();b++) 
+    { ws.mask[anc2[b]->getIndex()] = CELL_COMPUTE; }
+    fillMatrixRow(v1, Dfo2, ws.rows0.data(), ws.rows1.data(), adjacencies, ws.mask.data());
+    ws.mask[i2] = CELL_COMPUTE;
+    for(int a=1;a<anc1.size();a++) 
+    {
+        fillMatrixRow(anc1[a], Dfo2, ws.rows0.data(), ws.rows1.data(), adjacencies, ws.mask.data());
+    }
+    RESULT_TYPE res = adjpolyRootResult(ws.rows0.data(), ws.rows1.data(), anc1.back()->getIndex(), anc2.back()->getIndex());
+    for(int a=0;a<anc1.size();a++) 
+    {
+        int i = anc1[a]->getIndex();
+        ws.rows0[i] = C0[i];
+        ws.rows1[i] = C1[i];
+    }
+    for(int b=0;b<anc2.size();b++) 
+    { ws.mask[anc2[b]->getIndex()] = CELL_SKIP; }
+    return res;
+}
 
-    return MIN(MIN(INF,computeMatrixAdjPolytope(tree1,tree2,true, adjacencies),"Root",true,"N/A","N/A"),
-               computeMatrixAdjPolytope(tree1,tree2,false, adjacencies),
-  	           "Root",false,"N/A","N/A");
+void adjpolycomputeAllAdjacencies(RecTree *tree1, RecTree *tree2,  map<string, map<string,string> > & adjacencies, const vector<pair<string,string> > & queries, vector<Polytope> & results)
+{
+    RESULT_TYPE** C0 = allocateMatrixAdjPolytope(tree1,tree2);
+    RESULT_TYPE** C1 = allocateMatrixAdjPolytope(tree1,tree2);
+    vector<RecTree*> Dfo1 = computeDepthFirstOrder(tree1);
+    vector<RecTree*> Dfo2 = computeDepthFirstOrder(tree2);
+    int r1 = Dfo1.size()-1;
+    int r2 = Dfo2.size()-1;
+    // The report of vertex growth is only consistent when collected by a single thread
+    int nbThreads = (vertexGrowth.isEnabled()? 1 : getNbWorkerThreads());
+
+    // Propagation without any adjacency of interest, shared by all the queries
+    runCellGraph(Dfo1, Dfo2, [&](RecTree * v1, RecTree * v2, int k)
+                 { fillMatrixCell(v1, v2, C0, C1, adjacencies); }, nbThreads);
+    Polytope base = adjpolyRootResult(C0,C1,r1,r2).toPolytope();
+
+    map<string,RecTree*> nodes1, nodes2;
+    indexNodes(Dfo1,nodes1);
+    indexNodes(Dfo2,nodes2);
+    vector<AdjQueryWorkspace*> workspaces;
+    for(int k=0;k<nbThreads;k++) 
+    { workspaces.push_back(new AdjQueryWorkspace(C0,C1,Dfo1.size(),Dfo2.size())); }
+
+    // Independent queries, spread over the threads
+    results.assign(queries.size(),base);
+    runTaskGraph(queries.size(), vector<int>(queries.size(),0), 
+        [&](int q, int k)
+        {
+            map<string,RecTree*>::iterator it1 = nodes1.find(queries[q].first);
+            map<string,RecTree*>::iterator it2 = nodes2.find(queries[q].second);
+            if ((it1!=nodes1.end()) && (it2!=nodes2.end()))
+            {
+                vertexGrowth.comment("Adjacency: "+queries[q].first+","+queries[q].second);
+                results[q] = adjpolyQuery(it1->second, it2->second, C0, C1, Dfo2, *workspaces[k], adjacencies).toPolytope();
+            }
+        },
+        [](int q, vector<int> & res) {},
+        nbThreads);
+
+    for(int k=0;k<nbThreads;k++) 
+    { delete workspaces[k]; }
+    deleteMatrixAdjPolytope(C0,tree1,tree2);
+    deleteMatrixAdjPolytope(C1,tree1,tree2);
+}
 
+Polytope adjpolycomputeValidAdjacencyTrees(RecTree *tree1, RecTree *tree2,  map<string, map<string,string> > & adjacencies, const std::string& gene1, const std::string& gene2)
+{
+    vector<pair<string,string> > queries(1,pair<string,string>(gene1,gene2));
+    vector<Polytope> results;
+    adjpolycomputeAllAdjacencies(tree1, tree2, adjacencies, queries, results);
+    return results[0];
 }
 
 
@@ -29,10 +29,17 @@
 #include "ConvexPolytope.hh"
 #include <map>
 #include <string>
+#include <vector>
+#include <utility>
 
 #ifndef DECLONE_POLYTOPE
 #define DECLONE_POLYTOPE
 
 Polytope adjpolycomputeValidAdjacencyTrees(RecTree *tree1, RecTree *tree2,  map<string, map<string,string> > & adjacencies, const std::string& gene1, const std::string& gene2);
 
+// Polytopes for a list of ancestral adjacencies (pairs of node ids), from a single 
+// propagation: for each adjacency, only the cells of the pairs of ancestors of its
+// nodes are recomputed
+void adjpolycomputeAllAdjacencies(RecTree *tree1, RecTree *tree2,  map<string, map<string,string> > & adjacencies, const vector<pair<string,string> > & queries, vector<Polytope> & results);
+
 #endif
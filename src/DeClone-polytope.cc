@@ -31,46 +31,45 @@
 #include "RecTrees.hh"
 #include "utils.hh"
 #include "ConvexPolytope.hh"
+#include "Polygon2D.hh"
+#include "PolytopeChains.hh"
+#include "TaskGraph.hh"
 //#include <fstream>
 #include <iostream>
 #include <cstdlib>
 
-#define RESULT_TYPE Polytope
-#define DIMENSION 2
-
 #define allocateMatrix allocateMatrixPolytope
 #define deleteMatrix deleteMatrixPolytope
 #define computeMatrix computeMatrixPolytope
 
-#define AdjGain Polytope(DIMENSION,adjgain)
-#define AdjBreak Polytope(DIMENSION,adjbreak)
-#define ZERO Polytope(DIMENSION,origin)
-#define INF Polytope(DIMENSION)
-#define RESCALING_FACTOR(a) ZERO 
-
-#define PLUS(a,b) minkowski_addition(a,b) 
-#define MIN(a,b,c,adj,g1,g2) convex_hull(a,b,adj)
-
+// Costs (gains, breaks) are planar: dedicated integer polygons (see Polygon2D.hh)
+#define RESULT_TYPE Polygon2D
 
-const double adjgain[] = {1.,0.};
-const double adjbreak[] = {0.,1.};
-const double origin[] = {0.,0.};
+#define AdjGain Polygon2D(1,0)
+#define AdjBreak Polygon2D(0,1)
+#define ZERO Polygon2D(0,0)
 
-//Polytope PARAMETER_POLYTOPE_OLD(const int dim,const double* point){
-//  return Polytope(dim, point);
-//}
-//
+#define INF RESULT_TYPE()
+#define RESCALING_FACTOR(a) ZERO 
 
-Polytope minkowski_addition(Polytope p1, Polytope p2)
+#define PLUS(a,b) minkowski_addition(a,b) 
+#define PLUS_CHAINS
+#define PLUS3(a,b,c) minkowskiChain<RESULT_TYPE>({a,b,c},minkowski_addition) 
+#define PLUS4(a,b,c,d) minkowskiChain<RESULT_TYPE>({a,b,c,d},minkowski_addition) 
+#define PLUS5(a,b,c,d,e) minkowskiChain<RESULT_TYPE>({a,b,c,d,e},minkowski_addition) 
+#define PLUS6(a,b,c,d,e,f) minkowskiChain<RESULT_TYPE>({a,b,c,d,e,f},minkowski_addition) 
+#define PLUS7(a,b,c,d,e,f,g) minkowskiChain<RESULT_TYPE>({a,b,c,d,e,f,g},minkowski_addition) 
+#define MIN(a,b,c,adj,g1,g2) coneConvexSum<RESULT_TYPE>(a,b)
+
+#define CELL_STORE(i,j,v1,v2,c0,c1) { applyVertexBudget(c0,adjacency_gain,adjacency_break); \
+                                      applyVertexBudget(c1,adjacency_gain,adjacency_break); \
+                                      vertexGrowth.recordCell(v1->getND(),v2->getND(),(c0).size(),(c1).size()); }
+
+RESULT_TYPE minkowski_addition(RESULT_TYPE p1, RESULT_TYPE p2)
 {
-  return p1.minkovskiSum(p2);
-}
-
-
-Polytope convex_hull(Polytope p1, \
-                     Polytope p2, \
-                     const bool adj){
-    return p1.convexSum(p2);
+  RESULT_TYPE res = p1.minkovskiSum(p2);
+  vertexGrowth.recordSum(res.size());
+  return res;
 }
 
 
@@ -79,9 +78,22 @@ Polytope convex_hull(Polytope p1, \
 
 Polytope polycomputeValidAdjacencyTrees(RecTree *tree1, RecTree *tree2,  map<string, map<string,string> > & adjacencies)
 {
-
-    return MIN(MIN(INF,computeMatrixPolytope(tree1,tree2,true, adjacencies),"Root",true,"N/A","N/A"),
-               computeMatrixPolytope(tree1,tree2,false, adjacencies),
+    RESULT_TYPE** C0 = allocateMatrixPolytope(tree1,tree2);
+    RESULT_TYPE** C1 = allocateMatrixPolytope(tree1,tree2);
+    vector<RecTree*> Dfo1 = computeDepthFirstOrder(tree1);
+    vector<RecTree*> Dfo2 = computeDepthFirstOrder(tree2);
+
+    // The report of vertex growth is only consistent when collected by a single thread
+    int nbThreads = (vertexGrowth.isEnabled()? 1 : getNbWorkerThreads());
+    runCellGraph(Dfo1, Dfo2, [&](RecTree * v1, RecTree * v2, int k)
+                 { fillMatrixCell(v1, v2, C0, C1, adjacencies); }, nbThreads);
+
+    int r1 = Dfo1.size()-1;
+    int r2 = Dfo2.size()-1;
+    RESULT_TYPE res = MIN(MIN(INF,C1[r1][r2],"Root",true,"N/A","N/A"),
+               C0[r1][r2],
   	           "Root",false,"N/A","N/A");
-
+    deleteMatrixPolytope(C0,tree1,tree2);
+    deleteMatrixPolytope(C1,tree1,tree2);
+    return res.toPolytope();
 }
@@ -0,0 +1,329 @@
+/*  DeClone: A software for computing and analyzing ancestral adjacency scenarios.
+ *  Copyright (C) 2015 Cedric Chauve, Yann Ponty, Ashok Rajaraman, Joao P.P. Zanetti
+ *
+ *  This file is part of DeClone.
+ *  
+ *  DeClone is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  DeClone is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with DeClone.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Contact: <yann.ponty@lix.polytechnique.fr>.
+ *
+ *
+ *  DeClone uses the Quickhull algorithm implementation programmed by 
+ *  Anatoly V. Tomilov. The code is available on <https://bitbucket.org/tomilov/quickhull/src/585267abb3a63794c04fc8325aa9ec9f726112ed/include/quickhull.hpp?at=master>.
+ *
+ *  Contact: <tomilovanatoliy@gmail.com>
+ */
+
+#include "DeClone-sweep.hh"
+
+#include <cfloat>
+#include <cmath>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+#include "utils.hh"
+
+bool loadSweepParameters(string path, vector<SweepParameters> & result)
+{
+     ifstream in(path.c_str());
+     if (!in.good())
+     { return false; }
+     string line;
+     while (getline(in,line))
+     {
+          istringstream fields(line);
+          SweepParameters p;
+          if ((line.size()>0) && (line[0]!='#') && (fields >> p.gain >> p.brk >> p.kT))
+          { result.push_back(p); }
+     }
+     return true;
+}
+
+// Storage of the current sweep: blocks of 2*sweepSize doubles (costs, then 
+// weights), carved from large chunks, and the free list of released blocks
+#define SWEEP_CHUNK_SIZE (1<<16)
+
+static int sweepSize = 0;
+static vector<double*> sweepChunks;
+static int sweepChunkUsed = 0;
+static int sweepChunkSize = 0;
+static vector<double*> sweepFreeBlocks;
+
+static double * sweepAllocBlock()
+{
+     if (!sweepFreeBlocks.empty())
+     {
+          double * b = sweepFreeBlocks.back();
+          sweepFreeBlocks.pop_back();
+          return b;
+     }
+     if (sweepChunks.empty() || sweepChunkUsed+2*sweepSize>sweepChunkSize)
+     {
+          sweepChunkSize = max(SWEEP_CHUNK_SIZE,2*sweepSize);
+          sweepChunks.push_back(new double[sweepChunkSize]);
+          sweepChunkUsed = 0;
+     }
+     double * b = sweepChunks.back()+sweepChunkUsed;
+     sweepChunkUsed += 2*sweepSize;
+     return b;
+}
+
+static void sweepFreeStorage()
+{
+     for (int k=0; k<sweepChunks.size(); k++)
+     { delete[] sweepChunks[k]; }
+     sweepChunks.clear();
+     sweepFreeBlocks.clear();
+     sweepChunkUsed = 0;
+     sweepChunkSize = 0;
+}
+
+SweepValue::SweepValue() : inf(true), cost(NULL), weight(NULL)
+{
+}
+
+SweepValue::SweepValue(double c, double w) : inf(false), cost(NULL), weight(NULL)
+{
+     reserve();
+     for (int k=0; k<sweepSize; k++)
+     {
+          cost[k] = c;
+          weight[k] = w;
+     }
+}
+
+SweepValue::SweepValue(const SweepValue & v) : inf(true), cost(NULL), weight(NULL)
+{
+     *this = v;
+}
+
+SweepValue::~SweepValue()
+{
+     release();
+}
+
+SweepValue & SweepValue::operator=(const SweepValue & v)
+{
+     if (this==&v)
+     { return *this; }
+     inf = v.inf;
+     if (!inf)
+     {
+          reserve();
+          copy(v.cost,v.cost+2*sweepSize,cost);
+     }
+     return *this;
+}
+
+void SweepValue::reserve()
+{
+     if (cost==NULL)
+     {
+          cost = sweepAllocBlock();
+          weight = cost+sweepSize;
+     }
+}
+
+void SweepValue::release()
+{
+     if (cost!=NULL)
+     { sweepFreeBlocks.push_back(cost); }
+     cost = NULL;
+     weight = NULL;
+     inf = true;
+}
+
+// Constants of the current sweep
+static SweepValue sweepInf;
+static SweepValue sweepZero;
+static SweepValue sweepGain;
+static SweepValue sweepBreak;
+static map<int,SweepValue> sweepRescaling;
+
+// Products are written into a ring of scratch values, which are only read 
+// by the enclosing operation of the DP expression
+#define SWEEP_SCRATCH 8
+static SweepValue sweepScratch[SWEEP_SCRATCH];
+static int sweepNextScratch = 0;
+
+static SweepValue & sweepNewScratch()
+{
+     SweepValue & r = sweepScratch[sweepNextScratch];
+     sweepNextScratch = (sweepNextScratch+1)%SWEEP_SCRATCH;
+     r.inf = false;
+     r.reserve();
+     return r;
+}
+
+// Product of a chain of k operands, each of them loaded once
+const SweepValue & sweep_chain(const SweepValue ** ops, int k)
+{
+     for (int t=0; t<k; t++)
+     {
+          if (ops[t]->isInf())
+          { return sweepInf; }
+     }
+     SweepValue & r = sweepNewScratch();
+     int n = sweepSize;
+     double * rc = r.cost;
+     double * rw = r.weight;
+     const double * ac = ops[0]->cost;
+     const double * aw = ops[0]->weight;
+     const double * bc = ops[1]->cost;
+     const double * bw = ops[1]->weight;
+     for (int p=0; p<n; p++)
+     {
+          rc[p] = ac[p]+bc[p];
+          rw[p] = aw[p]*bw[p];
+     }
+     for (int t=2; t<k; t++)
+     {
+          const double * tc = ops[t]->cost;
+          const double * tw = ops[t]->weight;
+          for (int p=0; p<n; p++)
+          {
+               rc[p] += tc[p];
+               rw[p] *= tw[p];
+          }
+     }
+     return r;
+}
+
+const SweepValue & sweep_product(const SweepValue & a, const SweepValue & b)
+{
+     const SweepValue * ops[2] = {&a,&b};
+     return sweep_chain(ops,2);
+}
+
+const SweepValue & sweep_product(const SweepValue & a, const SweepValue & b, const SweepValue & c)
+{
+     const SweepValue * ops[3] = {&a,&b,&c};
+     return sweep_chain(ops,3);
+}
+
+const SweepValue & sweep_product(const SweepValue & a, const SweepValue & b, const SweepValue & c, const SweepValue & d)
+{
+     const SweepValue * ops[4] = {&a,&b,&c,&d};
+     return sweep_chain(ops,4);
+}
+
+const SweepValue & sweep_product(const SweepValue & a, const SweepValue & b, const SweepValue & c, const SweepValue & d, const SweepValue & e)
+{
+     const SweepValue * ops[5] = {&a,&b,&c,&d,&e};
+     return sweep_chain(ops,5);
+}
+
+const SweepValue & sweep_product(const SweepValue & a, const SweepValue & b, const SweepValue & c, const SweepValue & d, const SweepValue & e, const SweepValue & f)
+{
+     const SweepValue * ops[6] = {&a,&b,&c,&d,&e,&f};
+     return sweep_chain(ops,6);
+}
+
+const SweepValue & sweep_product(const SweepValue & a, const SweepValue & b, const SweepValue & c, const SweepValue & d, const SweepValue & e, const SweepValue & f, const SweepValue & g)
+{
+     const SweepValue * ops[7] = {&a,&b,&c,&d,&e,&f,&g};
+     return sweep_chain(ops,7);
+}
+
+// a = a (+) b, in place
+SweepValue & sweep_choice(SweepValue & a, const SweepValue & b)
+{
+     if (b.isInf())
+     { return a; }
+     if (a.isInf())
+     { return (a = b); }
+     int n = sweepSize;
+     double * ac = a.cost;
+     double * aw = a.weight;
+     const double * bc = b.cost;
+     const double * bw = b.weight;
+     for (int k=0; k<n; k++)
+     {
+          ac[k] = min(ac[k],bc[k]);
+          aw[k] += bw[k];
+     }
+     return a;
+}
+
+const SweepValue & sweep_rescaling(int a)
+{
+     map<int,SweepValue>::iterator it = sweepRescaling.find(a);
+     if (it == sweepRescaling.end())
+     {
+          sweepRescaling[a] = SweepValue(0., pow(scalingFactor,a));
+          it = sweepRescaling.find(a);
+     }
+     return it->second;
+}
+
+#define RESULT_TYPE SweepValue
+#define INF sweepInf
+#define ZERO sweepZero
+#define AdjGain sweepGain
+#define AdjBreak sweepBreak
+#define PLUS(a,b) sweep_product(a,b)
+#define PLUS_CHAINS
+#define PLUS3(a,b,c) sweep_product(a,b,c)
+#define PLUS4(a,b,c,d) sweep_product(a,b,c,d)
+#define PLUS5(a,b,c,d,e) sweep_product(a,b,c,d,e)
+#define PLUS6(a,b,c,d,e,f) sweep_product(a,b,c,d,e,f)
+#define PLUS7(a,b,c,d,e,f,g) sweep_product(a,b,c,d,e,f,g)
+#define MIN(a,b,c,adj,g1,g2) sweep_choice(a,b)
+
+#define RESCALING_FACTOR(a) sweep_rescaling(a)
+
+#define allocateMatrix allocateMatrixSweep
+#define deleteMatrix deleteMatrixSweep
+#define computeMatrix computeMatrixSweep
+
+#include "DeCoDP.cc"
+
+void computeSweep(RecTree *tree1, RecTree *tree2, map<string, map<string,string> > & adjacencies, 
+                  vector<SweepParameters> & params, vector<double> & costs, vector<double> & partitionFunctions)
+{
+     int n = params.size();
+     sweepSize = n;
+     sweepZero = SweepValue(0., 1.);
+     sweepGain = SweepValue(0., 0.);
+     sweepBreak = SweepValue(0., 0.);
+     for (int k=0; k<n; k++)
+     {
+          sweepGain.cost[k] = params[k].gain;
+          sweepGain.weight[k] = exp(-params[k].gain/params[k].kT);
+          sweepBreak.cost[k] = params[k].brk;
+          sweepBreak.weight[k] = exp(-params[k].brk/params[k].kT);
+     }
+     sweepRescaling.clear();
+
+     {
+          SweepValue result = computeMatrixSweep(tree1,tree2,true, adjacencies);
+          sweep_choice(result, computeMatrixSweep(tree1,tree2,false, adjacencies));
+          costs.assign(n,DBL_MAX);
+          partitionFunctions.assign(n,0.);
+          if (!result.isInf())
+          {
+               costs.assign(result.cost,result.cost+n);
+               partitionFunctions.assign(result.weight,result.weight+n);
+          }
+     }
+
+     // Every block goes back to the free list before the storage is freed
+     sweepZero.release();
+     sweepGain.release();
+     sweepBreak.release();
+     sweepRescaling.clear();
+     for (int k=0; k<SWEEP_SCRATCH; k++)
+     { sweepScratch[k].release(); }
+     sweepFreeStorage();
+}
@@ -0,0 +1,80 @@
+/*  DeClone: A software for computing and analyzing ancestral adjacency scenarios.
+ *  Copyright (C) 2015 Cedric Chauve, Yann Ponty, Ashok Rajaraman, Joao P.P. Zanetti
+ *
+ *  This file is part of DeClone.
+ *  
+ *  DeClone is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  DeClone is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with DeClone.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Contact: <yann.ponty@lix.polytechnique.fr>.
+ *
+ *
+ *  DeClone uses the Quickhull algorithm implementation programmed by 
+ *  Anatoly V. Tomilov. The code is available on <https://bitbucket.org/tomilov/quickhull/src/585267abb3a63794c04fc8325aa9ec9f726112ed/include/quickhull.hpp?at=master>.
+ *
+ *  Contact: <tomilovanatoliy@gmail.com>
+ */
+
+#include <string>
+#include <vector>
+#include <map>
+#include "RecTrees.hh"
+
+#ifndef DECO_SWEEP_HH
+#define DECO_SWEEP_HH
+
+using namespace std;
+
+// A setting of the parameters (adjacency gain/break costs and temperature)
+struct SweepParameters{
+     double gain;
+     double brk;
+     double kT;
+};
+
+// Loads a list of parameters settings, one 'g b kT' per line. Returns false
+// if the file cannot be read.
+bool loadSweepParameters(string path, vector<SweepParameters> & result);
+
+// Values of a DP cell for a whole list of parameters settings: min. costs 
+// (parsimony) and weights (inside), for each setting, as two blocks of 
+// nbParams entries of the current sweep. Blocks all have the same size, so 
+// they are recycled through a free list instead of being allocated by each
+// semiring operation, which writes into existing blocks.
+// The INF flag stands for an impossible case, which has no block.
+class SweepValue{
+public:
+     bool inf;
+     double * cost;
+     double * weight;
+
+     SweepValue();
+     SweepValue(double c, double w);
+     SweepValue(const SweepValue & v);
+     ~SweepValue();
+     SweepValue & operator=(const SweepValue & v);
+
+     bool isInf() const
+     { return inf; }
+     // Gets a block if none yet (content undefined)
+     void reserve();
+     // Gives the block back, making the value INF
+     void release();
+};
+
+// Min. cost and partition function for each setting, computed by a single 
+// run of the DP over the product of the parsimony and inside semirings
+void computeSweep(RecTree *tree1, RecTree *tree2, map<string, map<string,string> > & adjacencies, 
+                  vector<SweepParameters> & params, vector<double> & costs, vector<double> & partitionFunctions);
+
+#endif
@@ -31,6 +31,7 @@
 #include <cstdlib>
 #include <sstream>
 #include <deque>
+#include <fstream>
 
 #include "RecTrees.hh"
 #include "AdjacencyTrees.hh"
@@ -47,11 +48,18 @@
 #include "DeClone-parsimony.hh"
 #include "DeClone-stochastic.hh"
 #include "DeClone-outside.hh"
+#include "DeClone-memo.hh"
+#include "DeClone-incremental.hh"
+#include "DeClone-sweep.hh"
+#include "MarginalsIO.hh"
 
 #ifdef USE_POLYTOPE
     #include "DeClone-polytope.hh"
     #include "DeClone-polytope-adj.hh"
     #include "ConvexPolytope.hh"
+    #include "PolytopeChains.hh"
+    #include "TaskGraph.hh"
+    #include "NormalFan.hh"
 #endif
 
 #define EXIT_SUCCESS 0
@@ -114,12 +122,48 @@
 #define ADJ_POLY_OPTION_LONG "--adjpolytope"
 #define ADJ_POLY_OPTION_SHORT "-l"
 
+#define BATCH_OPTION_LONG "--batch"
+#define BATCH_OPTION_SHORT "-B"
+
+#define SWEEP_OPTION_LONG "--sweep"
+#define SWEEP_OPTION_SHORT "-w"
+
+#define ADJ_DIFF_OPTION_LONG "--adj-diff"
+#define ADJ_DIFF_OPTION_SHORT "-D"
+
+#define EDIT_OPTION_LONG "--edit"
+#define EDIT_OPTION_SHORT "-E"
+
 //#define INTERESTING_ADJ_LONG "--adjy"
 //#define INTERESTING_ADJ_SHORT "-j"
 
 
 //// ADDITIONAL OPTIONS ////
 
+#define BINARY_OUTPUT_OPTION_LONG "--binary"
+#define BINARY_OUTPUT_OPTION_SHORT "-o"
+
+#define THRESHOLD_OPTION_LONG "--threshold"
+#define THRESHOLD_OPTION_SHORT "-th"
+
+#define READ_BINARY_OPTION_LONG "--read-binary"
+#define READ_BINARY_OPTION_SHORT "-rb"
+
+#define VERTEX_GROWTH_OPTION_LONG "--vertex-growth"
+#define VERTEX_GROWTH_OPTION_SHORT "-vg"
+
+#define CONE_OPTION_LONG "--cone"
+#define CONE_OPTION_SHORT "-cn"
+
+#define VERTEX_BUDGET_OPTION_LONG "--vertex-budget"
+#define VERTEX_BUDGET_OPTION_SHORT "-vb"
+
+#define QUERY_OPTION_LONG "--query"
+#define QUERY_OPTION_SHORT "-q"
+
+#define THREADS_OPTION_LONG "--threads"
+#define THREADS_OPTION_SHORT "-T"
+
 #define DRAW_OPTION_LONG "--draw"
 #define DRAW_OPTION_SHORT "-d"
 
@@ -127,6 +171,9 @@
 #define HELP_OPTION_LONG            "--help"
 #define HELP_OPTION_SHORT           "-h"
 
+#define NO_MEMO_OPTION_LONG "--no-memo"
+#define NO_MEMO_OPTION_SHORT "-nm"
+
 #define VERBOSE_OPTION_LONG         "--verbose"
 #define VERBOSE_OPTION_SHORT        "-v"
 
@@ -146,13 +193,16 @@ typedef enum{	PARSIMONY_MODE,
 
 void usage(string cmd){
 	cerr << "Usage: "<<cmd<<" ["<< TREE_1_OPTION_SHORT<<"|"<< TREE_1_OPTION_LONG<<"] v1 ["<< TREE_2_OPTION_SHORT<<"|"<< TREE_2_OPTION_LONG<<"] v2 ["<< ADJACENCIES_OPTION_SHORT<<"|"<< ADJACENCIES_OPTION_LONG<<"] adj [opts]"<<endl;
+	cerr << "   or: "<<cmd<<" ["<< BATCH_OPTION_SHORT<<"|"<< BATCH_OPTION_LONG<<"] pairs ["<< ADJACENCIES_OPTION_SHORT<<"|"<< ADJACENCIES_OPTION_LONG<<"] adj [-p|-z] [opts]"<<endl;
 	cerr << "Where:"<<endl;
 	cerr << "  v1  - (Path to) Gene Tree 1 (Newick format)"<<endl;
 	cerr << "  v2  - (Path to) Gene Tree 2 (Newick format)"<<endl;
-	cerr << "  adj - Path to a list of adjacent extant genes"<<endl<<endl;
+	cerr << "  adj - Path to a list of adjacent extant genes"<<endl;
+	cerr << "  pairs - Path to a list of pairs of gene trees, one pair 'v1 v2' per line"<<endl<<endl;
 	cerr << "Modes (def.=-p):"<<endl;
 	cerr << "  "<<STOC_BACKTRACK_OPTION_SHORT<<","<<STOC_BACKTRACK_OPTION_LONG<<" k   - Stochastic sampling of k adjacency trees"<<endl;
 	cerr << "  "<<COUNT_COOPTS_OPTION_SHORT<<","<<COUNT_COOPTS_OPTION_LONG<<"  - Count the number of co-optimal adjacency trees"<<endl;
+	cerr << "  "<<EDIT_OPTION_SHORT<<","<<EDIT_OPTION_LONG<<" nd s    - Replaces the subtree of v1 having id nd by s, and updates the result of -p or -z (can be repeated)"<<endl;
 	cerr << "  "<<HELP_OPTION_SHORT<<","<<HELP_OPTION_LONG<<"          - Displays help and exits"<<endl;
 	cerr << "  "<<INSIDE_OUTSIDE_OPTION_SHORT<<","<<INSIDE_OUTSIDE_OPTION_LONG<<"        - Inside-outside mode"<<endl;
   #ifdef USE_POLYTOPE
@@ -162,6 +212,7 @@ void usage(string cmd){
 	cerr << "  "<<COUNT_OPTION_SHORT<<","<<COUNT_OPTION_LONG<<"         - Count the number of valid adjacency trees"<<endl;
 	cerr << "  "<<PARSIMONY_OPTION_SHORT<<","<<PARSIMONY_OPTION_LONG<<"     - Maximum parsimony mode (def.)"<<endl;
 	cerr << "  "<<SHOW_COOPTS_OPTION_SHORT<<","<<SHOW_COOPTS_OPTION_LONG<<"   - Show all co-optimal adjacency trees"<<endl;
+	cerr << "  "<<SWEEP_OPTION_SHORT<<","<<SWEEP_OPTION_LONG<<" f      - Min. cost and partition function for each setting 'g b kT' listed in file f"<<endl;
 	cerr << "  "<<PRINT_ALL_OPTION_SHORT<<","<<PRINT_ALL_OPTION_LONG<<"           - Exhaustive enumeration of adjacency trees"<<endl;
   #ifdef USE_POLYTOPE
 	  cerr << "  "<<POLY_PROP_OPTION_SHORT<<","<<POLY_PROP_OPTION_LONG<<"      - Runs polytope propagation with gain cost and break cost as parameters"<<endl;
@@ -169,13 +220,33 @@ void usage(string cmd){
     cerr << "  " <<PARTITION_FUNCTION_OPTION_SHORT<<","<<PARTITION_FUNCTION_OPTION_LONG<<"      - Computes partition function for instance"<<endl;
 
     cerr <<endl<< "Parameters:"<<endl;
-	cerr << "  "<<DRAW_OPTION_SHORT<<","<<DRAW_OPTION_LONG<<" f        - Draws output to file f (mode-dependent)"<<endl;
+	cerr << "  "<<ADJ_DIFF_OPTION_SHORT<<","<<ADJ_DIFF_OPTION_LONG<<" f    - Outputs the result of -p, -z or -i after applying the adjacency diff f ('+ g1 g2' or '- g1 g2' per line)"<<endl;
+	cerr << "  "<<BINARY_OUTPUT_OPTION_SHORT<<","<<BINARY_OUTPUT_OPTION_LONG<<" f      - Writes the probabilities of -i to binary file f, instead of a matrix"<<endl;
+  #ifdef USE_POLYTOPE
+	  cerr << "  "<<CONE_OPTION_SHORT<<","<<CONE_OPTION_LONG<<" g1 b1 g2 b2 - Only keeps the vertices of minimal cost for some costs in the cone spanned by (g1,b1) and (g2,b2) (-y, -l)"<<endl;
+  #endif
+	cerr << "  "<<DRAW_OPTION_SHORT<<","<<DRAW_OPTION_LONG<<" f        - Draws output to file f (mode-dependent, raster image of at most 4096x4096 pixels if f ends with .ppm)"<<endl;
 	cerr << "  "<<SET_BOLTZMANN_OPTION_SHORT<<" val            - Sets Boltzmann 'constant' (i.e. temperature) to a given value (def.=1.0)"<<endl;
 	cerr << "  "<<OUTPUT_MATRIX_SHORT<<","<<OUTPUT_MATRIX_LONG<<"        - Outputs a matrix for the adjacency tree (only for -s and -b modes)"<<endl;
+  #ifdef USE_POLYTOPE
+	  cerr << "  "<<QUERY_OPTION_SHORT<<","<<QUERY_OPTION_LONG<<" f       - Outputs the optimal vertex of the polytope for each cost vector of file f (-y, -l)"<<endl;
+  #endif
+	cerr << "  "<<READ_BINARY_OPTION_SHORT<<","<<READ_BINARY_OPTION_LONG<<" f - Outputs the content of binary file f (see "<<BINARY_OUTPUT_OPTION_SHORT<<") as text, and exits"<<endl;
 	cerr << "  "<<RESCALING_OPTION_SHORT<<","<<RESCALING_OPTION_LONG<<" val   - Sets rescaling factor (def.=1.0)"<<endl;
+	cerr << "  "<<NO_MEMO_OPTION_SHORT<<","<<NO_MEMO_OPTION_LONG<<"      - Disables the reuse of subtree pairs across the pairs of a batch"<<endl;
 	cerr << "  "<<SCORING_SCHEME_SHORT<<","<<SCORING_SCHEME_LONG<<" g b    - Sets costs for adjacency gains (g) and breaks (b) (def.=(1.0,1.0))"<<endl;
 	
+  #ifdef USE_POLYTOPE
+	  cerr << "  "<<THREADS_OPTION_SHORT<<","<<THREADS_OPTION_LONG<<" n     - Number of threads of the polytope propagation (-y, -l) (def.=number of cores)"<<endl;
+  #endif
+	cerr << "  "<<THRESHOLD_OPTION_SHORT<<","<<THRESHOLD_OPTION_LONG<<" val - Only writes probabilities above val to binary file or dot plot (def.=0.0)"<<endl;
+  #ifdef USE_POLYTOPE
+	  cerr << "  "<<VERTEX_GROWTH_OPTION_SHORT<<","<<VERTEX_GROWTH_OPTION_LONG<<" f - Reports the number of vertices of the polytopes of each cell (-y, -l) to file f"<<endl;
+  #endif
 	cerr << "  "<<VERBOSE_OPTION_SHORT<<","<<VERBOSE_OPTION_LONG<<"       - Verbose mode, provides more (possibly unnecessary) information"<<endl;
+  #ifdef USE_POLYTOPE
+	  cerr << "  "<<VERTEX_BUDGET_OPTION_SHORT<<","<<VERTEX_BUDGET_OPTION_LONG<<" k - Approximate propagation, keeping about k vertices per polytope (-y, -l)"<<endl;
+  #endif
 }
 
 
@@ -226,6 +297,280 @@ void showAdjacencies(std::map<string, map<string,string> > adjacencies)
 
 
 
+// Outputs the extant adjacencies, followed by the matrix of probabilities of 
+// ancestral adjacencies (inside-outside mode)
+void printMarginals(RecTree * v1, RecTree * v2, vector<RecTree*> & Dfo1, vector<RecTree*> & Dfo2, double*** W, double Z, map<string, map<string,string> > & adjacencies, string drawOutput, double threshold, bool verbose)
+{
+  for(int i=0;i<Dfo1.size();i++)
+  {
+    if(Dfo1[i]->isLeaf()){
+      string firstgene = Dfo1[i]->getGeneName();
+      std::map<string,map<string,string> >::iterator it1 = adjacencies.find(firstgene);
+      if (it1 == adjacencies.end())
+      { continue; }
+      for(std::map<string,string>::iterator it2=it1->second.begin(); it2 != it1->second.end();it2++)
+      {
+        for(int j =0;j<Dfo2.size();j++){
+          if(Dfo2[j]->isLeaf() and it2->first == Dfo2[j]->getGeneName()){
+            cout<< "> "<<it1->first<<" "<<it2->first<<" "<<Dfo1[i]->getND()<<" "<<Dfo2[j]->getND()<<endl;
+          }
+        }
+      }
+    }
+  }
+  cout<< endl;
+
+  double** probas = new double*[Dfo1.size()];
+  for(int i =0;i<Dfo1.size();i++)
+  {
+    probas[i] = new double[Dfo2.size()];
+  }
+  vector<CaseLabel> c1Lbls =  C1Labels();
+  cout << "\t";
+  for (int j = 0; j < Dfo2.size(); j++)
+  {
+    cout << Dfo2[j]->getND() << " ";
+  }
+  cout << endl;
+  for (int i = 0; i < Dfo1.size(); i++)
+  {
+    cout << Dfo1[i]->getND() << "\t";
+    for (int j = 0; j < Dfo2.size(); j++)
+    {
+      double c1Weight = 0.0;
+      for (int k = 0; k < c1Lbls.size(); k++)
+      {
+        c1Weight +=  W[Dfo1[i]->getIndex()][Dfo2[j]->getIndex()][c1Lbls[k]];
+      }
+      cout << c1Weight / Z << " ";
+      probas[Dfo1[i]->getIndex()][Dfo2[j]->getIndex()] = c1Weight/Z;
+    }
+    cout << endl;
+  }
+  if (drawOutput.length()!=0)
+  {  
+    if (verbose)
+    {
+      cerr << "Drawing dot plot to '"<<drawOutput<<"'"<<endl;
+    }
+    drawProbas(v1,v2,probas,drawOutput,threshold);
+  }
+}
+
+// Outputs the probabilities of ancestral adjacencies, either as text or to a binary file
+int outputMarginals(RecTree * v1, RecTree * v2, vector<RecTree*> & Dfo1, vector<RecTree*> & Dfo2, double*** W, double Z, map<string, map<string,string> > & adjacencies, string drawOutput, string binaryOutput, double threshold, bool verbose)
+{
+  if (binaryOutput.length()==0)
+  {
+    printMarginals(v1, v2, Dfo1, Dfo2, W, Z, adjacencies, drawOutput, threshold, verbose);
+    return EXIT_SUCCESS;
+  }
+  int n = writeMarginals(binaryOutput, Dfo1, Dfo2, W, Z, threshold);
+  if (n<0)
+  {
+    cerr << "Error: Cannot write to '"<<binaryOutput<<"'"<<endl;
+    return EXIT_FAILURE;
+  }
+  if (verbose)
+  {
+    cerr << n << " probabilities written to '"<<binaryOutput<<"'"<<endl;
+  }
+  return EXIT_SUCCESS;
+}
+
+// Outputs the min. cost and partition function of a pair of trees for each setting
+// of the parameters, prefixed by a given string
+void printSweep(RecTree * v1, RecTree * v2, map<string, map<string,string> > & adjacencies, vector<SweepParameters> & params, string prefix)
+{
+  vector<double> costs;
+  vector<double> partitionFunctions;
+  computeSweep(v1, v2, adjacencies, params, costs, partitionFunctions);
+  for (int k=0; k<params.size(); k++)
+  {
+    cout << prefix << params[k].gain << "\t" << params[k].brk << "\t" << params[k].kT << "\t" << costs[k] << "\t" << partitionFunctions[k] << endl;
+  }
+}
+
+#ifdef USE_POLYTOPE
+// Outputs the optimal vertex of a polytope for each cost vector, through 
+// point location in its normal fan
+void printOptimalVertices(const Polytope & p, vector<vector<double> > & costVectors)
+{
+  NormalFan fan(p);
+  cout << "Optimal vertices: "<<endl<<"{"<<endl;
+  for (int k=0; k<costVectors.size(); k++)
+  {
+    point_type vertex;
+    double cost;
+    cout << "  {";
+    for (int i=0; i<costVectors[k].size(); i++)
+    {
+      cout << (i>0?",":"") << costVectors[k][i];
+    }
+    cout << "} -> ";
+    if (fan.optimalVertex(costVectors[k], vertex, cost))
+    {
+      cout << "{";
+      for (int i=0; i<vertex.size(); i++)
+      {
+        cout << (i>0?",":"") << vertex[i];
+      }
+      cout << "} (" << cost << ")";
+    }
+    else
+    {
+      cout << "{}";
+    }
+    if (k<costVectors.size()-1) cout << "," ;
+    cout << endl;
+  }
+  cout << "}";
+}
+#endif
+
+// Runs the parsimony (-p) or partition function (-z) DP over each pair of trees
+// listed in a file, reusing the values of identical pairs of subtrees
+// If a diff of adjacencies is given, only the pairs touched by the diff are output, 
+// along with their results before and after the diff
+int runBatch(string path, RunMode mode, map<string, map<string,string> > & adjacencies, AdjacencyDiff * diff, vector<SweepParameters> * sweep, bool useMemo, bool verbose)
+{
+  if ((mode!=PARSIMONY_MODE) && (mode!=PARTITION_FUNCTION_MODE) && (sweep==NULL))
+  {
+    cerr << "Error: Option ["<<BATCH_OPTION_SHORT<<"|" << BATCH_OPTION_LONG<< "] is only available in modes "<<PARSIMONY_OPTION_SHORT<<" and "<<PARTITION_FUNCTION_OPTION_SHORT<<endl;
+    return EXIT_FAILURE;
+  }
+  ifstream in(path.c_str());
+  if (!in.good())
+  {
+    cerr << "Error: Cannot open list of pairs '"<<path<<"'"<<endl;
+    return EXIT_FAILURE;
+  }
+  subtreeCacheEnabled = useMemo;
+  cout.precision(10);
+  string line;
+  while (getline(in,line))
+  {
+    istringstream fields(line);
+    string path1, path2;
+    if (!(fields >> path1 >> path2) || (path1[0]=='#'))
+    { continue; }
+    RecTree * t1 = parseNewickRecTree(path1);
+    RecTree * t2 = parseNewickRecTree(path2);
+    if (diff!=NULL)
+    {
+      if (adjacencyDiffTouches(t1,t2,*diff))
+      {
+        IncrementalDeClone engine(t1, t2, adjacencies, (mode==PARSIMONY_MODE)? INCREMENTAL_PARSIMONY : INCREMENTAL_INSIDE, kT);
+        double before = engine.getResult();
+        engine.applyAdjacencyDiff(*diff);
+        cout << path1 << "\t" << path2 << "\t" << before << "\t" << engine.getResult() << endl;
+        t1 = engine.getTree1();
+      }
+      delete t1;
+      delete t2;
+      continue;
+    }
+    if (sweep!=NULL)
+    {
+      printSweep(t1, t2, adjacencies, *sweep, path1+"\t"+path2+"\t");
+      delete t1;
+      delete t2;
+      continue;
+    }
+    double result;
+    if (mode==PARSIMONY_MODE)
+    { result = computeMaxParsimony(t1,t2,adjacencies); }
+    else
+    { result = computeInside(t1,t2,adjacencies,kT); }
+    cout << path1 << "\t" << path2 << "\t" << result << endl;
+    delete t1;
+    delete t2;
+  }
+  if (verbose)
+  {
+    SubtreePairCache & cache = (mode==PARSIMONY_MODE)? getParsimonyCache() : getInsideCache();
+    cerr << "Subtree cache: "<<cache.getHits()<<" hits, "<<cache.getMisses()<<" misses, "<<cache.size()<<" entries"<<endl;
+  }
+  subtreeCacheEnabled = false;
+  return EXIT_SUCCESS;
+}
+
+// Applies a list of subtree replacements to the first tree, and outputs the result
+// of the parsimony (-p) or partition function (-z) DP before and after each of them
+int runEdits(RecTree * v1, RecTree * v2, vector<pair<string,string> > & edits, RunMode mode, map<string, map<string,string> > & adjacencies, bool verbose)
+{
+  if ((mode!=PARSIMONY_MODE) && (mode!=PARTITION_FUNCTION_MODE))
+  {
+    cerr << "Error: Option ["<<EDIT_OPTION_SHORT<<"|" << EDIT_OPTION_LONG<< "] is only available in modes "<<PARSIMONY_OPTION_SHORT<<" and "<<PARTITION_FUNCTION_OPTION_SHORT<<endl;
+    return EXIT_FAILURE;
+  }
+  cout.precision(10);
+  IncrementalDeClone engine(v1, v2, adjacencies, (mode==PARSIMONY_MODE)? INCREMENTAL_PARSIMONY : INCREMENTAL_INSIDE, kT);
+  cout << engine.getResult() << endl;
+  for (int i=0; i<edits.size(); i++)
+  {
+    RecTree * old = engine.findNode(edits[i].first);
+    if (old==NULL)
+    {
+      cerr << "Error: No node with id "<<edits[i].first<<" in first tree"<<endl;
+      return EXIT_FAILURE;
+    }
+    long before = engine.getRowsComputed();
+    engine.replaceSubtree(old, parseNewickRecTree(edits[i].second));
+    cout << engine.getResult() << endl;
+    if (verbose)
+    {
+      cerr << "Edit "<<edits[i].first<<": "<<(engine.getRowsComputed()-before)<<" rows recomputed"<<endl;
+    }
+  }
+  return EXIT_SUCCESS;
+}
+
+// Outputs the result of the parsimony (-p) or partition function (-z) DP before 
+// and after applying a diff to the adjacencies, or the probabilities of ancestral 
+// adjacencies after the diff (-i)
+int runAdjacencyDiff(RecTree * v1, RecTree * v2, AdjacencyDiff & diff, RunMode mode, map<string, map<string,string> > & adjacencies, string drawOutput, string binaryOutput, double threshold, bool verbose)
+{
+  if ((mode!=PARSIMONY_MODE) && (mode!=PARTITION_FUNCTION_MODE) && (mode!=INSIDE_OUTSIDE_MODE))
+  {
+    cerr << "Error: Option ["<<ADJ_DIFF_OPTION_SHORT<<"|" << ADJ_DIFF_OPTION_LONG<< "] is only available in modes "<<PARSIMONY_OPTION_SHORT<<", "<<PARTITION_FUNCTION_OPTION_SHORT<<" and "<<INSIDE_OUTSIDE_OPTION_SHORT<<endl;
+    return EXIT_FAILURE;
+  }
+  cout.precision(10);
+  IncrementalDeClone engine(v1, v2, adjacencies, (mode==PARSIMONY_MODE)? INCREMENTAL_PARSIMONY : INCREMENTAL_INSIDE, kT);
+  if (mode!=INSIDE_OUTSIDE_MODE)
+  {
+    cout << engine.getResult() << endl;
+  }
+  long before = engine.getRowsComputed();
+  engine.applyAdjacencyDiff(diff);
+  if (verbose)
+  {
+    cerr << "Adjacency diff: "<<(engine.getRowsComputed()-before)<<" rows updated"<<endl;
+  }
+  if (mode!=INSIDE_OUTSIDE_MODE)
+  {
+    cout << engine.getResult() << endl;
+  }
+  else
+  {
+    for(int k=0; k<diff.removed.size(); k++)
+    {
+      adjacencies[diff.removed[k].first].erase(diff.removed[k].second);
+      adjacencies[diff.removed[k].second].erase(diff.removed[k].first);
+    }
+    for(int k=0; k<diff.added.size(); k++)
+    {
+      adjacencies[diff.added[k].first][diff.added[k].second] = "";
+    }
+    vector<RecTree*> Dfo1;
+    vector<RecTree*> Dfo2;
+    double*** W = engine.computeWeights(Dfo1, Dfo2);
+    return outputMarginals(v1, v2, Dfo1, Dfo2, W, engine.getResult(), adjacencies, drawOutput, binaryOutput, threshold, verbose);
+  }
+  return EXIT_SUCCESS;
+}
+
 int main(int argc, char *argv[])
 {  
   if (argc>1)
@@ -235,6 +580,15 @@ int main(int argc, char *argv[])
     string gene1 = "";
     string gene2 = "";
     string drawOutput = "";
+    string batchFile = "";
+    bool useMemo = true;
+    vector<pair<string,string> > edits;
+    string adjDiffFile = "";
+    string sweepFile = "";
+    string binaryOutput = "";
+    string growthOutput = "";
+    string queryFile = "";
+    double threshold = 0.;
     map<string, map<string,string> > adjacencies ;
     map<string, map<string,string> > interesting_adjacencies ;
     RunMode mode = PARSIMONY_MODE;
@@ -381,6 +735,106 @@ int main(int argc, char *argv[])
   		{
   			verbose = true;
   		}
+      else if (opt==BATCH_OPTION_SHORT  || opt==BATCH_OPTION_LONG)
+  		{
+  			ensureNextParamAvail(opt, "list of pairs", i, argc,argv);
+  			i++;
+  			batchFile = string(argv[i]);
+  		}
+      else if (opt==BINARY_OUTPUT_OPTION_SHORT  || opt==BINARY_OUTPUT_OPTION_LONG)
+  		{
+  			ensureNextParamAvail(opt, "output file name", i, argc,argv);
+  			i++;
+  			binaryOutput = string(argv[i]);
+  		}
+      else if (opt==THRESHOLD_OPTION_SHORT  || opt==THRESHOLD_OPTION_LONG)
+  		{
+  			ensureNextParamAvail(opt, "threshold", i, argc,argv);
+  			i++;
+  			convertToDouble(string(argv[i]), threshold);
+  		}
+      else if (opt==READ_BINARY_OPTION_SHORT  || opt==READ_BINARY_OPTION_LONG)
+  		{
+  			ensureNextParamAvail(opt, "binary file", i, argc,argv);
+  			i++;
+  			cout.precision(10);
+  			if (!dumpMarginals(string(argv[i]), cout))
+  			{
+  				cerr << "Error: Cannot read binary file '"<<argv[i]<<"'"<<endl;
+  				return EXIT_FAILURE;
+  			}
+  			return EXIT_SUCCESS;
+  		}
+      else if (opt==SWEEP_OPTION_SHORT  || opt==SWEEP_OPTION_LONG)
+  		{
+  			ensureNextParamAvail(opt, "parameters file", i, argc,argv);
+  			i++;
+  			sweepFile = string(argv[i]);
+  		}
+      else if (opt==ADJ_DIFF_OPTION_SHORT  || opt==ADJ_DIFF_OPTION_LONG)
+  		{
+  			ensureNextParamAvail(opt, "adjacency diff file", i, argc,argv);
+  			i++;
+  			adjDiffFile = string(argv[i]);
+  		}
+      else if (opt==EDIT_OPTION_SHORT  || opt==EDIT_OPTION_LONG)
+  		{
+  			ensureNextParamAvail(opt, "node id", i, argc,argv);
+  			i++;
+  			string nd(argv[i]);
+  			ensureNextParamAvail(opt, "new subtree", i, argc,argv);
+  			i++;
+  			edits.push_back(pair<string,string>(nd,string(argv[i])));
+  		}
+      else if (opt==THREADS_OPTION_SHORT  || opt==THREADS_OPTION_LONG)
+  		{
+  			ensureNextParamAvail(opt, "number of threads", i, argc,argv);
+  			i++;
+  #ifdef USE_POLYTOPE
+  			nbWorkerThreads = atoi(argv[i]);
+  #endif
+  		}
+      else if (opt==CONE_OPTION_SHORT  || opt==CONE_OPTION_LONG)
+  		{
+  			double cone[4];
+  			for (int k=0;k<4;k++)
+  			{
+  				ensureNextParamAvail(opt, "cone direction", i, argc,argv);
+  				i++;
+  				convertToDouble(argv[i],cone[k]);
+  			}
+  #ifdef USE_POLYTOPE
+  			costCone.enabled = true;
+  			costCone.g1 = cone[0];
+  			costCone.b1 = cone[1];
+  			costCone.g2 = cone[2];
+  			costCone.b2 = cone[3];
+  #endif
+  		}
+      else if (opt==VERTEX_BUDGET_OPTION_SHORT  || opt==VERTEX_BUDGET_OPTION_LONG)
+  		{
+  			ensureNextParamAvail(opt, "number of vertices", i, argc,argv);
+  			i++;
+  #ifdef USE_POLYTOPE
+  			vertexBudget = atoi(argv[i]);
+  #endif
+  		}
+      else if (opt==QUERY_OPTION_SHORT  || opt==QUERY_OPTION_LONG)
+  		{
+  			ensureNextParamAvail(opt, "cost vectors file", i, argc,argv);
+  			i++;
+  			queryFile = string(argv[i]);
+  		}
+      else if (opt==VERTEX_GROWTH_OPTION_SHORT  || opt==VERTEX_GROWTH_OPTION_LONG)
+  		{
+  			ensureNextParamAvail(opt, "report file", i, argc,argv);
+  			i++;
+  			growthOutput = string(argv[i]);
+  		}
+      else if (opt==NO_MEMO_OPTION_SHORT  || opt==NO_MEMO_OPTION_LONG)
+  		{
+  			useMemo = false;
+  		}
       else if (opt==OUTPUT_MATRIX_SHORT  || opt==OUTPUT_MATRIX_LONG)
   		{
   			output_matrix = true;
@@ -402,6 +856,30 @@ int main(int argc, char *argv[])
   			}
   		}	 
     }
+    AdjacencyDiff diff;
+    if (adjDiffFile.length()!=0)
+    {
+      diff = loadAdjacencyDiff(adjDiffFile);
+    }
+    vector<SweepParameters> sweep;
+    if (sweepFile.length()!=0)
+    {
+      if (!loadSweepParameters(sweepFile, sweep))
+      {
+        cerr << "Error: Cannot open parameters file '"<<sweepFile<<"'"<<endl;
+        return EXIT_FAILURE;
+      }
+      if (sweep.empty())
+      {
+        cerr << "Error: No 'g b kT' parameters setting in '"<<sweepFile<<"'"<<endl;
+        return EXIT_FAILURE;
+      }
+      cout.precision(10);
+    }
+    if (batchFile.length()!=0)
+    {
+      return runBatch(batchFile, mode, adjacencies, (adjDiffFile.length()!=0)? &diff : NULL, (sweepFile.length()!=0)? &sweep : NULL, useMemo, verbose);
+    }
     if (v1!=NULL && v2!=NULL )
     {
     	if (verbose)
@@ -420,6 +898,40 @@ int main(int argc, char *argv[])
         cerr.flush();
     	}
     
+	if (edits.size()>0)
+	{
+	  return runEdits(v1, v2, edits, mode, adjacencies, verbose);
+	}
+	if (adjDiffFile.length()!=0)
+	{
+	  return runAdjacencyDiff(v1, v2, diff, mode, adjacencies, drawOutput, binaryOutput, threshold, verbose);
+	}
+	if (sweepFile.length()!=0)
+	{
+	  printSweep(v1, v2, adjacencies, sweep, "");
+	  return EXIT_SUCCESS;
+	}
+  #ifdef USE_POLYTOPE
+	if ((growthOutput.length()!=0) && !vertexGrowth.open(growthOutput))
+	{
+	  cerr << "Error: Cannot write to '"<<growthOutput<<"'"<<endl;
+	  return EXIT_FAILURE;
+	}
+	vector<vector<double> > costVectors;
+	if (queryFile.length()!=0)
+	{
+	  if (!loadCostVectors(queryFile, costVectors))
+	  {
+	    cerr << "Error: Cannot open query file '"<<queryFile<<"'"<<endl;
+	    return EXIT_FAILURE;
+	  }
+	  if (costVectors.empty())
+	  {
+	    cerr << "Error: No cost vector in query file '"<<queryFile<<"'"<<endl;
+	    return EXIT_FAILURE;
+	  }
+	}
+  #endif
 	cout.precision(10);
     	switch(mode)
 	{
@@ -499,63 +1011,10 @@ int main(int argc, char *argv[])
 
 	     vector<RecTree*> Dfo1 = computeDepthFirstOrder(v1);
 	     vector<RecTree*> Dfo2 = computeDepthFirstOrder(v2);
-///////////////////////////////////////////////////////////////////
-//   
-         for(int i=0;i<Dfo1.size();i++)
-         {
-            if(Dfo1[i]->isLeaf()){
-               string firstgene = Dfo1[i]->getGeneName();
-               std::map<string,map<string,string> >::iterator it1 = adjacencies.find(firstgene);
-               for(std::map<string,string>::iterator it2=it1->second.begin(); it2 != it1->second.end();it2++)
-               {
-                    for(int j =0;j<Dfo2.size();j++){
-                        if(Dfo2[j]->isLeaf() and it2->first == Dfo2[j]->getGeneName()){
-                            cout<< "> "<<it1->first<<" "<<it2->first<<" "<<Dfo1[i]->getND()<<" "<<Dfo2[j]->getND()<<endl;
-                        }
-                    }
-               }
-            }
-         }
-         cout<< endl;
-//
-//////////////////////////////////////////////////////////////////
-
-	     double** probas = new double*[Dfo1.size()];
-	     for(int i =0;i<Dfo1.size();i++)
+	     if (outputMarginals(v1, v2, Dfo1, Dfo2, W, Z, adjacencies, drawOutput, binaryOutput, threshold, verbose)!=EXIT_SUCCESS)
 	     {
-		  probas[i] = new double[Dfo2.size()];
+	       return EXIT_FAILURE;
 	     }
-	     vector<CaseLabel> c1Lbls =  C1Labels();
-	     cout << "\t";
-	     for (int j = 0; j < Dfo2.size(); j++)
-	     {
-		  cout << Dfo2[j]->getND() << " ";
-	     }
-		       cout << endl;
-	     for (int i = 0; i < Dfo1.size(); i++)
-	     {
-		  cout << Dfo1[i]->getND() << "\t";
-	     	  for (int j = 0; j < Dfo2.size(); j++)
-	     	  {
-		       double c1Weight = 0.0;
-	     	       //cout << i << " " << j << " --- ";
-	     	       for (int k = 0; k < c1Lbls.size(); k++)
-	     	       {
-	     		    c1Weight +=  W[Dfo1[i]->getIndex()][Dfo2[j]->getIndex()][c1Lbls[k]];
-	     	       }
-		       cout << c1Weight / Z << " ";
-		       probas[Dfo1[i]->getIndex()][Dfo2[j]->getIndex()] = c1Weight/Z;
-	     	  }
-			    cout << endl;
-	     }
-	     if (drawOutput.length()!=0)
-	     {  
-          if (verbose)
-          {
-            cerr << "Drawing dot plot to '"<<drawOutput<<"'"<<endl;
-          }
-          drawProbasSVG(v1,v2,probas,drawOutput);
-       }
 	     // vector<RecTree*> Dfo1 = computeDepthFirstOrder(v1);
 	     // vector<RecTree*> Dfo2 = computeDepthFirstOrder(v2);
 	     // double total_weight = 0.;
@@ -585,7 +1044,12 @@ int main(int argc, char *argv[])
         { 
         #ifdef USE_POLYTOPE
           Polytope p = polycomputeValidAdjacencyTrees(v1, v2, adjacencies);
+          vertexGrowth.close();
           cout << "Polygon: "<< p << endl;
+          if (vertexBudget>0)
+          {
+            cout << "Hausdorff error bound: "<< p.getError() << endl;
+          }
           vector<NormalVector> normals = p.normalVectors();
           cout << "Normals (+Signatures): "<<endl<<"{"<<endl;
           for (int i=0;i<normals.size();i++)
@@ -596,6 +1060,11 @@ int main(int argc, char *argv[])
             cout << endl;
           } 
           cout << "}";
+          if (costVectors.size()>0)
+          {
+            cout << endl;
+            printOptimalVertices(p, costVectors);
+          }
         #endif
         #ifndef USE_POLYTOPE
           cerr << "Error : Option ["<<POLY_PROP_OPTION_SHORT<<"|" << POLY_PROP_OPTION_LONG<< "] not-available with current compilation mode."<<endl<<"Please recompile using one of the 'Polytope-aware' compilation targets."<<endl;
@@ -607,15 +1076,25 @@ int main(int argc, char *argv[])
         case ADJ_POLY_MODE:
         {
         #ifdef USE_POLYTOPE
+        vector<pair<string,string> > queries;
         for(std::map<string, map<string,string> >::iterator iter = interesting_adjacencies.begin(); iter != interesting_adjacencies.end(); ++iter)
     		{
-          string a = iter->first;
           for(std::map<string,string>::iterator iter2 = iter->second.begin(); iter2 != iter->second.end(); ++iter2)
       		{
-            string b = iter2->first;
-            cout << "Adjacency: "<< a<<","<<b<< endl;
-            Polytope p = adjpolycomputeValidAdjacencyTrees(v1, v2,  adjacencies, a, b);
+            queries.push_back(pair<string,string>(iter->first,iter2->first));
+          }
+        }
+        vector<Polytope> polytopes;
+        adjpolycomputeAllAdjacencies(v1, v2, adjacencies, queries, polytopes);
+        for (int k=0;k<queries.size();k++)
+        {
+            cout << "Adjacency: "<< queries[k].first<<","<<queries[k].second<< endl;
+            Polytope & p = polytopes[k];
             cout << "Polygon: "<< p << endl;
+            if (vertexBudget>0)
+            {
+              cout << "Hausdorff error bound: "<< p.getError() << endl;
+            }
             vector<NormalVector> normals = p.normalVectors();
             cout << "Normals (+Signatures): "<<endl<<"{"<<endl;
             for (int i=0;i<normals.size();i++)
@@ -626,9 +1105,14 @@ int main(int argc, char *argv[])
               cout << endl;
             } 
             cout << "}" << endl;
+            if (costVectors.size()>0)
+            {
+              printOptimalVertices(p, costVectors);
+              cout << endl;
+            }
             cout << "----------------"<< endl;
-          }
         }
+        vertexGrowth.close();
         #endif
         #ifndef USE_POLYTOPE
           cerr << "Error : Option ["<<ADJ_POLY_OPTION_SHORT<<"|" << ADJ_POLY_OPTION_LONG<< "] not-available with current compilation mode."<<endl<<"Please recompile using one of the 'Polytope-aware' compilation targets."<<endl;
@@ -0,0 +1,254 @@
+/*  DeClone: A software for computing and analyzing ancestral adjacency scenarios.
+ *  Copyright (C) 2015 Cedric Chauve, Yann Ponty, Ashok Rajaraman, Joao P.P. Zanetti
+ *
+ *  This file is part of DeClone.
+ *  
+ *  DeClone is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  DeClone is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with DeClone.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Contact: <yann.ponty@lix.polytechnique.fr>.
+ *
+ *
+ *  DeClone uses the Quickhull algorithm implementation programmed by 
+ *  Anatoly V. Tomilov. The code is available on <https://bitbucket.org/tomilov/quickhull/src/585267abb3a63794c04fc8325aa9ec9f726112ed/include/quickhull.hpp?at=master>.
+ *
+ *  Contact: <tomilovanatoliy@gmail.com>
+ */
+
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <vector>
+#include <map>
+
+#include "Trees.hh"
+#include "EditTrees.hh"
+#include "RecTrees.hh"
+#include "DPParsimony.hh"
+#include "DPStochasticBacktrack.hh"
+#include "DeClone-parsimony.hh"
+#include "DeClone-inside.hh"
+#include "utils.hh"
+
+// Reconciles two gene families against a species tree, and runs the adjacency 
+// DP of DeClone on the resulting reconciled trees, which are handed over in 
+// memory (no intermediate NHX file).
+
+#define GENE_1_OPTION_LONG          "--gene1"
+#define GENE_1_OPTION_SHORT         "-g1"
+#define GENE_2_OPTION_LONG          "--gene2"
+#define GENE_2_OPTION_SHORT         "-g2"
+#define SPECIES_TREE_OPTION_LONG    "--species"
+#define SPECIES_TREE_OPTION_SHORT   "-s"
+#define ADJACENCIES_OPTION_LONG     "--adjacencies"
+#define ADJACENCIES_OPTION_SHORT    "-a"
+#define SCORING_SCHEME_LONG         "--score"
+#define SCORING_SCHEME_SHORT        "-sc"
+#define SET_BOLTZMANN_OPTION_SHORT  "-kT"
+#define PARSIMONY_OPTION_LONG       "--parsimony"
+#define PARSIMONY_OPTION_SHORT      "-p"
+#define PARTITION_FUNCTION_OPTION_LONG    "--part-fun"
+#define PARTITION_FUNCTION_OPTION_SHORT   "-z"
+#define STOC_BACKTRACK_OPTION_LONG  "--backtrack"
+#define STOC_BACKTRACK_OPTION_SHORT "-b"
+#define HELP_OPTION_LONG            "--help"
+#define HELP_OPTION_SHORT           "-h"
+#define VERBOSE_OPTION_LONG         "--verbose"
+#define VERBOSE_OPTION_SHORT        "-v"
+
+using namespace std;
+
+void usage(string cmd){
+	cerr << "Usage: "<<cmd<<" ["<< GENE_1_OPTION_SHORT<<"|"<< GENE_1_OPTION_LONG<<"] tg1 ["<< GENE_2_OPTION_SHORT<<"|"<< GENE_2_OPTION_LONG<<"] tg2 ["<< SPECIES_TREE_OPTION_SHORT<<"|"<< SPECIES_TREE_OPTION_LONG<<"] ts ["<< ADJACENCIES_OPTION_SHORT<<"|"<< ADJACENCIES_OPTION_LONG<<"] adj [opts]"<<endl;
+	cerr << "Where:"<<endl;
+	cerr << "  tg1 - (Path to) Gene Tree 1 (Newick format)"<<endl;
+	cerr << "  tg2 - (Path to) Gene Tree 2 (Newick format)"<<endl;
+	cerr << "  ts  - (Path to) Species Tree (Newick format)"<<endl;
+	cerr << "  adj - Path to a list of adjacent extant genes"<<endl;
+	cerr << "Options:"<<endl;
+	cerr << "  "<<PARSIMONY_OPTION_SHORT<<","<<PARSIMONY_OPTION_LONG<<"     - Min. cost of adjacency trees (def.)"<<endl;
+	cerr << "  "<<PARTITION_FUNCTION_OPTION_SHORT<<","<<PARTITION_FUNCTION_OPTION_LONG<<"      - Partition function of adjacency trees"<<endl;
+	cerr << "  "<<STOC_BACKTRACK_OPTION_SHORT<<","<<STOC_BACKTRACK_OPTION_LONG<<" k   - Samples k reconciliations of each gene tree (Boltzmann distr.), and outputs"<<endl;
+	cerr << "                    the result for each pair of samples (def.=max. parsimony reconciliations)"<<endl;
+	cerr << "  "<<SCORING_SCHEME_SHORT<<","<<SCORING_SCHEME_LONG<<" g b    - Sets costs for adjacency gains (g) and breaks (b) (def.=(1.0,1.0))"<<endl;
+	cerr << "  "<<SET_BOLTZMANN_OPTION_SHORT<<" val        - Sets Boltzmann 'constant', for reconciliations and adjacencies (def.=1.0)"<<endl;
+	cerr << "  "<<VERBOSE_OPTION_SHORT<<","<<VERBOSE_OPTION_LONG<<"       - Prints the reconciled gene trees (NHX) to stderr"<<endl;
+	cerr << "  "<<HELP_OPTION_SHORT<<","<<HELP_OPTION_LONG<<"          - Displays help and exits"<<endl;
+}
+
+void ensureNextParamAvail(string opt, string param, int curr, int argc, char *argv[])
+{
+	if (curr+1>=argc)
+	{
+		cerr << "Error: Missing argument '"<<param<<"' for option "<<opt<<endl;
+		usage(argv[0]);
+		exit(2);
+	}
+}
+
+inline bool convertToDouble(std::string const& s, double & d)
+{
+  std::istringstream i(s);
+  double x;
+  if (!(i >> x))
+    return false;
+  d = x;
+  return true;
+}
+
+// Reconciled trees of a gene family: the max. parsimony one if nbSamples is 0,
+// nbSamples stochastic ones otherwise
+vector<RecTree*> reconcileFamily(Tree * GeneTree, Tree * SpeciesTree, int nbSamples, bool verbose)
+{
+	vector<EditTree*> recs;
+	if (nbSamples==0)
+	{
+		EditTree * t = computeMaxParsimony(GeneTree, SpeciesTree);
+		if (t)
+		{ recs.push_back(t); }
+	}
+	else
+	{ recs = stochasticReconciliations(GeneTree, SpeciesTree, nbSamples); }
+	vector<RecTree*> res;
+	for(int i=0;i<recs.size();i++) 
+	{
+		RecTree * r = toRecTree(recs[i], GeneTree, SpeciesTree);
+		if (verbose)
+		{
+			r->show(false,0,cerr);
+			cerr << ";" << endl;
+		}
+		res.push_back(r);
+		delete recs[i];
+	}
+	return res;
+}
+
+int main(int argc, char *argv[])
+{
+	Tree * GeneTree1 = NULL;
+	Tree * GeneTree2 = NULL;
+	Tree * SpeciesTree = NULL;
+	map<string, map<string,string> > adjacencies;
+	bool partitionFunction = false;
+	bool verbose = false;
+	int nbSamples = 0;
+	for (int i=1;i<argc;i++)
+	{
+		string opt(argv[i]);
+		if (opt==GENE_1_OPTION_SHORT  || opt==GENE_1_OPTION_LONG)
+		{
+			ensureNextParamAvail(opt, "first gene tree", i, argc,argv);
+			i++;
+			GeneTree1 = parseNewickTree(string(argv[i]));
+		}
+		else if (opt==GENE_2_OPTION_SHORT  || opt==GENE_2_OPTION_LONG)
+		{
+			ensureNextParamAvail(opt, "second gene tree", i, argc,argv);
+			i++;
+			GeneTree2 = parseNewickTree(string(argv[i]));
+		}
+		else if (opt==SPECIES_TREE_OPTION_SHORT  || opt==SPECIES_TREE_OPTION_LONG)
+		{
+			ensureNextParamAvail(opt, "species tree", i, argc,argv);
+			i++;
+			SpeciesTree = parseNewickTree(string(argv[i]));
+		}
+		else if (opt==ADJACENCIES_OPTION_SHORT  || opt==ADJACENCIES_OPTION_LONG)
+		{
+			ensureNextParamAvail(opt, "adjacencies file", i, argc,argv);
+			i++;
+			adjacencies = loadAdjacencies(string(argv[i]));
+		}
+		else if (opt==SCORING_SCHEME_SHORT  || opt==SCORING_SCHEME_LONG)
+		{
+			ensureNextParamAvail(opt, "adj gain cost", i, argc,argv);
+			i++;
+			convertToDouble(argv[i],adjacency_gain);
+			ensureNextParamAvail(opt, "adj break cost", i, argc,argv);
+			i++;
+			convertToDouble(argv[i],adjacency_break);
+		}
+		else if (opt==SET_BOLTZMANN_OPTION_SHORT)
+		{
+			ensureNextParamAvail(opt, "Boltzmann constant", i, argc,argv);
+			i++;
+			convertToDouble(string(argv[i]), kT);
+		}
+		else if (opt==PARSIMONY_OPTION_SHORT  || opt==PARSIMONY_OPTION_LONG)
+		{
+			partitionFunction = false;
+		}
+		else if (opt==PARTITION_FUNCTION_OPTION_SHORT  || opt==PARTITION_FUNCTION_OPTION_LONG)
+		{
+			partitionFunction = true;
+		}
+		else if (opt==STOC_BACKTRACK_OPTION_SHORT  || opt==STOC_BACKTRACK_OPTION_LONG)
+		{
+			ensureNextParamAvail(opt, "#backtracks", i, argc,argv);
+			i++;
+			nbSamples = atoi(argv[i]);
+		}
+		else if (opt==VERBOSE_OPTION_SHORT  || opt==VERBOSE_OPTION_LONG)
+		{
+			verbose = true;
+		}
+		else if (opt==HELP_OPTION_SHORT  || opt==HELP_OPTION_LONG)
+		{
+			usage(argv[0]);
+			return EXIT_FAILURE;
+		}
+		else
+		{
+			cerr << "Error: Unknown option "<<opt<<endl;
+			usage(argv[0]);
+			return EXIT_FAILURE;
+		}
+	}
+	if (GeneTree1==NULL || GeneTree2==NULL || SpeciesTree==NULL)
+	{
+		cerr << "Error: Missing Gene trees or Species Tree"<<endl;
+		usage(argv[0]);
+		return EXIT_FAILURE;
+	}
+	vector<RecTree*> recs1 = reconcileFamily(GeneTree1, SpeciesTree, nbSamples, verbose);
+	vector<RecTree*> recs2 = reconcileFamily(GeneTree2, SpeciesTree, nbSamples, verbose);
+	if (recs1.empty() || recs2.empty())
+	{
+		cerr << "Error: No reconciliation possible between these trees."<<endl;
+		return EXIT_FAILURE;
+	}
+	cout.precision(10);
+	for(int i=0;i<recs1.size();i++) 
+	{
+		for(int j=0;j<recs2.size();j++) 
+		{
+			double result;
+			if (partitionFunction)
+			{ result = computeInside(recs1[i],recs2[j],adjacencies,kT); }
+			else
+			{ result = computeMaxParsimony(recs1[i],recs2[j],adjacencies); }
+			if (nbSamples!=0)
+			{ cout << (i+1) << "\t" << (j+1) << "\t"; }
+			cout << result << endl;
+		}
+	}
+	for(int i=0;i<recs1.size();i++) 
+	{ delete recs1[i]; }
+	for(int j=0;j<recs2.size();j++) 
+	{ delete recs2[j]; }
+	delete GeneTree1;
+	delete GeneTree2;
+	delete SpeciesTree;
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,2155 @@
+
+
+RESULT_TYPE** allocateMatrix(RecTree * t1, RecTree * t2)
+{
+	RESULT_TYPE** R = new RESULT_TYPE*[t1->size()];
+	for(int i=0;i<t1->size();i++) 
+	{ R[i] = new RESULT_TYPE[t2->size()]; }
+	return R;
+}
+
+void deleteMatrix(RESULT_TYPE** R, RecTree * t1, RecTree * t2)
+{
+	for(int i=0;i<t1->size();i++) 
+	{
+		delete[] R[i];
+	}
+	delete[] R;
+}
+
+// Fills the (v1,v2) cell of C0/C1, assuming that the cells it depends on are filled
+static void fillMatrixCell(RecTree * v1, RecTree * v2, RESULT_TYPE** C0, RESULT_TYPE** C1, map<string, map<string,string> > & adjacencies)
+{
+    int i = v1->getIndex();
+    int j = v2->getIndex();
+    RESULT_TYPE tmp;
+    if (!sameSpecies(v1,v2))
+    { C1[i][j] = INF; C0[i][j] = INF; }
+    else
+    {
+      EventType t1 = v1->getEvent();
+      EventType t2 = v2->getEvent();
+      int a1 = (v1->getLeft()?  v1->getLeft()->getIndex():-1);
+      int b1 = (v1->getRight()? v1->getRight()->getIndex():-1);
+      int a2 = (v2->getLeft()?  v2->getLeft()->getIndex():-1);
+      int b2 = (v2->getRight()? v2->getRight()->getIndex():-1);
+
+      tmp = INF;
+      // Op#1: c0[v1,v2] = IsntAdj(v1,v2,adjacencies)
+      if (((t1==Extant)) && ((t2==Extant)))
+      {
+         //cout << "     " << "((t1==Extant)) && ((t2==Extant)); Old val:"<< tmp << "; Cand: " << PLUS(IsntAdj(v1,v2,adjacencies),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+         tmp = MIN(tmp, PLUS(IsntAdj(v1,v2,adjacencies),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_EXTANT_EXTANT|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+      }
+      // Op#2: c0[v1,v2] = ZERO
+      if (((t1==GLos)) && ((t2==Extant) || (t2==Spec) || (t2==GDup)))
+      {
+         //cout << "     " << "((t1==GLos)) && ((t2==Extant) || (t2==Spec) || (t2==GDup)); Old val:"<< tmp << "; Cand: " << PLUS(ZERO,RESCALING_FACTOR((v1->numNonGDup() + v2->numNonGDup() - 1))) << endl;
+         tmp = MIN(tmp, PLUS(ZERO,RESCALING_FACTOR((v1->numNonGDup() + v2->numNonGDup() - 1))), ("C0_GLOS_ESG|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+      }
+      // Op#3: c0[v1,v2] = ZERO
+      if (((t1==Extant) || (t1==Spec) || (t1==GDup)) && ((t2==GLos)))
+      {
+         //cout << "     " << "((t1==Extant) || (t1==Spec) || (t1==GDup)) && ((t2==GLos)); Old val:"<< tmp << "; Cand: " << PLUS(ZERO,RESCALING_FACTOR((v1->numNonGDup() + v2->numNonGDup() - 1))) << endl;
+         tmp = MIN(tmp, PLUS(ZERO,RESCALING_FACTOR((v1->numNonGDup() + v2->numNonGDup() - 1))), ("C0_ESG_GLOS|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+      }
+      // Op#4: c0[v1,v2] = ZERO
+      if (((t1==GLos)) && ((t2==GLos)))
+      {
+         //cout << "     " << "((t1==GLos)) && ((t2==GLos)); Old val:"<< tmp << "; Cand: " << PLUS(ZERO,RESCALING_FACTOR((v1->numNonGDup() + v2->numNonGDup() - 1))) << endl;
+         tmp = MIN(tmp, PLUS(ZERO,RESCALING_FACTOR((v1->numNonGDup() + v2->numNonGDup() - 1))), ("C0_GLOS_GLOS|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+      }
+      // Op#5: c0[v1,v2] = c0[v1,v2b] + c0[v1,v2a]
+      if (((t1==Extant) || (t1==Spec)) && ((t2==GDup)) && (a2 != -1) && (b2 != -1))
+      {
+         //cout << "     " << "((t1==Extant) || (t1==Spec)) && ((t2==GDup)) && (a2 != -1) && (b2 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(C0[i][b2],C0[i][a2]),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS3(C0[i][b2],C0[i][a2],RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_ES_GDUP_C0V1V2A_C0V1V2B|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(C0[i][b2],C0[i][a2]),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_ES_GDUP_C0V1V2A_C0V1V2B|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#6: c0[v1,v2] = c0[v1,v2b] + c1[v1,v2a] + AdjGain
+      if (((t1==Extant) || (t1==Spec)) && ((t2==GDup)) && (a2 != -1) && (b2 != -1))
+      {
+         //cout << "     " << "((t1==Extant) || (t1==Spec)) && ((t2==GDup)) && (a2 != -1) && (b2 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(PLUS(C0[i][b2],C1[i][a2]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS4(C0[i][b2],C1[i][a2],AdjGain,RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_ES_GDUP_C0V1V2B_C1V1V2A|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(PLUS(C0[i][b2],C1[i][a2]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_ES_GDUP_C0V1V2B_C1V1V2A|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#7: c0[v1,v2] = c1[v1,v2b] + c0[v1,v2a] + AdjGain
+      if (((t1==Extant) || (t1==Spec)) && ((t2==GDup)) && (a2 != -1) && (b2 != -1))
+      {
+         //cout << "     " << "((t1==Extant) || (t1==Spec)) && ((t2==GDup)) && (a2 != -1) && (b2 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(PLUS(C1[i][b2],C0[i][a2]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS4(C1[i][b2],C0[i][a2],AdjGain,RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_ES_GDUP_C0V1V2A_C1V1V2B|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(PLUS(C1[i][b2],C0[i][a2]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_ES_GDUP_C0V1V2A_C1V1V2B|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#8: c0[v1,v2] = c1[v1,v2b] + c1[v1,v2a] + AdjGain + AdjGain
+      if (((t1==Extant) || (t1==Spec)) && ((t2==GDup)) && (a2 != -1) && (b2 != -1))
+      {
+         //cout << "     " << "((t1==Extant) || (t1==Spec)) && ((t2==GDup)) && (a2 != -1) && (b2 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(PLUS(PLUS(C1[i][b2],C1[i][a2]),AdjGain),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS5(C1[i][b2],C1[i][a2],AdjGain,AdjGain,RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_ES_GDUP_C1V1V2A_C1V1V2B|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(C1[i][b2],C1[i][a2]),AdjGain),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_ES_GDUP_C1V1V2A_C1V1V2B|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#9: c0[v1,v2] = c0[v1a,v2] + c0[v1b,v2]
+      if (((t1==GDup)) && ((t2==Extant) || (t2==Spec)) && (a1 != -1) && (b1 != -1))
+      {
+         //cout << "     " << "((t1==GDup)) && ((t2==Extant) || (t2==Spec)) && (a1 != -1) && (b1 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(C0[a1][j],C0[b1][j]),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS3(C0[a1][j],C0[b1][j],RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_GDUP_ES_C0V1AV2_C0V1BV2|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(C0[a1][j],C0[b1][j]),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_GDUP_ES_C0V1AV2_C0V1BV2|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#10: c0[v1,v2] = c0[v1a,v2] + c1[v1b,v2] + AdjGain
+      if (((t1==GDup)) && ((t2==Extant) || (t2==Spec)) && (a1 != -1) && (b1 != -1))
+      {
+         //cout << "     " << "((t1==GDup)) && ((t2==Extant) || (t2==Spec)) && (a1 != -1) && (b1 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(PLUS(C0[a1][j],C1[b1][j]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS4(C0[a1][j],C1[b1][j],AdjGain,RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_GDUP_ES_C0V1AV2_C1V1BV2|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(PLUS(C0[a1][j],C1[b1][j]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_GDUP_ES_C0V1AV2_C1V1BV2|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#11: c0[v1,v2] = c1[v1a,v2] + c0[v1b,v2] + AdjGain
+      if (((t1==GDup)) && ((t2==Extant) || (t2==Spec)) && (a1 != -1) && (b1 != -1))
+      {
+         //cout << "     " << "((t1==GDup)) && ((t2==Extant) || (t2==Spec)) && (a1 != -1) && (b1 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(PLUS(C1[a1][j],C0[b1][j]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS4(C1[a1][j],C0[b1][j],AdjGain,RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_GDUP_ES_C0V1BV2_C1V1AV2|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(PLUS(C1[a1][j],C0[b1][j]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_GDUP_ES_C0V1BV2_C1V1AV2|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#12: c0[v1,v2] = c1[v1a,v2] + c1[v1b,v2] + AdjGain + AdjGain
+      if (((t1==GDup)) && ((t2==Extant) || (t2==Spec)) && (a1 != -1) && (b1 != -1))
+      {
+         //cout << "     " << "((t1==GDup)) && ((t2==Extant) || (t2==Spec)) && (a1 != -1) && (b1 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(PLUS(PLUS(C1[a1][j],C1[b1][j]),AdjGain),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS5(C1[a1][j],C1[b1][j],AdjGain,AdjGain,RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_GDUP_ES_C1V1AV2_C1V1BV2|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(C1[a1][j],C1[b1][j]),AdjGain),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_GDUP_ES_C1V1AV2_C1V1BV2|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#13: c0[v1,v2] = c0[v1a,v2b] + c0[v1b,v2a]
+      if (((t1==Spec)) && ((t2==Spec)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+      {
+         //cout << "     " << "((t1==Spec)) && ((t2==Spec)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(C0[a1][b2],C0[b1][a2]),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS3(C0[a1][b2],C0[b1][a2],RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_SPEC_SPEC_C0V1AV2B_C0V1BV2A|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(C0[a1][b2],C0[b1][a2]),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_SPEC_SPEC_C0V1AV2B_C0V1BV2A|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#14: c0[v1,v2] = c1[v1a,v2b] + c0[v1b,v2a] + AdjGain
+      if (((t1==Spec)) && ((t2==Spec)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+      {
+         //cout << "     " << "((t1==Spec)) && ((t2==Spec)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(PLUS(C1[a1][b2],C0[b1][a2]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS4(C1[a1][b2],C0[b1][a2],AdjGain,RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_SPEC_SPEC_C0V1BV2A_C1V1AV2B|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(PLUS(C1[a1][b2],C0[b1][a2]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_SPEC_SPEC_C0V1BV2A_C1V1AV2B|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#15: c0[v1,v2] = c0[v1a,v2b] + c1[v1b,v2a] + AdjGain
+      if (((t1==Spec)) && ((t2==Spec)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+      {
+         //cout << "     " << "((t1==Spec)) && ((t2==Spec)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(PLUS(C0[a1][b2],C1[b1][a2]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS4(C0[a1][b2],C1[b1][a2],AdjGain,RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_SPEC_SPEC_C0V1AV2B_C1V1BV2A|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(PLUS(C0[a1][b2],C1[b1][a2]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_SPEC_SPEC_C0V1AV2B_C1V1BV2A|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#16: c0[v1,v2] = c1[v1a,v2b] + c1[v1b,v2a] + AdjGain + AdjGain
+      if (((t1==Spec)) && ((t2==Spec)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+      {
+         //cout << "     " << "((t1==Spec)) && ((t2==Spec)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(PLUS(PLUS(C1[a1][b2],C1[b1][a2]),AdjGain),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS5(C1[a1][b2],C1[b1][a2],AdjGain,AdjGain,RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_SPEC_SPEC_C1V1AV2B_C1V1BV2A|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(C1[a1][b2],C1[b1][a2]),AdjGain),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_SPEC_SPEC_C1V1AV2B_C1V1BV2A|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#17: c0[v1,v2] = c0[v1a,v2a] + c0[v1b,v2b]
+      if (((t1==Spec)) && ((t2==Spec)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+      {
+         //cout << "     " << "((t1==Spec)) && ((t2==Spec)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(C0[a1][a2],C0[b1][b2]),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS3(C0[a1][a2],C0[b1][b2],RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_SPEC_SPEC_C0V1AV2A_C0V1BV2B|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(C0[a1][a2],C0[b1][b2]),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_SPEC_SPEC_C0V1AV2A_C0V1BV2B|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#18: c0[v1,v2] = c1[v1a,v2a] + c0[v1b,v2b] + AdjGain
+      if (((t1==Spec)) && ((t2==Spec)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+      {
+         //cout << "     " << "((t1==Spec)) && ((t2==Spec)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(PLUS(C1[a1][a2],C0[b1][b2]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS4(C1[a1][a2],C0[b1][b2],AdjGain,RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_SPEC_SPEC_C0V1BV2B_C1V1AV2A|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(PLUS(C1[a1][a2],C0[b1][b2]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_SPEC_SPEC_C0V1BV2B_C1V1AV2A|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#19: c0[v1,v2] = c0[v1a,v2a] + c1[v1b,v2b] + AdjGain
+      if (((t1==Spec)) && ((t2==Spec)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+      {
+         //cout << "     " << "((t1==Spec)) && ((t2==Spec)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(PLUS(C0[a1][a2],C1[b1][b2]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS4(C0[a1][a2],C1[b1][b2],AdjGain,RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_SPEC_SPEC_C0V1AV2A_C1V1BV2B|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(PLUS(C0[a1][a2],C1[b1][b2]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_SPEC_SPEC_C0V1AV2A_C1V1BV2B|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#20: c0[v1,v2] = c1[v1a,v2a] + c1[v1b,v2b] + AdjGain + AdjGain
+      if (((t1==Spec)) && ((t2==Spec)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+      {
+         //cout << "     " << "((t1==Spec)) && ((t2==Spec)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(PLUS(PLUS(C1[a1][a2],C1[b1][b2]),AdjGain),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS5(C1[a1][a2],C1[b1][b2],AdjGain,AdjGain,RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_SPEC_SPEC_C1V1AV2A_C1V1BV2B|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(C1[a1][a2],C1[b1][b2]),AdjGain),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_SPEC_SPEC_C1V1AV2A_C1V1BV2B|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#21: c0[v1,v2] = c0[v1a,v2] + c0[v1b,v2]
+      if (((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1))
+      {
+         //cout << "     " << "((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(C0[a1][j],C0[b1][j]),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS3(C0[a1][j],C0[b1][j],RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_GDUP_GDUP_C0V1AV2_C0V1BV2|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(C0[a1][j],C0[b1][j]),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_GDUP_GDUP_C0V1AV2_C0V1BV2|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#22: c0[v1,v2] = c0[v1a,v2] + c1[v1b,v2] + AdjGain
+      if (((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1))
+      {
+         //cout << "     " << "((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(PLUS(C0[a1][j],C1[b1][j]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS4(C0[a1][j],C1[b1][j],AdjGain,RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_GDUP_GDUP_C0V1AV2_C1V1BV2|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(PLUS(C0[a1][j],C1[b1][j]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_GDUP_GDUP_C0V1AV2_C1V1BV2|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#23: c0[v1,v2] = c1[v1a,v2] + c0[v1b,v2] + AdjGain
+      if (((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1))
+      {
+         //cout << "     " << "((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(PLUS(C1[a1][j],C0[b1][j]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS4(C1[a1][j],C0[b1][j],AdjGain,RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_GDUP_GDUP_C0V1BV2_C1V1AV2|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(PLUS(C1[a1][j],C0[b1][j]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_GDUP_GDUP_C0V1BV2_C1V1AV2|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#24: c0[v1,v2] = c1[v1a,v2] + c1[v1b,v2] + AdjGain + AdjGain
+      if (((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1))
+      {
+         //cout << "     " << "((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(PLUS(PLUS(C1[a1][j],C1[b1][j]),AdjGain),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS5(C1[a1][j],C1[b1][j],AdjGain,AdjGain,RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_GDUP_GDUP_C1V1AV2_C1V1BV2|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(C1[a1][j],C1[b1][j]),AdjGain),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_GDUP_GDUP_C1V1AV2_C1V1BV2|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#25: c0[v1,v2] = c0[v1,v2a] + c0[v1,v2b]
+      if (((t1==GDup)) && ((t2==GDup)) && (a2 != -1) && (b2 != -1))
+      {
+         //cout << "     " << "((t1==GDup)) && ((t2==GDup)) && (a2 != -1) && (b2 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(C0[i][a2],C0[i][b2]),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS3(C0[i][a2],C0[i][b2],RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_GDUP_GDUP_C0V1V2A_C0V1V2B|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(C0[i][a2],C0[i][b2]),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_GDUP_GDUP_C0V1V2A_C0V1V2B|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#26: c0[v1,v2] = c0[v1,v2a] + c1[v1,v2b] + AdjGain
+      if (((t1==GDup)) && ((t2==GDup)) && (a2 != -1) && (b2 != -1))
+      {
+         //cout << "     " << "((t1==GDup)) && ((t2==GDup)) && (a2 != -1) && (b2 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(PLUS(C0[i][a2],C1[i][b2]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS4(C0[i][a2],C1[i][b2],AdjGain,RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_GDUP_GDUP_C0V1V2A_C1V1V2B|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(PLUS(C0[i][a2],C1[i][b2]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_GDUP_GDUP_C0V1V2A_C1V1V2B|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#27: c0[v1,v2] = c1[v1,v2a] + c0[v1,v2b] + AdjGain
+      if (((t1==GDup)) && ((t2==GDup)) && (a2 != -1) && (b2 != -1))
+      {
+         //cout << "     " << "((t1==GDup)) && ((t2==GDup)) && (a2 != -1) && (b2 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(PLUS(C1[i][a2],C0[i][b2]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS4(C1[i][a2],C0[i][b2],AdjGain,RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_GDUP_GDUP_C0V1V2B_C1V1V2A|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(PLUS(C1[i][a2],C0[i][b2]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_GDUP_GDUP_C0V1V2B_C1V1V2A|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#28: c0[v1,v2] = c1[v1,v2a] + c1[v1,v2b] + AdjGain + AdjGain
+      if (((t1==GDup)) && ((t2==GDup)) && (a2 != -1) && (b2 != -1))
+      {
+         //cout << "     " << "((t1==GDup)) && ((t2==GDup)) && (a2 != -1) && (b2 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(PLUS(PLUS(C1[i][a2],C1[i][b2]),AdjGain),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS5(C1[i][a2],C1[i][b2],AdjGain,AdjGain,RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_GDUP_GDUP_C1V1V2A_C1V1V2B|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(C1[i][a2],C1[i][b2]),AdjGain),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_GDUP_GDUP_C1V1V2A_C1V1V2B|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+#endif
+      }
+      C0[i][j] = tmp;
+
+      tmp = INF;
+      // Op#29: c1[v1,v2] = IsAdj(v1,v2,adjacencies)
+      if (((t1==Extant)) && ((t2==Extant)))
+      {
+         //cout << "     " << "((t1==Extant)) && ((t2==Extant)); Old val:"<< tmp << "; Cand: " << PLUS(IsAdj(v1,v2,adjacencies),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+         tmp = MIN(tmp, PLUS(IsAdj(v1,v2,adjacencies),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_EXTANT_EXTANT|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+      }
+      // Op#30: c1[v1,v2] = ZERO
+      if (((t1==GLos)) && ((t2==Extant) || (t2==Spec) || (t2==GDup)))
+      {
+         //cout << "     " << "((t1==GLos)) && ((t2==Extant) || (t2==Spec) || (t2==GDup)); Old val:"<< tmp << "; Cand: " << PLUS(ZERO,RESCALING_FACTOR((v1->numNonGDup() + v2->numNonGDup() - 1))) << endl;
+         tmp = MIN(tmp, PLUS(ZERO,RESCALING_FACTOR((v1->numNonGDup() + v2->numNonGDup() - 1))), ("C1_GLOS_ESG|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+      }
+      // Op#31: c1[v1,v2] = ZERO
+      if (((t1==Extant) || (t1==Spec) || (t1==GDup)) && ((t2==GLos)))
+      {
+         //cout << "     " << "((t1==Extant) || (t1==Spec) || (t1==GDup)) && ((t2==GLos)); Old val:"<< tmp << "; Cand: " << PLUS(ZERO,RESCALING_FACTOR((v1->numNonGDup() + v2->numNonGDup() - 1))) << endl;
+         tmp = MIN(tmp, PLUS(ZERO,RESCALING_FACTOR((v1->numNonGDup() + v2->numNonGDup() - 1))), ("C1_ESG_GLOS|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+      }
+      // Op#32: c1[v1,v2] = ZERO
+      if (((t1==GLos)) && ((t2==GLos)))
+      {
+         //cout << "     " << "((t1==GLos)) && ((t2==GLos)); Old val:"<< tmp << "; Cand: " << PLUS(ZERO,RESCALING_FACTOR((v1->numNonGDup() + v2->numNonGDup() - 1))) << endl;
+         tmp = MIN(tmp, PLUS(ZERO,RESCALING_FACTOR((v1->numNonGDup() + v2->numNonGDup() - 1))), ("C1_GLOS_GLOS|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+      }
+      // Op#33: c1[v1,v2] = c1[v1,v2b] + c0[v1,v2a]
+      if (((t1==Extant) || (t1==Spec)) && ((t2==GDup)) && (a2 != -1) && (b2 != -1))
+      {
+         //cout << "     " << "((t1==Extant) || (t1==Spec)) && ((t2==GDup)) && (a2 != -1) && (b2 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(C1[i][b2],C0[i][a2]),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS3(C1[i][b2],C0[i][a2],RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_ES_GDUP_C0V1V2A_C1V1V2B|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(C1[i][b2],C0[i][a2]),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_ES_GDUP_C0V1V2A_C1V1V2B|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#34: c1[v1,v2] = c0[v1,v2b] + c1[v1,v2a]
+      if (((t1==Extant) || (t1==Spec)) && ((t2==GDup)) && (a2 != -1) && (b2 != -1))
+      {
+         //cout << "     " << "((t1==Extant) || (t1==Spec)) && ((t2==GDup)) && (a2 != -1) && (b2 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(C0[i][b2],C1[i][a2]),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS3(C0[i][b2],C1[i][a2],RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_ES_GDUP_C0V1V2B_C1V1V2A|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(C0[i][b2],C1[i][a2]),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_ES_GDUP_C0V1V2B_C1V1V2A|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#35: c1[v1,v2] = c1[v1,v2b] + c1[v1,v2a] + AdjGain
+      if (((t1==Extant) || (t1==Spec)) && ((t2==GDup)) && (a2 != -1) && (b2 != -1))
+      {
+         //cout << "     " << "((t1==Extant) || (t1==Spec)) && ((t2==GDup)) && (a2 != -1) && (b2 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(PLUS(C1[i][b2],C1[i][a2]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS4(C1[i][b2],C1[i][a2],AdjGain,RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_ES_GDUP_C1V1V2A_C1V1V2B|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(PLUS(C1[i][b2],C1[i][a2]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_ES_GDUP_C1V1V2A_C1V1V2B|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#36: c1[v1,v2] = c0[v1,v2b] + c0[v1,v2a] + AdjBreak
+      if (((t1==Extant) || (t1==Spec)) && ((t2==GDup)) && (a2 != -1) && (b2 != -1))
+      {
+         //cout << "     " << "((t1==Extant) || (t1==Spec)) && ((t2==GDup)) && (a2 != -1) && (b2 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(PLUS(C0[i][b2],C0[i][a2]),AdjBreak),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS4(C0[i][b2],C0[i][a2],AdjBreak,RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_ES_GDUP_C0V1V2A_C0V1V2B|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(PLUS(C0[i][b2],C0[i][a2]),AdjBreak),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_ES_GDUP_C0V1V2A_C0V1V2B|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#37: c1[v1,v2] = c1[v1a,v2] + c0[v1b,v2]
+      if (((t1==GDup)) && ((t2==Extant) || (t2==Spec)) && (a1 != -1) && (b1 != -1))
+      {
+         //cout << "     " << "((t1==GDup)) && ((t2==Extant) || (t2==Spec)) && (a1 != -1) && (b1 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(C1[a1][j],C0[b1][j]),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS3(C1[a1][j],C0[b1][j],RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_ES_C0V1BV2_C1V1AV2|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(C1[a1][j],C0[b1][j]),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_ES_C0V1BV2_C1V1AV2|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#38: c1[v1,v2] = c0[v1a,v2] + c1[v1b,v2]
+      if (((t1==GDup)) && ((t2==Extant) || (t2==Spec)) && (a1 != -1) && (b1 != -1))
+      {
+         //cout << "     " << "((t1==GDup)) && ((t2==Extant) || (t2==Spec)) && (a1 != -1) && (b1 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(C0[a1][j],C1[b1][j]),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS3(C0[a1][j],C1[b1][j],RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_ES_C0V1AV2_C1V1BV2|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(C0[a1][j],C1[b1][j]),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_ES_C0V1AV2_C1V1BV2|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#39: c1[v1,v2] = c1[v1a,v2] + c1[v1b,v2] + AdjGain
+      if (((t1==GDup)) && ((t2==Extant) || (t2==Spec)) && (a1 != -1) && (b1 != -1))
+      {
+         //cout << "     " << "((t1==GDup)) && ((t2==Extant) || (t2==Spec)) && (a1 != -1) && (b1 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(PLUS(C1[a1][j],C1[b1][j]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS4(C1[a1][j],C1[b1][j],AdjGain,RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_ES_C1V1AV2_C1V1BV2|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(PLUS(C1[a1][j],C1[b1][j]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_ES_C1V1AV2_C1V1BV2|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#40: c1[v1,v2] = c0[v1a,v2] + c0[v1b,v2] + AdjBreak
+      if (((t1==GDup)) && ((t2==Extant) || (t2==Spec)) && (a1 != -1) && (b1 != -1))
+      {
+         //cout << "     " << "((t1==GDup)) && ((t2==Extant) || (t2==Spec)) && (a1 != -1) && (b1 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(PLUS(C0[a1][j],C0[b1][j]),AdjBreak),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS4(C0[a1][j],C0[b1][j],AdjBreak,RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_ES_C0V1AV2_C0V1BV2|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(PLUS(C0[a1][j],C0[b1][j]),AdjBreak),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_ES_C0V1AV2_C0V1BV2|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#41: c1[v1,v2] = c1[v1a,v2b] + c1[v1b,v2a]
+      if (((t1==Spec)) && ((t2==Spec)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+      {
+         //cout << "     " << "((t1==Spec)) && ((t2==Spec)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(C1[a1][b2],C1[b1][a2]),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS3(C1[a1][b2],C1[b1][a2],RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_SPEC_SPEC_C1V1AV2B_C1V1BV2A|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(C1[a1][b2],C1[b1][a2]),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_SPEC_SPEC_C1V1AV2B_C1V1BV2A|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#42: c1[v1,v2] = c1[v1a,v2b] + c0[v1b,v2a] + AdjBreak
+      if (((t1==Spec)) && ((t2==Spec)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+      {
+         //cout << "     " << "((t1==Spec)) && ((t2==Spec)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(PLUS(C1[a1][b2],C0[b1][a2]),AdjBreak),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS4(C1[a1][b2],C0[b1][a2],AdjBreak,RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_SPEC_SPEC_C0V1BV2A_C1V1AV2B|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(PLUS(C1[a1][b2],C0[b1][a2]),AdjBreak),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_SPEC_SPEC_C0V1BV2A_C1V1AV2B|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#43: c1[v1,v2] = c0[v1a,v2b] + c1[v1b,v2a] + AdjBreak
+      if (((t1==Spec)) && ((t2==Spec)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+      {
+         //cout << "     " << "((t1==Spec)) && ((t2==Spec)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(PLUS(C0[a1][b2],C1[b1][a2]),AdjBreak),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS4(C0[a1][b2],C1[b1][a2],AdjBreak,RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_SPEC_SPEC_C0V1AV2B_C1V1BV2A|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(PLUS(C0[a1][b2],C1[b1][a2]),AdjBreak),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_SPEC_SPEC_C0V1AV2B_C1V1BV2A|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#44: c1[v1,v2] = c0[v1a,v2b] + c0[v1b,v2a] + AdjBreak + AdjBreak
+      if (((t1==Spec)) && ((t2==Spec)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+      {
+         //cout << "     " << "((t1==Spec)) && ((t2==Spec)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(PLUS(PLUS(C0[a1][b2],C0[b1][a2]),AdjBreak),AdjBreak),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS5(C0[a1][b2],C0[b1][a2],AdjBreak,AdjBreak,RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_SPEC_SPEC_C0V1AV2B_C0V1BV2A|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(C0[a1][b2],C0[b1][a2]),AdjBreak),AdjBreak),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_SPEC_SPEC_C0V1AV2B_C0V1BV2A|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#45: c1[v1,v2] = c1[v1a,v2a] + c1[v1b,v2b]
+      if (((t1==Spec)) && ((t2==Spec)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+      {
+         //cout << "     " << "((t1==Spec)) && ((t2==Spec)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(C1[a1][a2],C1[b1][b2]),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS3(C1[a1][a2],C1[b1][b2],RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_SPEC_SPEC_C1V1AV2A_C1V1BV2B|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(C1[a1][a2],C1[b1][b2]),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_SPEC_SPEC_C1V1AV2A_C1V1BV2B|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#46: c1[v1,v2] = c1[v1a,v2a] + c0[v1b,v2b] + AdjBreak
+      if (((t1==Spec)) && ((t2==Spec)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+      {
+         //cout << "     " << "((t1==Spec)) && ((t2==Spec)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(PLUS(C1[a1][a2],C0[b1][b2]),AdjBreak),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS4(C1[a1][a2],C0[b1][b2],AdjBreak,RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_SPEC_SPEC_C0V1BV2B_C1V1AV2A|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(PLUS(C1[a1][a2],C0[b1][b2]),AdjBreak),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_SPEC_SPEC_C0V1BV2B_C1V1AV2A|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#47: c1[v1,v2] = c0[v1a,v2a] + c1[v1b,v2b] + AdjBreak
+      if (((t1==Spec)) && ((t2==Spec)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+      {
+         //cout << "     " << "((t1==Spec)) && ((t2==Spec)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(PLUS(C0[a1][a2],C1[b1][b2]),AdjBreak),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS4(C0[a1][a2],C1[b1][b2],AdjBreak,RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_SPEC_SPEC_C0V1AV2A_C1V1BV2B|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(PLUS(C0[a1][a2],C1[b1][b2]),AdjBreak),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_SPEC_SPEC_C0V1AV2A_C1V1BV2B|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#48: c1[v1,v2] = c0[v1a,v2a] + c0[v1b,v2b] + AdjBreak + AdjBreak
+      if (((t1==Spec)) && ((t2==Spec)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+      {
+         //cout << "     " << "((t1==Spec)) && ((t2==Spec)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(PLUS(PLUS(C0[a1][a2],C0[b1][b2]),AdjBreak),AdjBreak),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS5(C0[a1][a2],C0[b1][b2],AdjBreak,AdjBreak,RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_SPEC_SPEC_C0V1AV2A_C0V1BV2B|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(C0[a1][a2],C0[b1][b2]),AdjBreak),AdjBreak),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_SPEC_SPEC_C0V1AV2A_C0V1BV2B|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#49: c1[v1,v2] = c1[v1a,v2] + c0[v1b,v2]
+      if (((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1))
+      {
+         //cout << "     " << "((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(C1[a1][j],C0[b1][j]),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS3(C1[a1][j],C0[b1][j],RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_GDUP_C0V1BV2_C1V1AV2|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(C1[a1][j],C0[b1][j]),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_GDUP_C0V1BV2_C1V1AV2|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#50: c1[v1,v2] = c0[v1a,v2] + c1[v1b,v2]
+      if (((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1))
+      {
+         //cout << "     " << "((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(C0[a1][j],C1[b1][j]),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS3(C0[a1][j],C1[b1][j],RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_GDUP_C0V1AV2_C1V1BV2|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(C0[a1][j],C1[b1][j]),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_GDUP_C0V1AV2_C1V1BV2|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#51: c1[v1,v2] = c1[v1a,v2] + c1[v1b,v2] + AdjGain
+      if (((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1))
+      {
+         //cout << "     " << "((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(PLUS(C1[a1][j],C1[b1][j]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS4(C1[a1][j],C1[b1][j],AdjGain,RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_GDUP_C1V1AV2_C1V1BV2|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(PLUS(C1[a1][j],C1[b1][j]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_GDUP_C1V1AV2_C1V1BV2|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#52: c1[v1,v2] = c0[v1a,v2] + c0[v1b,v2] + AdjBreak
+      if (((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1))
+      {
+         //cout << "     " << "((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(PLUS(C0[a1][j],C0[b1][j]),AdjBreak),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS4(C0[a1][j],C0[b1][j],AdjBreak,RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_GDUP_C0V1AV2_C0V1BV2|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(PLUS(C0[a1][j],C0[b1][j]),AdjBreak),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_GDUP_C0V1AV2_C0V1BV2|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#53: c1[v1,v2] = c1[v1,v2a] + c0[v1,v2b]
+      if (((t1==GDup)) && ((t2==GDup)) && (a2 != -1) && (b2 != -1))
+      {
+         //cout << "     " << "((t1==GDup)) && ((t2==GDup)) && (a2 != -1) && (b2 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(C1[i][a2],C0[i][b2]),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS3(C1[i][a2],C0[i][b2],RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_GDUP_C0V1V2B_C1V1V2A|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(C1[i][a2],C0[i][b2]),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_GDUP_C0V1V2B_C1V1V2A|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#54: c1[v1,v2] = c0[v1,v2a] + c1[v1,v2b]
+      if (((t1==GDup)) && ((t2==GDup)) && (a2 != -1) && (b2 != -1))
+      {
+         //cout << "     " << "((t1==GDup)) && ((t2==GDup)) && (a2 != -1) && (b2 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(C0[i][a2],C1[i][b2]),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS3(C0[i][a2],C1[i][b2],RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_GDUP_C0V1V2A_C1V1V2B|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(C0[i][a2],C1[i][b2]),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_GDUP_C0V1V2A_C1V1V2B|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#55: c1[v1,v2] = c1[v1,v2a] + c1[v1,v2b] + AdjGain
+      if (((t1==GDup)) && ((t2==GDup)) && (a2 != -1) && (b2 != -1))
+      {
+         //cout << "     " << "((t1==GDup)) && ((t2==GDup)) && (a2 != -1) && (b2 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(PLUS(C1[i][a2],C1[i][b2]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS4(C1[i][a2],C1[i][b2],AdjGain,RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_GDUP_C1V1V2A_C1V1V2B|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(PLUS(C1[i][a2],C1[i][b2]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_GDUP_C1V1V2A_C1V1V2B|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#56: c1[v1,v2] = c0[v1,v2a] + c0[v1,v2b] + AdjBreak
+      if (((t1==GDup)) && ((t2==GDup)) && (a2 != -1) && (b2 != -1))
+      {
+         //cout << "     " << "((t1==GDup)) && ((t2==GDup)) && (a2 != -1) && (b2 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(PLUS(C0[i][a2],C0[i][b2]),AdjBreak),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS4(C0[i][a2],C0[i][b2],AdjBreak,RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_GDUP_C0V1V2A_C0V1V2B|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(PLUS(C0[i][a2],C0[i][b2]),AdjBreak),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_GDUP_C0V1V2A_C0V1V2B|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#57: c1[v1,v2] = c1[v1a,v2a] + c1[v1b,v2b] + c0[v1a,v2b] + c0[v1b,v2a]
+      if (((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+      {
+         //cout << "     " << "((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(PLUS(PLUS(C1[a1][a2],C1[b1][b2]),C0[a1][b2]),C0[b1][a2]),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS5(C1[a1][a2],C1[b1][b2],C0[a1][b2],C0[b1][a2],RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_GDUP_C0V1AV2B_C0V1BV2A_C1V1AV2A_C1V1BV2B|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(C1[a1][a2],C1[b1][b2]),C0[a1][b2]),C0[b1][a2]),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_GDUP_C0V1AV2B_C0V1BV2A_C1V1AV2A_C1V1BV2B|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#58: c1[v1,v2] = c1[v1a,v2a] + c1[v1b,v2b] + c0[v1a,v2b] + c1[v1b,v2a] + AdjGain
+      if (((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+      {
+         //cout << "     " << "((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(PLUS(PLUS(PLUS(C1[a1][a2],C1[b1][b2]),C0[a1][b2]),C1[b1][a2]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS6(C1[a1][a2],C1[b1][b2],C0[a1][b2],C1[b1][a2],AdjGain,RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_GDUP_C0V1AV2B_C1V1AV2A_C1V1BV2A_C1V1BV2B|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(PLUS(C1[a1][a2],C1[b1][b2]),C0[a1][b2]),C1[b1][a2]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_GDUP_C0V1AV2B_C1V1AV2A_C1V1BV2A_C1V1BV2B|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#59: c1[v1,v2] = c1[v1a,v2a] + c1[v1b,v2b] + c1[v1a,v2b] + c0[v1b,v2a] + AdjGain
+      if (((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+      {
+         //cout << "     " << "((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(PLUS(PLUS(PLUS(C1[a1][a2],C1[b1][b2]),C1[a1][b2]),C0[b1][a2]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS6(C1[a1][a2],C1[b1][b2],C1[a1][b2],C0[b1][a2],AdjGain,RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_GDUP_C0V1BV2A_C1V1AV2A_C1V1AV2B_C1V1BV2B|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(PLUS(C1[a1][a2],C1[b1][b2]),C1[a1][b2]),C0[b1][a2]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_GDUP_C0V1BV2A_C1V1AV2A_C1V1AV2B_C1V1BV2B|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#60: c1[v1,v2] = c1[v1a,v2a] + c1[v1b,v2b] + c1[v1a,v2b] + c1[v1b,v2a] + AdjGain + AdjGain
+      if (((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+      {
+         //cout << "     " << "((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(PLUS(PLUS(PLUS(PLUS(C1[a1][a2],C1[b1][b2]),C1[a1][b2]),C1[b1][a2]),AdjGain),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS7(C1[a1][a2],C1[b1][b2],C1[a1][b2],C1[b1][a2],AdjGain,AdjGain,RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_GDUP_C1V1AV2A_C1V1AV2B_C1V1BV2A_C1V1BV2B|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(PLUS(PLUS(C1[a1][a2],C1[b1][b2]),C1[a1][b2]),C1[b1][a2]),AdjGain),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_GDUP_C1V1AV2A_C1V1AV2B_C1V1BV2A_C1V1BV2B|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#61: c1[v1,v2] = c1[v1a,v2a] + c0[v1b,v2b] + c0[v1a,v2b] + c0[v1b,v2a] + AdjBreak
+      if (((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+      {
+         //cout << "     " << "((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(PLUS(PLUS(PLUS(C1[a1][a2],C0[b1][b2]),C0[a1][b2]),C0[b1][a2]),AdjBreak),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS6(C1[a1][a2],C0[b1][b2],C0[a1][b2],C0[b1][a2],AdjBreak,RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_GDUP_C0V1AV2B_C0V1BV2A_C0V1BV2B_C1V1AV2A|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(PLUS(C1[a1][a2],C0[b1][b2]),C0[a1][b2]),C0[b1][a2]),AdjBreak),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_GDUP_C0V1AV2B_C0V1BV2A_C0V1BV2B_C1V1AV2A|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#62: c1[v1,v2] = c1[v1a,v2a] + c0[v1b,v2b] + c0[v1a,v2b] + c1[v1b,v2a] + AdjGain + AdjBreak
+      if (((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+      {
+         //cout << "     " << "((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(PLUS(PLUS(PLUS(PLUS(C1[a1][a2],C0[b1][b2]),C0[a1][b2]),C1[b1][a2]),AdjGain),AdjBreak),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS7(C1[a1][a2],C0[b1][b2],C0[a1][b2],C1[b1][a2],AdjGain,AdjBreak,RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_GDUP_C0V1AV2B_C0V1BV2B_C1V1AV2A_C1V1BV2A|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(PLUS(PLUS(C1[a1][a2],C0[b1][b2]),C0[a1][b2]),C1[b1][a2]),AdjGain),AdjBreak),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_GDUP_C0V1AV2B_C0V1BV2B_C1V1AV2A_C1V1BV2A|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#63: c1[v1,v2] = c1[v1a,v2a] + c0[v1b,v2b] + c1[v1a,v2b] + c0[v1b,v2a] + AdjGain + AdjBreak
+      if (((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+      {
+         //cout << "     " << "((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(PLUS(PLUS(PLUS(PLUS(C1[a1][a2],C0[b1][b2]),C1[a1][b2]),C0[b1][a2]),AdjGain),AdjBreak),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS7(C1[a1][a2],C0[b1][b2],C1[a1][b2],C0[b1][a2],AdjGain,AdjBreak,RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_GDUP_C0V1BV2A_C0V1BV2B_C1V1AV2A_C1V1AV2B|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(PLUS(PLUS(C1[a1][a2],C0[b1][b2]),C1[a1][b2]),C0[b1][a2]),AdjGain),AdjBreak),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_GDUP_C0V1BV2A_C0V1BV2B_C1V1AV2A_C1V1AV2B|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#64: c1[v1,v2] = c0[v1a,v2a] + c1[v1b,v2b] + c0[v1a,v2b] + c0[v1b,v2a] + AdjBreak
+      if (((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+      {
+         //cout << "     " << "((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(PLUS(PLUS(PLUS(C0[a1][a2],C1[b1][b2]),C0[a1][b2]),C0[b1][a2]),AdjBreak),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS6(C0[a1][a2],C1[b1][b2],C0[a1][b2],C0[b1][a2],AdjBreak,RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_GDUP_C0V1AV2A_C0V1AV2B_C0V1BV2A_C1V1BV2B|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(PLUS(C0[a1][a2],C1[b1][b2]),C0[a1][b2]),C0[b1][a2]),AdjBreak),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_GDUP_C0V1AV2A_C0V1AV2B_C0V1BV2A_C1V1BV2B|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#65: c1[v1,v2] = c0[v1a,v2a] + c1[v1b,v2b] + c0[v1a,v2b] + c1[v1b,v2a] + AdjGain + AdjBreak
+      if (((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+      {
+         //cout << "     " << "((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(PLUS(PLUS(PLUS(PLUS(C0[a1][a2],C1[b1][b2]),C0[a1][b2]),C1[b1][a2]),AdjGain),AdjBreak),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS7(C0[a1][a2],C1[b1][b2],C0[a1][b2],C1[b1][a2],AdjGain,AdjBreak,RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_GDUP_C0V1AV2A_C0V1AV2B_C1V1BV2A_C1V1BV2B|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(PLUS(PLUS(C0[a1][a2],C1[b1][b2]),C0[a1][b2]),C1[b1][a2]),AdjGain),AdjBreak),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_GDUP_C0V1AV2A_C0V1AV2B_C1V1BV2A_C1V1BV2B|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#66: c1[v1,v2] = c0[v1a,v2a] + c1[v1b,v2b] + c1[v1a,v2b] + c0[v1b,v2a] + AdjGain + AdjBreak
+      if (((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+      {
+         //cout << "     " << "((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(PLUS(PLUS(PLUS(PLUS(C0[a1][a2],C1[b1][b2]),C1[a1][b2]),C0[b1][a2]),AdjGain),AdjBreak),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS7(C0[a1][a2],C1[b1][b2],C1[a1][b2],C0[b1][a2],AdjGain,AdjBreak,RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_GDUP_C0V1AV2A_C0V1BV2A_C1V1AV2B_C1V1BV2B|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(PLUS(PLUS(C0[a1][a2],C1[b1][b2]),C1[a1][b2]),C0[b1][a2]),AdjGain),AdjBreak),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_GDUP_C0V1AV2A_C0V1BV2A_C1V1AV2B_C1V1BV2B|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#67: c1[v1,v2] = c0[v1a,v2a] + c0[v1b,v2b] + c1[v1a,v2b] + c1[v1b,v2a]
+      if (((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+      {
+         //cout << "     " << "((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(PLUS(PLUS(C0[a1][a2],C0[b1][b2]),C1[a1][b2]),C1[b1][a2]),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS5(C0[a1][a2],C0[b1][b2],C1[a1][b2],C1[b1][a2],RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_GDUP_C0V1AV2A_C0V1BV2B_C1V1AV2B_C1V1BV2A|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(C0[a1][a2],C0[b1][b2]),C1[a1][b2]),C1[b1][a2]),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_GDUP_C0V1AV2A_C0V1BV2B_C1V1AV2B_C1V1BV2A|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#68: c1[v1,v2] = c0[v1a,v2a] + c1[v1b,v2b] + c1[v1a,v2b] + c1[v1b,v2a] + AdjGain
+      if (((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+      {
+         //cout << "     " << "((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(PLUS(PLUS(PLUS(C0[a1][a2],C1[b1][b2]),C1[a1][b2]),C1[b1][a2]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS6(C0[a1][a2],C1[b1][b2],C1[a1][b2],C1[b1][a2],AdjGain,RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_GDUP_C0V1AV2A_C1V1AV2B_C1V1BV2A_C1V1BV2B|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(PLUS(C0[a1][a2],C1[b1][b2]),C1[a1][b2]),C1[b1][a2]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_GDUP_C0V1AV2A_C1V1AV2B_C1V1BV2A_C1V1BV2B|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#69: c1[v1,v2] = c1[v1a,v2a] + c0[v1b,v2b] + c1[v1a,v2b] + c1[v1b,v2a] + AdjGain
+      if (((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+      {
+         //cout << "     " << "((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(PLUS(PLUS(PLUS(C1[a1][a2],C0[b1][b2]),C1[a1][b2]),C1[b1][a2]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS6(C1[a1][a2],C0[b1][b2],C1[a1][b2],C1[b1][a2],AdjGain,RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_GDUP_C0V1BV2B_C1V1AV2A_C1V1AV2B_C1V1BV2A|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(PLUS(C1[a1][a2],C0[b1][b2]),C1[a1][b2]),C1[b1][a2]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_GDUP_C0V1BV2B_C1V1AV2A_C1V1AV2B_C1V1BV2A|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#70: c1[v1,v2] = c0[v1a,v2a] + c0[v1b,v2b] + c1[v1a,v2b] + c0[v1b,v2a] + AdjBreak
+      if (((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+      {
+         //cout << "     " << "((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(PLUS(PLUS(PLUS(C0[a1][a2],C0[b1][b2]),C1[a1][b2]),C0[b1][a2]),AdjBreak),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS6(C0[a1][a2],C0[b1][b2],C1[a1][b2],C0[b1][a2],AdjBreak,RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_GDUP_C0V1AV2A_C0V1BV2A_C0V1BV2B_C1V1AV2B|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(PLUS(C0[a1][a2],C0[b1][b2]),C1[a1][b2]),C0[b1][a2]),AdjBreak),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_GDUP_C0V1AV2A_C0V1BV2A_C0V1BV2B_C1V1AV2B|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#71: c1[v1,v2] = c0[v1a,v2a] + c0[v1b,v2b] + c0[v1a,v2b] + c1[v1b,v2a] + AdjBreak
+      if (((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+      {
+         //cout << "     " << "((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(PLUS(PLUS(PLUS(C0[a1][a2],C0[b1][b2]),C0[a1][b2]),C1[b1][a2]),AdjBreak),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS6(C0[a1][a2],C0[b1][b2],C0[a1][b2],C1[b1][a2],AdjBreak,RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_GDUP_C0V1AV2A_C0V1AV2B_C0V1BV2B_C1V1BV2A|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(PLUS(C0[a1][a2],C0[b1][b2]),C0[a1][b2]),C1[b1][a2]),AdjBreak),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_GDUP_C0V1AV2A_C0V1AV2B_C0V1BV2B_C1V1BV2A|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#72: c1[v1,v2] = c0[v1a,v2a] + c0[v1b,v2b] + c0[v1a,v2b] + c0[v1b,v2a] + AdjBreak + AdjBreak
+      if (((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+      {
+         //cout << "     " << "((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(PLUS(PLUS(PLUS(PLUS(C0[a1][a2],C0[b1][b2]),C0[a1][b2]),C0[b1][a2]),AdjBreak),AdjBreak),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS7(C0[a1][a2],C0[b1][b2],C0[a1][b2],C0[b1][a2],AdjBreak,AdjBreak,RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_GDUP_C0V1AV2A_C0V1AV2B_C0V1BV2A_C0V1BV2B|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(PLUS(PLUS(C0[a1][a2],C0[b1][b2]),C0[a1][b2]),C0[b1][a2]),AdjBreak),AdjBreak),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_GDUP_C0V1AV2A_C0V1AV2B_C0V1BV2A_C0V1BV2B|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#endif
+      }
+      C1[i][j] = tmp;
+
+#ifdef CELL_STORE
+      CELL_STORE(i,j,v1,v2,C0[i][j],C1[i][j]);
+#endif
+    }
+    //cerr << "Node: " << v1->getLabel() << " (" << v1->getSpecies() << ") " << v2->getLabel() << " (" << v2->getSpecies() << ")" << endl;
+}
+
+// Fills the row of v1 in C0/C1. If mask is not NULL, only fills the cells marked as CELL_COMPUTE.
+static void fillMatrixRow(RecTree * v1, vector<RecTree*> & Dfo2, RESULT_TYPE** C0, RESULT_TYPE** C1, map<string, map<string,string> > & adjacencies, const char * mask)
+{
+    for(int j=0;j<Dfo2.size();j++) 
+    {
+        if ((mask==NULL) || (mask[j]==CELL_COMPUTE))
+        { fillMatrixCell(v1, Dfo2[j], C0, C1, adjacencies); }
+    }
+}
+
+#ifdef computeRow
+// Fills the row of v1 in tables kept by the caller, whose (stable) indices may 
+// not follow a depth-first order, as long as the rows of the children of v1 are filled
+void computeRow(RecTree * v1, vector<RecTree*> & Dfo2, RESULT_TYPE** C0, RESULT_TYPE** C1, map<string, map<string,string> > & adjacencies, const char * mask)
+{
+    fillMatrixRow(v1, Dfo2, C0, C1, adjacencies, mask);
+}
+#endif
+
+// Marks (as CELL_COMPUTE) the cells that the (v1,v2) cell depends on 
+static void markCellDependencies(RecTree * v1, RecTree * v2, char ** mask)
+{
+    int i = v1->getIndex();
+    int j = v2->getIndex();
+    EventType t1 = v1->getEvent();
+    EventType t2 = v2->getEvent();
+    int a1 = (v1->getLeft()?  v1->getLeft()->getIndex():-1);
+    int b1 = (v1->getRight()? v1->getRight()->getIndex():-1);
+    int a2 = (v2->getLeft()?  v2->getLeft()->getIndex():-1);
+    int b2 = (v2->getRight()? v2->getRight()->getIndex():-1);
+    if (((t1==Extant) || (t1==Spec)) && ((t2==GDup)) && (a2 != -1) && (b2 != -1))
+    {
+      mask[i][b2] = CELL_COMPUTE;
+      mask[i][a2] = CELL_COMPUTE;
+    }
+    if (((t1==GDup)) && ((t2==Extant) || (t2==Spec)) && (a1 != -1) && (b1 != -1))
+    {
+      mask[a1][j] = CELL_COMPUTE;
+      mask[b1][j] = CELL_COMPUTE;
+    }
+    if (((t1==Spec)) && ((t2==Spec)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+    {
+      mask[a1][b2] = CELL_COMPUTE;
+      mask[b1][a2] = CELL_COMPUTE;
+      mask[a1][a2] = CELL_COMPUTE;
+      mask[b1][b2] = CELL_COMPUTE;
+    }
+    if (((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1))
+    {
+      mask[a1][j] = CELL_COMPUTE;
+      mask[b1][j] = CELL_COMPUTE;
+    }
+    if (((t1==GDup)) && ((t2==GDup)) && (a2 != -1) && (b2 != -1))
+    {
+      mask[i][a2] = CELL_COMPUTE;
+      mask[i][b2] = CELL_COMPUTE;
+    }
+    if (((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+    {
+      mask[a1][a2] = CELL_COMPUTE;
+      mask[b1][b2] = CELL_COMPUTE;
+      mask[a1][b2] = CELL_COMPUTE;
+      mask[b1][a2] = CELL_COMPUTE;
+    }
+}
+
+#ifdef CELL_LOOKUP
+// Top-down pass from the root cell, which finds the cells that are actually needed
+// to compute the root: cells retrieved through CELL_LOOKUP are marked CELL_KNOWN, 
+// and their dependencies are not explored further.
+static char ** planMatrixCells(vector<RecTree*> & Dfo1, vector<RecTree*> & Dfo2, RESULT_TYPE** C0, RESULT_TYPE** C1)
+{
+    char ** mask = new char*[Dfo1.size()];
+    for(int i=0;i<Dfo1.size();i++) 
+    {
+        mask[i] = new char[Dfo2.size()];
+        for(int j=0;j<Dfo2.size();j++) 
+        { mask[i][j] = CELL_SKIP; }
+    }
+    mask[Dfo1.size()-1][Dfo2.size()-1] = CELL_COMPUTE;
+    for(int i=Dfo1.size()-1;i>=0;i--) 
+    {
+        RecTree * v1 = Dfo1[i];
+        for(int j=Dfo2.size()-1;j>=0;j--) 
+        {
+            RecTree * v2 = Dfo2[j];
+            if ((mask[i][j]==CELL_COMPUTE) && sameSpecies(v1,v2))
+            {
+                if (CELL_LOOKUP(i,j,v1,v2,C0[i][j],C1[i][j]))
+                { mask[i][j] = CELL_KNOWN; }
+                else
+                { markCellDependencies(v1,v2,mask); }
+            }
+        }
+    }
+    return mask;
+}
+#endif
+
+
+// Backward (outside) pass, followed by the weights of each case in each cell (W),
+// computed from filled C0/C1 tables (indexed by the positions of nodes in Dfo1/Dfo2)
+RESULT_TYPE*** computeOutsideWeights(RecTree * t1, RecTree * t2, vector<RecTree*> & Dfo1, vector<RecTree*> & Dfo2, RESULT_TYPE** C0, RESULT_TYPE** C1, map<string, map<string,string> > & adjacencies)
+{
+    RESULT_TYPE** B0 = allocateMatrix(t1,t2);
+    RESULT_TYPE** B1 = allocateMatrix(t1,t2);
+
+    vector<EventType> event1;
+    vector<EventType> event2;
+    for(int i=0;i<Dfo1.size();i++) 
+    {
+        event1.push_back(Dfo1[i]->getEvent());
+    }
+    for(int j=0;j<Dfo2.size();j++) 
+    {
+        event2.push_back(Dfo2[j]->getEvent());
+    }
+
+    for(int i=Dfo1.size()-1; i>=0; i--) 
+    {
+        RecTree * v1 = Dfo1[i];
+        for(int j=Dfo2.size()-1; j>=0; j--) 
+        {
+            RESULT_TYPE tmp;
+	    RecTree * v2 = Dfo2[j];
+            if (!sameSpecies(v1,v2))
+            { B1[i][j] = INF; B0[i][j] = INF; }
+            else
+            {
+              EventType t1 = event1[i];
+              EventType t2 = event2[j];
+              int a1 = (v1->getLeft()?  v1->getLeft()->getIndex():-1);
+              int b1 = (v1->getRight()? v1->getRight()->getIndex():-1);
+              int a2 = (v2->getLeft()?  v2->getLeft()->getIndex():-1);
+              int b2 = (v2->getRight()? v2->getRight()->getIndex():-1);
+
+              RecTree *  v1p = v1->getParent();
+              RecTree *  v2p = v2->getParent();
+              int p1 = -1;
+              bool v1IsLeftChild = false;
+              bool v1IsRightChild = false;
+              int s1 = -1;
+	      if (v1p)
+	      {
+		   p1 = v1p->getIndex();
+		   v1IsLeftChild = (v1p->getLeft()==v1);
+		   v1IsRightChild = !v1IsLeftChild;
+		   s1 = (v1IsLeftChild?v1p->getRight()->getIndex():v1p->getLeft()->getIndex());
+	      }
+	      int p2 = -1;
+	      bool v2IsLeftChild = false;
+	      bool v2IsRightChild = false;
+	      int s2 = -1;
+	      if (v2p)
+	      {
+		   p2 = v2p->getIndex();
+		   v2IsLeftChild = (v2p->getLeft()==v2);
+		   v2IsRightChild = !v2IsLeftChild;
+		   s2 = (v2IsLeftChild?v2p->getRight()->getIndex():v2p->getLeft()->getIndex());
+	      }
+
+              tmp = INF;
+              if ((p1 == -1) && (p2 == -1))
+	      {
+		   tmp = ZERO;
+	      }
+              // b1[v1][v2] =  c0(v1,v2s) +  b0(v1,v2p) + AdjGain
+              if ((p2 != -1) && (v2IsLeftChild) && ((event1[i] == Extant)||(event1[i] == Spec)) && ((event2[p2] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(C0[i][s2],B0[i][p2]),AdjGain),RESCALING_FACTOR((((event1[i]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b1[v1][v2] =  c0(v1,v2s) +  b0(v1,v2p) + AdjGain
+              if ((p2 != -1) && (v2IsRightChild) && ((event1[i] == Extant)||(event1[i] == Spec)) && ((event2[p2] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(C0[i][s2],B0[i][p2]),AdjGain),RESCALING_FACTOR((((event1[i]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b1[v1][v2] =  c1(v1,v2s) +  b0(v1,v2p) + AdjGain + AdjGain
+              if ((p2 != -1) && (v2IsRightChild) && ((event1[i] == Extant)||(event1[i] == Spec)) && ((event2[p2] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(C1[i][s2],B0[i][p2]),AdjGain),AdjGain),RESCALING_FACTOR((((event1[i]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b1[v1][v2] =  c1(v1,v2s) +  b0(v1,v2p) + AdjGain + AdjGain
+              if ((p2 != -1) && (v2IsLeftChild) && ((event1[i] == Extant)||(event1[i] == Spec)) && ((event2[p2] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(C1[i][s2],B0[i][p2]),AdjGain),AdjGain),RESCALING_FACTOR((((event1[i]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b1[v1][v2] =  c0(v1s,v2) +  b0(v1p,v2) + AdjGain
+              if ((p1 != -1) && (v1IsRightChild) && ((event1[p1] == GDup)) && ((event2[j] == Extant)||(event2[j] == Spec)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(C0[s1][j],B0[p1][j]),AdjGain),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[j]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b1[v1][v2] =  c0(v1s,v2) +  b0(v1p,v2) + AdjGain
+              if ((p1 != -1) && (v1IsLeftChild) && ((event1[p1] == GDup)) && ((event2[j] == Extant)||(event2[j] == Spec)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(C0[s1][j],B0[p1][j]),AdjGain),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[j]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b1[v1][v2] =  c1(v1s,v2) +  b0(v1p,v2) + AdjGain + AdjGain
+              if ((p1 != -1) && (v1IsLeftChild) && ((event1[p1] == GDup)) && ((event2[j] == Extant)||(event2[j] == Spec)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(C1[s1][j],B0[p1][j]),AdjGain),AdjGain),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[j]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b1[v1][v2] =  c1(v1s,v2) +  b0(v1p,v2) + AdjGain + AdjGain
+              if ((p1 != -1) && (v1IsRightChild) && ((event1[p1] == GDup)) && ((event2[j] == Extant)||(event2[j] == Spec)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(C1[s1][j],B0[p1][j]),AdjGain),AdjGain),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[j]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b1[v1][v2] =  c0(v1s,v2s) +  b0(v1p,v2p) + AdjGain
+              if ((p1 != -1) && (v1IsLeftChild) && (p2 != -1) && (v2IsRightChild) && ((event1[p1] == Spec)) && ((event2[p2] == Spec)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(C0[s1][s2],B0[p1][p2]),AdjGain),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b1[v1][v2] =  c0(v1s,v2s) +  b0(v1p,v2p) + AdjGain
+              if ((p1 != -1) && (v1IsRightChild) && (p2 != -1) && (v2IsLeftChild) && ((event1[p1] == Spec)) && ((event2[p2] == Spec)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(C0[s1][s2],B0[p1][p2]),AdjGain),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b1[v1][v2] =  c1(v1s,v2s) +  b0(v1p,v2p) + AdjGain + AdjGain
+              if ((p1 != -1) && (v1IsLeftChild) && (p2 != -1) && (v2IsRightChild) && ((event1[p1] == Spec)) && ((event2[p2] == Spec)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(C1[s1][s2],B0[p1][p2]),AdjGain),AdjGain),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b1[v1][v2] =  c1(v1s,v2s) +  b0(v1p,v2p) + AdjGain + AdjGain
+              if ((p1 != -1) && (v1IsRightChild) && (p2 != -1) && (v2IsLeftChild) && ((event1[p1] == Spec)) && ((event2[p2] == Spec)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(C1[s1][s2],B0[p1][p2]),AdjGain),AdjGain),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b1[v1][v2] =  c0(v1s,v2s) +  b0(v1p,v2p) + AdjGain
+              if ((p1 != -1) && (v1IsLeftChild) && (p2 != -1) && (v2IsLeftChild) && ((event1[p1] == Spec)) && ((event2[p2] == Spec)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(C0[s1][s2],B0[p1][p2]),AdjGain),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b1[v1][v2] =  c0(v1s,v2s) +  b0(v1p,v2p) + AdjGain
+              if ((p1 != -1) && (v1IsRightChild) && (p2 != -1) && (v2IsRightChild) && ((event1[p1] == Spec)) && ((event2[p2] == Spec)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(C0[s1][s2],B0[p1][p2]),AdjGain),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b1[v1][v2] =  c1(v1s,v2s) +  b0(v1p,v2p) + AdjGain + AdjGain
+              if ((p1 != -1) && (v1IsLeftChild) && (p2 != -1) && (v2IsLeftChild) && ((event1[p1] == Spec)) && ((event2[p2] == Spec)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(C1[s1][s2],B0[p1][p2]),AdjGain),AdjGain),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b1[v1][v2] =  c1(v1s,v2s) +  b0(v1p,v2p) + AdjGain + AdjGain
+              if ((p1 != -1) && (v1IsRightChild) && (p2 != -1) && (v2IsRightChild) && ((event1[p1] == Spec)) && ((event2[p2] == Spec)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(C1[s1][s2],B0[p1][p2]),AdjGain),AdjGain),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b1[v1][v2] =  c0(v1s,v2) +  b0(v1p,v2) + AdjGain
+              if ((p1 != -1) && (v1IsRightChild) && ((event1[p1] == GDup)) && ((event2[j] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(C0[s1][j],B0[p1][j]),AdjGain),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[j]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b1[v1][v2] =  c0(v1s,v2) +  b0(v1p,v2) + AdjGain
+              if ((p1 != -1) && (v1IsLeftChild) && ((event1[p1] == GDup)) && ((event2[j] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(C0[s1][j],B0[p1][j]),AdjGain),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[j]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b1[v1][v2] =  c1(v1s,v2) +  b0(v1p,v2) + AdjGain + AdjGain
+              if ((p1 != -1) && (v1IsLeftChild) && ((event1[p1] == GDup)) && ((event2[j] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(C1[s1][j],B0[p1][j]),AdjGain),AdjGain),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[j]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b1[v1][v2] =  c1(v1s,v2) +  b0(v1p,v2) + AdjGain + AdjGain
+              if ((p1 != -1) && (v1IsRightChild) && ((event1[p1] == GDup)) && ((event2[j] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(C1[s1][j],B0[p1][j]),AdjGain),AdjGain),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[j]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b1[v1][v2] =  c0(v1,v2s) +  b0(v1,v2p) + AdjGain
+              if ((p2 != -1) && (v2IsRightChild) && ((event1[i] == GDup)) && ((event2[p2] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(C0[i][s2],B0[i][p2]),AdjGain),RESCALING_FACTOR((((event1[i]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b1[v1][v2] =  c0(v1,v2s) +  b0(v1,v2p) + AdjGain
+              if ((p2 != -1) && (v2IsLeftChild) && ((event1[i] == GDup)) && ((event2[p2] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(C0[i][s2],B0[i][p2]),AdjGain),RESCALING_FACTOR((((event1[i]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b1[v1][v2] =  c1(v1,v2s) +  b0(v1,v2p) + AdjGain + AdjGain
+              if ((p2 != -1) && (v2IsLeftChild) && ((event1[i] == GDup)) && ((event2[p2] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(C1[i][s2],B0[i][p2]),AdjGain),AdjGain),RESCALING_FACTOR((((event1[i]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b1[v1][v2] =  c1(v1,v2s) +  b0(v1,v2p) + AdjGain + AdjGain
+              if ((p2 != -1) && (v2IsRightChild) && ((event1[i] == GDup)) && ((event2[p2] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(C1[i][s2],B0[i][p2]),AdjGain),AdjGain),RESCALING_FACTOR((((event1[i]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b1[v1][v2] =  c0(v1,v2s) +  b1(v1,v2p)
+              if ((p2 != -1) && (v2IsRightChild) && ((event1[i] == Extant)||(event1[i] == Spec)) && ((event2[p2] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(C0[i][s2],B1[i][p2]),RESCALING_FACTOR((((event1[i]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b1[v1][v2] =  c0(v1,v2s) +  b1(v1,v2p)
+              if ((p2 != -1) && (v2IsLeftChild) && ((event1[i] == Extant)||(event1[i] == Spec)) && ((event2[p2] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(C0[i][s2],B1[i][p2]),RESCALING_FACTOR((((event1[i]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b1[v1][v2] =  c1(v1,v2s) +  b1(v1,v2p) + AdjGain
+              if ((p2 != -1) && (v2IsRightChild) && ((event1[i] == Extant)||(event1[i] == Spec)) && ((event2[p2] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(C1[i][s2],B1[i][p2]),AdjGain),RESCALING_FACTOR((((event1[i]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b1[v1][v2] =  c1(v1,v2s) +  b1(v1,v2p) + AdjGain
+              if ((p2 != -1) && (v2IsLeftChild) && ((event1[i] == Extant)||(event1[i] == Spec)) && ((event2[p2] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(C1[i][s2],B1[i][p2]),AdjGain),RESCALING_FACTOR((((event1[i]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b1[v1][v2] =  c0(v1s,v2) +  b1(v1p,v2)
+              if ((p1 != -1) && (v1IsLeftChild) && ((event1[p1] == GDup)) && ((event2[j] == Extant)||(event2[j] == Spec)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(C0[s1][j],B1[p1][j]),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[j]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b1[v1][v2] =  c0(v1s,v2) +  b1(v1p,v2)
+              if ((p1 != -1) && (v1IsRightChild) && ((event1[p1] == GDup)) && ((event2[j] == Extant)||(event2[j] == Spec)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(C0[s1][j],B1[p1][j]),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[j]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b1[v1][v2] =  c1(v1s,v2) +  b1(v1p,v2) + AdjGain
+              if ((p1 != -1) && (v1IsLeftChild) && ((event1[p1] == GDup)) && ((event2[j] == Extant)||(event2[j] == Spec)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(C1[s1][j],B1[p1][j]),AdjGain),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[j]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b1[v1][v2] =  c1(v1s,v2) +  b1(v1p,v2) + AdjGain
+              if ((p1 != -1) && (v1IsRightChild) && ((event1[p1] == GDup)) && ((event2[j] == Extant)||(event2[j] == Spec)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(C1[s1][j],B1[p1][j]),AdjGain),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[j]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b1[v1][v2] =  c1(v1s,v2s) +  b1(v1p,v2p)
+              if ((p1 != -1) && (v1IsLeftChild) && (p2 != -1) && (v2IsRightChild) && ((event1[p1] == Spec)) && ((event2[p2] == Spec)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(C1[s1][s2],B1[p1][p2]),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b1[v1][v2] =  c1(v1s,v2s) +  b1(v1p,v2p)
+              if ((p1 != -1) && (v1IsRightChild) && (p2 != -1) && (v2IsLeftChild) && ((event1[p1] == Spec)) && ((event2[p2] == Spec)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(C1[s1][s2],B1[p1][p2]),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b1[v1][v2] =  c0(v1s,v2s) +  b1(v1p,v2p) + AdjBreak
+              if ((p1 != -1) && (v1IsLeftChild) && (p2 != -1) && (v2IsRightChild) && ((event1[p1] == Spec)) && ((event2[p2] == Spec)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(C0[s1][s2],B1[p1][p2]),AdjBreak),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b1[v1][v2] =  c0(v1s,v2s) +  b1(v1p,v2p) + AdjBreak
+              if ((p1 != -1) && (v1IsRightChild) && (p2 != -1) && (v2IsLeftChild) && ((event1[p1] == Spec)) && ((event2[p2] == Spec)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(C0[s1][s2],B1[p1][p2]),AdjBreak),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b1[v1][v2] =  c1(v1s,v2s) +  b1(v1p,v2p)
+              if ((p1 != -1) && (v1IsLeftChild) && (p2 != -1) && (v2IsLeftChild) && ((event1[p1] == Spec)) && ((event2[p2] == Spec)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(C1[s1][s2],B1[p1][p2]),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b1[v1][v2] =  c1(v1s,v2s) +  b1(v1p,v2p)
+              if ((p1 != -1) && (v1IsRightChild) && (p2 != -1) && (v2IsRightChild) && ((event1[p1] == Spec)) && ((event2[p2] == Spec)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(C1[s1][s2],B1[p1][p2]),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b1[v1][v2] =  c0(v1s,v2s) +  b1(v1p,v2p) + AdjBreak
+              if ((p1 != -1) && (v1IsLeftChild) && (p2 != -1) && (v2IsLeftChild) && ((event1[p1] == Spec)) && ((event2[p2] == Spec)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(C0[s1][s2],B1[p1][p2]),AdjBreak),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b1[v1][v2] =  c0(v1s,v2s) +  b1(v1p,v2p) + AdjBreak
+              if ((p1 != -1) && (v1IsRightChild) && (p2 != -1) && (v2IsRightChild) && ((event1[p1] == Spec)) && ((event2[p2] == Spec)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(C0[s1][s2],B1[p1][p2]),AdjBreak),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b1[v1][v2] =  c0(v1s,v2) +  b1(v1p,v2)
+              if ((p1 != -1) && (v1IsLeftChild) && ((event1[p1] == GDup)) && ((event2[j] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(C0[s1][j],B1[p1][j]),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[j]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b1[v1][v2] =  c0(v1s,v2) +  b1(v1p,v2)
+              if ((p1 != -1) && (v1IsRightChild) && ((event1[p1] == GDup)) && ((event2[j] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(C0[s1][j],B1[p1][j]),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[j]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b1[v1][v2] =  c1(v1s,v2) +  b1(v1p,v2) + AdjGain
+              if ((p1 != -1) && (v1IsLeftChild) && ((event1[p1] == GDup)) && ((event2[j] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(C1[s1][j],B1[p1][j]),AdjGain),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[j]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b1[v1][v2] =  c1(v1s,v2) +  b1(v1p,v2) + AdjGain
+              if ((p1 != -1) && (v1IsRightChild) && ((event1[p1] == GDup)) && ((event2[j] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(C1[s1][j],B1[p1][j]),AdjGain),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[j]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b1[v1][v2] =  c0(v1,v2s) +  b1(v1,v2p)
+              if ((p2 != -1) && (v2IsLeftChild) && ((event1[i] == GDup)) && ((event2[p2] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(C0[i][s2],B1[i][p2]),RESCALING_FACTOR((((event1[i]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b1[v1][v2] =  c0(v1,v2s) +  b1(v1,v2p)
+              if ((p2 != -1) && (v2IsRightChild) && ((event1[i] == GDup)) && ((event2[p2] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(C0[i][s2],B1[i][p2]),RESCALING_FACTOR((((event1[i]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b1[v1][v2] =  c1(v1,v2s) +  b1(v1,v2p) + AdjGain
+              if ((p2 != -1) && (v2IsLeftChild) && ((event1[i] == GDup)) && ((event2[p2] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(C1[i][s2],B1[i][p2]),AdjGain),RESCALING_FACTOR((((event1[i]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b1[v1][v2] =  c1(v1,v2s) +  b1(v1,v2p) + AdjGain
+              if ((p2 != -1) && (v2IsRightChild) && ((event1[i] == GDup)) && ((event2[p2] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(C1[i][s2],B1[i][p2]),AdjGain),RESCALING_FACTOR((((event1[i]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b1[v1][v2] =  c1(v1s,v2s) + c0(v1,v2s) + c0(v1s,v2) +  b1(v1p,v2p)
+              if ((p1 != -1) && (v1IsLeftChild) && (p2 != -1) && (v2IsLeftChild) && ((event1[p1] == GDup)) && ((event2[p2] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(C1[s1][s2],C0[i][s2]),C0[s1][j]),B1[p1][p2]),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b1[v1][v2] =  c1(v1s,v2s) + c0(v1s,v2) + c0(v1,v2s) +  b1(v1p,v2p)
+              if ((p1 != -1) && (v1IsRightChild) && (p2 != -1) && (v2IsRightChild) && ((event1[p1] == GDup)) && ((event2[p2] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(C1[s1][s2],C0[s1][j]),C0[i][s2]),B1[p1][p2]),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b1[v1][v2] =  c1(v1s,v2s) + c0(v1,v2s) + c1(v1s,v2) +  b1(v1p,v2p) + AdjGain
+              if ((p1 != -1) && (v1IsLeftChild) && (p2 != -1) && (v2IsLeftChild) && ((event1[p1] == GDup)) && ((event2[p2] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(PLUS(C1[s1][s2],C0[i][s2]),C1[s1][j]),B1[p1][p2]),AdjGain),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b1[v1][v2] =  c1(v1s,v2s) + c0(v1s,v2) + c1(v1,v2s) +  b1(v1p,v2p) + AdjGain
+              if ((p1 != -1) && (v1IsRightChild) && (p2 != -1) && (v2IsRightChild) && ((event1[p1] == GDup)) && ((event2[p2] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(PLUS(C1[s1][s2],C0[s1][j]),C1[i][s2]),B1[p1][p2]),AdjGain),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b1[v1][v2] =  c1(v1s,v2) + c1(v1,v2s) + c0(v1s,v2s) +  b1(v1p,v2p) + AdjGain
+              if ((p1 != -1) && (v1IsRightChild) && (p2 != -1) && (v2IsLeftChild) && ((event1[p1] == GDup)) && ((event2[p2] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(PLUS(C1[s1][j],C1[i][s2]),C0[s1][s2]),B1[p1][p2]),AdjGain),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b1[v1][v2] =  c1(v1s,v2s) + c1(v1,v2s) + c0(v1s,v2) +  b1(v1p,v2p) + AdjGain
+              if ((p1 != -1) && (v1IsLeftChild) && (p2 != -1) && (v2IsLeftChild) && ((event1[p1] == GDup)) && ((event2[p2] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(PLUS(C1[s1][s2],C1[i][s2]),C0[s1][j]),B1[p1][p2]),AdjGain),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b1[v1][v2] =  c1(v1s,v2s) + c1(v1s,v2) + c0(v1,v2s) +  b1(v1p,v2p) + AdjGain
+              if ((p1 != -1) && (v1IsRightChild) && (p2 != -1) && (v2IsRightChild) && ((event1[p1] == GDup)) && ((event2[p2] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(PLUS(C1[s1][s2],C1[s1][j]),C0[i][s2]),B1[p1][p2]),AdjGain),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b1[v1][v2] =  c1(v1,v2s) + c1(v1s,v2) + c0(v1s,v2s) +  b1(v1p,v2p) + AdjGain
+              if ((p1 != -1) && (v1IsLeftChild) && (p2 != -1) && (v2IsRightChild) && ((event1[p1] == GDup)) && ((event2[p2] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(PLUS(C1[i][s2],C1[s1][j]),C0[s1][s2]),B1[p1][p2]),AdjGain),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b1[v1][v2] =  c1(v1s,v2s) + c1(v1,v2s) + c1(v1s,v2) +  b1(v1p,v2p) + AdjGain + AdjGain
+              if ((p1 != -1) && (v1IsLeftChild) && (p2 != -1) && (v2IsLeftChild) && ((event1[p1] == GDup)) && ((event2[p2] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(PLUS(PLUS(C1[s1][s2],C1[i][s2]),C1[s1][j]),B1[p1][p2]),AdjGain),AdjGain),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b1[v1][v2] =  c1(v1s,v2s) + c1(v1s,v2) + c1(v1,v2s) +  b1(v1p,v2p) + AdjGain + AdjGain
+              if ((p1 != -1) && (v1IsRightChild) && (p2 != -1) && (v2IsRightChild) && ((event1[p1] == GDup)) && ((event2[p2] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(PLUS(PLUS(C1[s1][s2],C1[s1][j]),C1[i][s2]),B1[p1][p2]),AdjGain),AdjGain),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b1[v1][v2] =  c1(v1,v2s) + c1(v1s,v2) + c1(v1s,v2s) +  b1(v1p,v2p) + AdjGain + AdjGain
+              if ((p1 != -1) && (v1IsLeftChild) && (p2 != -1) && (v2IsRightChild) && ((event1[p1] == GDup)) && ((event2[p2] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(PLUS(PLUS(C1[i][s2],C1[s1][j]),C1[s1][s2]),B1[p1][p2]),AdjGain),AdjGain),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b1[v1][v2] =  c1(v1s,v2) + c1(v1,v2s) + c1(v1s,v2s) +  b1(v1p,v2p) + AdjGain + AdjGain
+              if ((p1 != -1) && (v1IsRightChild) && (p2 != -1) && (v2IsLeftChild) && ((event1[p1] == GDup)) && ((event2[p2] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(PLUS(PLUS(C1[s1][j],C1[i][s2]),C1[s1][s2]),B1[p1][p2]),AdjGain),AdjGain),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b1[v1][v2] =  c0(v1s,v2s) + c0(v1,v2s) + c0(v1s,v2) +  b1(v1p,v2p) + AdjBreak
+              if ((p1 != -1) && (v1IsLeftChild) && (p2 != -1) && (v2IsLeftChild) && ((event1[p1] == GDup)) && ((event2[p2] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(PLUS(C0[s1][s2],C0[i][s2]),C0[s1][j]),B1[p1][p2]),AdjBreak),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b1[v1][v2] =  c0(v1s,v2s) + c0(v1,v2s) + c1(v1s,v2) +  b1(v1p,v2p) + AdjGain + AdjBreak
+              if ((p1 != -1) && (v1IsLeftChild) && (p2 != -1) && (v2IsLeftChild) && ((event1[p1] == GDup)) && ((event2[p2] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(PLUS(PLUS(C0[s1][s2],C0[i][s2]),C1[s1][j]),B1[p1][p2]),AdjGain),AdjBreak),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b1[v1][v2] =  c1(v1s,v2) + c0(v1,v2s) + c0(v1s,v2s) +  b1(v1p,v2p) + AdjGain + AdjBreak
+              if ((p1 != -1) && (v1IsRightChild) && (p2 != -1) && (v2IsLeftChild) && ((event1[p1] == GDup)) && ((event2[p2] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(PLUS(PLUS(C1[s1][j],C0[i][s2]),C0[s1][s2]),B1[p1][p2]),AdjGain),AdjBreak),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b1[v1][v2] =  c0(v1s,v2s) + c1(v1,v2s) + c0(v1s,v2) +  b1(v1p,v2p) + AdjGain + AdjBreak
+              if ((p1 != -1) && (v1IsLeftChild) && (p2 != -1) && (v2IsLeftChild) && ((event1[p1] == GDup)) && ((event2[p2] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(PLUS(PLUS(C0[s1][s2],C1[i][s2]),C0[s1][j]),B1[p1][p2]),AdjGain),AdjBreak),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b1[v1][v2] =  c1(v1,v2s) + c0(v1s,v2) + c0(v1s,v2s) +  b1(v1p,v2p) + AdjGain + AdjBreak
+              if ((p1 != -1) && (v1IsLeftChild) && (p2 != -1) && (v2IsRightChild) && ((event1[p1] == GDup)) && ((event2[p2] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(PLUS(PLUS(C1[i][s2],C0[s1][j]),C0[s1][s2]),B1[p1][p2]),AdjGain),AdjBreak),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b1[v1][v2] =  c0(v1s,v2s) + c0(v1s,v2) + c0(v1,v2s) +  b1(v1p,v2p) + AdjBreak
+              if ((p1 != -1) && (v1IsRightChild) && (p2 != -1) && (v2IsRightChild) && ((event1[p1] == GDup)) && ((event2[p2] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(PLUS(C0[s1][s2],C0[s1][j]),C0[i][s2]),B1[p1][p2]),AdjBreak),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b1[v1][v2] =  c0(v1s,v2s) + c0(v1s,v2) + c1(v1,v2s) +  b1(v1p,v2p) + AdjGain + AdjBreak
+              if ((p1 != -1) && (v1IsRightChild) && (p2 != -1) && (v2IsRightChild) && ((event1[p1] == GDup)) && ((event2[p2] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(PLUS(PLUS(C0[s1][s2],C0[s1][j]),C1[i][s2]),B1[p1][p2]),AdjGain),AdjBreak),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b1[v1][v2] =  c0(v1s,v2) + c1(v1,v2s) + c0(v1s,v2s) +  b1(v1p,v2p) + AdjGain + AdjBreak
+              if ((p1 != -1) && (v1IsRightChild) && (p2 != -1) && (v2IsLeftChild) && ((event1[p1] == GDup)) && ((event2[p2] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(PLUS(PLUS(C0[s1][j],C1[i][s2]),C0[s1][s2]),B1[p1][p2]),AdjGain),AdjBreak),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b1[v1][v2] =  c0(v1s,v2s) + c1(v1s,v2) + c0(v1,v2s) +  b1(v1p,v2p) + AdjGain + AdjBreak
+              if ((p1 != -1) && (v1IsRightChild) && (p2 != -1) && (v2IsRightChild) && ((event1[p1] == GDup)) && ((event2[p2] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(PLUS(PLUS(C0[s1][s2],C1[s1][j]),C0[i][s2]),B1[p1][p2]),AdjGain),AdjBreak),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b1[v1][v2] =  c0(v1,v2s) + c1(v1s,v2) + c0(v1s,v2s) +  b1(v1p,v2p) + AdjGain + AdjBreak
+              if ((p1 != -1) && (v1IsLeftChild) && (p2 != -1) && (v2IsRightChild) && ((event1[p1] == GDup)) && ((event2[p2] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(PLUS(PLUS(C0[i][s2],C1[s1][j]),C0[s1][s2]),B1[p1][p2]),AdjGain),AdjBreak),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b1[v1][v2] =  c0(v1,v2s) + c0(v1s,v2) + c1(v1s,v2s) +  b1(v1p,v2p)
+              if ((p1 != -1) && (v1IsLeftChild) && (p2 != -1) && (v2IsRightChild) && ((event1[p1] == GDup)) && ((event2[p2] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(C0[i][s2],C0[s1][j]),C1[s1][s2]),B1[p1][p2]),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b1[v1][v2] =  c0(v1s,v2) + c0(v1,v2s) + c1(v1s,v2s) +  b1(v1p,v2p)
+              if ((p1 != -1) && (v1IsRightChild) && (p2 != -1) && (v2IsLeftChild) && ((event1[p1] == GDup)) && ((event2[p2] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(C0[s1][j],C0[i][s2]),C1[s1][s2]),B1[p1][p2]),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b1[v1][v2] =  c0(v1s,v2s) + c1(v1s,v2) + c1(v1,v2s) +  b1(v1p,v2p) + AdjGain
+              if ((p1 != -1) && (v1IsRightChild) && (p2 != -1) && (v2IsRightChild) && ((event1[p1] == GDup)) && ((event2[p2] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(PLUS(C0[s1][s2],C1[s1][j]),C1[i][s2]),B1[p1][p2]),AdjGain),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b1[v1][v2] =  c0(v1,v2s) + c1(v1s,v2) + c1(v1s,v2s) +  b1(v1p,v2p) + AdjGain
+              if ((p1 != -1) && (v1IsLeftChild) && (p2 != -1) && (v2IsRightChild) && ((event1[p1] == GDup)) && ((event2[p2] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(PLUS(C0[i][s2],C1[s1][j]),C1[s1][s2]),B1[p1][p2]),AdjGain),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b1[v1][v2] =  c0(v1s,v2) + c1(v1,v2s) + c1(v1s,v2s) +  b1(v1p,v2p) + AdjGain
+              if ((p1 != -1) && (v1IsRightChild) && (p2 != -1) && (v2IsLeftChild) && ((event1[p1] == GDup)) && ((event2[p2] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(PLUS(C0[s1][j],C1[i][s2]),C1[s1][s2]),B1[p1][p2]),AdjGain),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b1[v1][v2] =  c0(v1s,v2s) + c1(v1,v2s) + c1(v1s,v2) +  b1(v1p,v2p) + AdjGain
+              if ((p1 != -1) && (v1IsLeftChild) && (p2 != -1) && (v2IsLeftChild) && ((event1[p1] == GDup)) && ((event2[p2] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(PLUS(C0[s1][s2],C1[i][s2]),C1[s1][j]),B1[p1][p2]),AdjGain),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b1[v1][v2] =  c1(v1,v2s) + c0(v1s,v2) + c1(v1s,v2s) +  b1(v1p,v2p) + AdjGain
+              if ((p1 != -1) && (v1IsLeftChild) && (p2 != -1) && (v2IsRightChild) && ((event1[p1] == GDup)) && ((event2[p2] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(PLUS(C1[i][s2],C0[s1][j]),C1[s1][s2]),B1[p1][p2]),AdjGain),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b1[v1][v2] =  c1(v1s,v2) + c0(v1,v2s) + c1(v1s,v2s) +  b1(v1p,v2p) + AdjGain
+              if ((p1 != -1) && (v1IsRightChild) && (p2 != -1) && (v2IsLeftChild) && ((event1[p1] == GDup)) && ((event2[p2] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(PLUS(C1[s1][j],C0[i][s2]),C1[s1][s2]),B1[p1][p2]),AdjGain),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b1[v1][v2] =  c0(v1,v2s) + c0(v1s,v2) + c0(v1s,v2s) +  b1(v1p,v2p) + AdjBreak
+              if ((p1 != -1) && (v1IsLeftChild) && (p2 != -1) && (v2IsRightChild) && ((event1[p1] == GDup)) && ((event2[p2] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(PLUS(C0[i][s2],C0[s1][j]),C0[s1][s2]),B1[p1][p2]),AdjBreak),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b1[v1][v2] =  c0(v1s,v2) + c0(v1,v2s) + c0(v1s,v2s) +  b1(v1p,v2p) + AdjBreak
+              if ((p1 != -1) && (v1IsRightChild) && (p2 != -1) && (v2IsLeftChild) && ((event1[p1] == GDup)) && ((event2[p2] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(PLUS(C0[s1][j],C0[i][s2]),C0[s1][s2]),B1[p1][p2]),AdjBreak),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              B1[i][j] = tmp;
+
+              tmp = INF;
+              if ((p1 == -1) && (p2 == -1))
+	      {
+		   tmp = ZERO;
+	      }
+              // b0[v1][v2] =  c0(v1,v2s) +  b0(v1,v2p)
+              if ((p2 != -1) && (v2IsRightChild) && ((event1[i] == Extant)||(event1[i] == Spec)) && ((event2[p2] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(C0[i][s2],B0[i][p2]),RESCALING_FACTOR((((event1[i]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b0[v1][v2] =  c0(v1,v2s) +  b0(v1,v2p)
+              if ((p2 != -1) && (v2IsLeftChild) && ((event1[i] == Extant)||(event1[i] == Spec)) && ((event2[p2] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(C0[i][s2],B0[i][p2]),RESCALING_FACTOR((((event1[i]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b0[v1][v2] =  c1(v1,v2s) +  b0(v1,v2p) + AdjGain
+              if ((p2 != -1) && (v2IsRightChild) && ((event1[i] == Extant)||(event1[i] == Spec)) && ((event2[p2] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(C1[i][s2],B0[i][p2]),AdjGain),RESCALING_FACTOR((((event1[i]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b0[v1][v2] =  c1(v1,v2s) +  b0(v1,v2p) + AdjGain
+              if ((p2 != -1) && (v2IsLeftChild) && ((event1[i] == Extant)||(event1[i] == Spec)) && ((event2[p2] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(C1[i][s2],B0[i][p2]),AdjGain),RESCALING_FACTOR((((event1[i]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b0[v1][v2] =  c0(v1s,v2) +  b0(v1p,v2)
+              if ((p1 != -1) && (v1IsLeftChild) && ((event1[p1] == GDup)) && ((event2[j] == Extant)||(event2[j] == Spec)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(C0[s1][j],B0[p1][j]),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[j]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b0[v1][v2] =  c0(v1s,v2) +  b0(v1p,v2)
+              if ((p1 != -1) && (v1IsRightChild) && ((event1[p1] == GDup)) && ((event2[j] == Extant)||(event2[j] == Spec)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(C0[s1][j],B0[p1][j]),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[j]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b0[v1][v2] =  c1(v1s,v2) +  b0(v1p,v2) + AdjGain
+              if ((p1 != -1) && (v1IsLeftChild) && ((event1[p1] == GDup)) && ((event2[j] == Extant)||(event2[j] == Spec)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(C1[s1][j],B0[p1][j]),AdjGain),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[j]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b0[v1][v2] =  c1(v1s,v2) +  b0(v1p,v2) + AdjGain
+              if ((p1 != -1) && (v1IsRightChild) && ((event1[p1] == GDup)) && ((event2[j] == Extant)||(event2[j] == Spec)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(C1[s1][j],B0[p1][j]),AdjGain),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[j]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b0[v1][v2] =  c0(v1s,v2s) +  b0(v1p,v2p)
+              if ((p1 != -1) && (v1IsLeftChild) && (p2 != -1) && (v2IsRightChild) && ((event1[p1] == Spec)) && ((event2[p2] == Spec)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(C0[s1][s2],B0[p1][p2]),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b0[v1][v2] =  c0(v1s,v2s) +  b0(v1p,v2p)
+              if ((p1 != -1) && (v1IsRightChild) && (p2 != -1) && (v2IsLeftChild) && ((event1[p1] == Spec)) && ((event2[p2] == Spec)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(C0[s1][s2],B0[p1][p2]),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b0[v1][v2] =  c1(v1s,v2s) +  b0(v1p,v2p) + AdjGain
+              if ((p1 != -1) && (v1IsRightChild) && (p2 != -1) && (v2IsLeftChild) && ((event1[p1] == Spec)) && ((event2[p2] == Spec)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(C1[s1][s2],B0[p1][p2]),AdjGain),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b0[v1][v2] =  c1(v1s,v2s) +  b0(v1p,v2p) + AdjGain
+              if ((p1 != -1) && (v1IsLeftChild) && (p2 != -1) && (v2IsRightChild) && ((event1[p1] == Spec)) && ((event2[p2] == Spec)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(C1[s1][s2],B0[p1][p2]),AdjGain),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b0[v1][v2] =  c0(v1s,v2s) +  b0(v1p,v2p)
+              if ((p1 != -1) && (v1IsLeftChild) && (p2 != -1) && (v2IsLeftChild) && ((event1[p1] == Spec)) && ((event2[p2] == Spec)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(C0[s1][s2],B0[p1][p2]),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b0[v1][v2] =  c0(v1s,v2s) +  b0(v1p,v2p)
+              if ((p1 != -1) && (v1IsRightChild) && (p2 != -1) && (v2IsRightChild) && ((event1[p1] == Spec)) && ((event2[p2] == Spec)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(C0[s1][s2],B0[p1][p2]),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b0[v1][v2] =  c1(v1s,v2s) +  b0(v1p,v2p) + AdjGain
+              if ((p1 != -1) && (v1IsRightChild) && (p2 != -1) && (v2IsRightChild) && ((event1[p1] == Spec)) && ((event2[p2] == Spec)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(C1[s1][s2],B0[p1][p2]),AdjGain),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b0[v1][v2] =  c1(v1s,v2s) +  b0(v1p,v2p) + AdjGain
+              if ((p1 != -1) && (v1IsLeftChild) && (p2 != -1) && (v2IsLeftChild) && ((event1[p1] == Spec)) && ((event2[p2] == Spec)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(C1[s1][s2],B0[p1][p2]),AdjGain),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b0[v1][v2] =  c0(v1s,v2) +  b0(v1p,v2)
+              if ((p1 != -1) && (v1IsLeftChild) && ((event1[p1] == GDup)) && ((event2[j] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(C0[s1][j],B0[p1][j]),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[j]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b0[v1][v2] =  c0(v1s,v2) +  b0(v1p,v2)
+              if ((p1 != -1) && (v1IsRightChild) && ((event1[p1] == GDup)) && ((event2[j] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(C0[s1][j],B0[p1][j]),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[j]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b0[v1][v2] =  c1(v1s,v2) +  b0(v1p,v2) + AdjGain
+              if ((p1 != -1) && (v1IsLeftChild) && ((event1[p1] == GDup)) && ((event2[j] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(C1[s1][j],B0[p1][j]),AdjGain),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[j]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b0[v1][v2] =  c1(v1s,v2) +  b0(v1p,v2) + AdjGain
+              if ((p1 != -1) && (v1IsRightChild) && ((event1[p1] == GDup)) && ((event2[j] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(C1[s1][j],B0[p1][j]),AdjGain),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[j]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b0[v1][v2] =  c0(v1,v2s) +  b0(v1,v2p)
+              if ((p2 != -1) && (v2IsLeftChild) && ((event1[i] == GDup)) && ((event2[p2] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(C0[i][s2],B0[i][p2]),RESCALING_FACTOR((((event1[i]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b0[v1][v2] =  c0(v1,v2s) +  b0(v1,v2p)
+              if ((p2 != -1) && (v2IsRightChild) && ((event1[i] == GDup)) && ((event2[p2] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(C0[i][s2],B0[i][p2]),RESCALING_FACTOR((((event1[i]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b0[v1][v2] =  c1(v1,v2s) +  b0(v1,v2p) + AdjGain
+              if ((p2 != -1) && (v2IsLeftChild) && ((event1[i] == GDup)) && ((event2[p2] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(C1[i][s2],B0[i][p2]),AdjGain),RESCALING_FACTOR((((event1[i]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b0[v1][v2] =  c1(v1,v2s) +  b0(v1,v2p) + AdjGain
+              if ((p2 != -1) && (v2IsRightChild) && ((event1[i] == GDup)) && ((event2[p2] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(C1[i][s2],B0[i][p2]),AdjGain),RESCALING_FACTOR((((event1[i]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b0[v1][v2] =  c1(v1,v2s) +  b1(v1,v2p)
+              if ((p2 != -1) && (v2IsLeftChild) && ((event1[i] == Extant)||(event1[i] == Spec)) && ((event2[p2] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(C1[i][s2],B1[i][p2]),RESCALING_FACTOR((((event1[i]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b0[v1][v2] =  c1(v1,v2s) +  b1(v1,v2p)
+              if ((p2 != -1) && (v2IsRightChild) && ((event1[i] == Extant)||(event1[i] == Spec)) && ((event2[p2] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(C1[i][s2],B1[i][p2]),RESCALING_FACTOR((((event1[i]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b0[v1][v2] =  c0(v1,v2s) +  b1(v1,v2p) + AdjBreak
+              if ((p2 != -1) && (v2IsRightChild) && ((event1[i] == Extant)||(event1[i] == Spec)) && ((event2[p2] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(C0[i][s2],B1[i][p2]),AdjBreak),RESCALING_FACTOR((((event1[i]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b0[v1][v2] =  c0(v1,v2s) +  b1(v1,v2p) + AdjBreak
+              if ((p2 != -1) && (v2IsLeftChild) && ((event1[i] == Extant)||(event1[i] == Spec)) && ((event2[p2] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(C0[i][s2],B1[i][p2]),AdjBreak),RESCALING_FACTOR((((event1[i]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b0[v1][v2] =  c1(v1s,v2) +  b1(v1p,v2)
+              if ((p1 != -1) && (v1IsRightChild) && ((event1[p1] == GDup)) && ((event2[j] == Extant)||(event2[j] == Spec)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(C1[s1][j],B1[p1][j]),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[j]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b0[v1][v2] =  c1(v1s,v2) +  b1(v1p,v2)
+              if ((p1 != -1) && (v1IsLeftChild) && ((event1[p1] == GDup)) && ((event2[j] == Extant)||(event2[j] == Spec)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(C1[s1][j],B1[p1][j]),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[j]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b0[v1][v2] =  c0(v1s,v2) +  b1(v1p,v2) + AdjBreak
+              if ((p1 != -1) && (v1IsLeftChild) && ((event1[p1] == GDup)) && ((event2[j] == Extant)||(event2[j] == Spec)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(C0[s1][j],B1[p1][j]),AdjBreak),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[j]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b0[v1][v2] =  c0(v1s,v2) +  b1(v1p,v2) + AdjBreak
+              if ((p1 != -1) && (v1IsRightChild) && ((event1[p1] == GDup)) && ((event2[j] == Extant)||(event2[j] == Spec)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(C0[s1][j],B1[p1][j]),AdjBreak),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[j]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b0[v1][v2] =  c1(v1s,v2s) +  b1(v1p,v2p) + AdjBreak
+              if ((p1 != -1) && (v1IsRightChild) && (p2 != -1) && (v2IsLeftChild) && ((event1[p1] == Spec)) && ((event2[p2] == Spec)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(C1[s1][s2],B1[p1][p2]),AdjBreak),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b0[v1][v2] =  c1(v1s,v2s) +  b1(v1p,v2p) + AdjBreak
+              if ((p1 != -1) && (v1IsLeftChild) && (p2 != -1) && (v2IsRightChild) && ((event1[p1] == Spec)) && ((event2[p2] == Spec)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(C1[s1][s2],B1[p1][p2]),AdjBreak),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b0[v1][v2] =  c0(v1s,v2s) +  b1(v1p,v2p) + AdjBreak + AdjBreak
+              if ((p1 != -1) && (v1IsLeftChild) && (p2 != -1) && (v2IsRightChild) && ((event1[p1] == Spec)) && ((event2[p2] == Spec)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(C0[s1][s2],B1[p1][p2]),AdjBreak),AdjBreak),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b0[v1][v2] =  c0(v1s,v2s) +  b1(v1p,v2p) + AdjBreak + AdjBreak
+              if ((p1 != -1) && (v1IsRightChild) && (p2 != -1) && (v2IsLeftChild) && ((event1[p1] == Spec)) && ((event2[p2] == Spec)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(C0[s1][s2],B1[p1][p2]),AdjBreak),AdjBreak),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b0[v1][v2] =  c1(v1s,v2s) +  b1(v1p,v2p) + AdjBreak
+              if ((p1 != -1) && (v1IsRightChild) && (p2 != -1) && (v2IsRightChild) && ((event1[p1] == Spec)) && ((event2[p2] == Spec)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(C1[s1][s2],B1[p1][p2]),AdjBreak),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b0[v1][v2] =  c1(v1s,v2s) +  b1(v1p,v2p) + AdjBreak
+              if ((p1 != -1) && (v1IsLeftChild) && (p2 != -1) && (v2IsLeftChild) && ((event1[p1] == Spec)) && ((event2[p2] == Spec)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(C1[s1][s2],B1[p1][p2]),AdjBreak),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b0[v1][v2] =  c0(v1s,v2s) +  b1(v1p,v2p) + AdjBreak + AdjBreak
+              if ((p1 != -1) && (v1IsLeftChild) && (p2 != -1) && (v2IsLeftChild) && ((event1[p1] == Spec)) && ((event2[p2] == Spec)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(C0[s1][s2],B1[p1][p2]),AdjBreak),AdjBreak),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b0[v1][v2] =  c0(v1s,v2s) +  b1(v1p,v2p) + AdjBreak + AdjBreak
+              if ((p1 != -1) && (v1IsRightChild) && (p2 != -1) && (v2IsRightChild) && ((event1[p1] == Spec)) && ((event2[p2] == Spec)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(C0[s1][s2],B1[p1][p2]),AdjBreak),AdjBreak),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b0[v1][v2] =  c1(v1s,v2) +  b1(v1p,v2)
+              if ((p1 != -1) && (v1IsRightChild) && ((event1[p1] == GDup)) && ((event2[j] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(C1[s1][j],B1[p1][j]),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[j]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b0[v1][v2] =  c1(v1s,v2) +  b1(v1p,v2)
+              if ((p1 != -1) && (v1IsLeftChild) && ((event1[p1] == GDup)) && ((event2[j] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(C1[s1][j],B1[p1][j]),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[j]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b0[v1][v2] =  c0(v1s,v2) +  b1(v1p,v2) + AdjBreak
+              if ((p1 != -1) && (v1IsLeftChild) && ((event1[p1] == GDup)) && ((event2[j] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(C0[s1][j],B1[p1][j]),AdjBreak),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[j]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b0[v1][v2] =  c0(v1s,v2) +  b1(v1p,v2) + AdjBreak
+              if ((p1 != -1) && (v1IsRightChild) && ((event1[p1] == GDup)) && ((event2[j] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(C0[s1][j],B1[p1][j]),AdjBreak),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[j]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b0[v1][v2] =  c1(v1,v2s) +  b1(v1,v2p)
+              if ((p2 != -1) && (v2IsRightChild) && ((event1[i] == GDup)) && ((event2[p2] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(C1[i][s2],B1[i][p2]),RESCALING_FACTOR((((event1[i]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b0[v1][v2] =  c1(v1,v2s) +  b1(v1,v2p)
+              if ((p2 != -1) && (v2IsLeftChild) && ((event1[i] == GDup)) && ((event2[p2] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(C1[i][s2],B1[i][p2]),RESCALING_FACTOR((((event1[i]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b0[v1][v2] =  c0(v1,v2s) +  b1(v1,v2p) + AdjBreak
+              if ((p2 != -1) && (v2IsLeftChild) && ((event1[i] == GDup)) && ((event2[p2] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(C0[i][s2],B1[i][p2]),AdjBreak),RESCALING_FACTOR((((event1[i]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b0[v1][v2] =  c0(v1,v2s) +  b1(v1,v2p) + AdjBreak
+              if ((p2 != -1) && (v2IsRightChild) && ((event1[i] == GDup)) && ((event2[p2] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(C0[i][s2],B1[i][p2]),AdjBreak),RESCALING_FACTOR((((event1[i]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b0[v1][v2] =  c1(v1,v2s) + c1(v1s,v2) + c0(v1s,v2s) +  b1(v1p,v2p)
+              if ((p1 != -1) && (v1IsLeftChild) && (p2 != -1) && (v2IsRightChild) && ((event1[p1] == GDup)) && ((event2[p2] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(C1[i][s2],C1[s1][j]),C0[s1][s2]),B1[p1][p2]),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b0[v1][v2] =  c1(v1s,v2) + c1(v1,v2s) + c0(v1s,v2s) +  b1(v1p,v2p)
+              if ((p1 != -1) && (v1IsRightChild) && (p2 != -1) && (v2IsLeftChild) && ((event1[p1] == GDup)) && ((event2[p2] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(C1[s1][j],C1[i][s2]),C0[s1][s2]),B1[p1][p2]),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b0[v1][v2] =  c1(v1,v2s) + c1(v1s,v2) + c1(v1s,v2s) +  b1(v1p,v2p) + AdjGain
+              if ((p1 != -1) && (v1IsLeftChild) && (p2 != -1) && (v2IsRightChild) && ((event1[p1] == GDup)) && ((event2[p2] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(PLUS(C1[i][s2],C1[s1][j]),C1[s1][s2]),B1[p1][p2]),AdjGain),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b0[v1][v2] =  c1(v1s,v2) + c1(v1,v2s) + c1(v1s,v2s) +  b1(v1p,v2p) + AdjGain
+              if ((p1 != -1) && (v1IsRightChild) && (p2 != -1) && (v2IsLeftChild) && ((event1[p1] == GDup)) && ((event2[p2] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(PLUS(C1[s1][j],C1[i][s2]),C1[s1][s2]),B1[p1][p2]),AdjGain),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b0[v1][v2] =  c1(v1s,v2s) + c0(v1s,v2) + c0(v1,v2s) +  b1(v1p,v2p) + AdjBreak
+              if ((p1 != -1) && (v1IsRightChild) && (p2 != -1) && (v2IsRightChild) && ((event1[p1] == GDup)) && ((event2[p2] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(PLUS(C1[s1][s2],C0[s1][j]),C0[i][s2]),B1[p1][p2]),AdjBreak),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b0[v1][v2] =  c1(v1,v2s) + c0(v1s,v2) + c0(v1s,v2s) +  b1(v1p,v2p) + AdjBreak
+              if ((p1 != -1) && (v1IsLeftChild) && (p2 != -1) && (v2IsRightChild) && ((event1[p1] == GDup)) && ((event2[p2] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(PLUS(C1[i][s2],C0[s1][j]),C0[s1][s2]),B1[p1][p2]),AdjBreak),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b0[v1][v2] =  c1(v1s,v2) + c0(v1,v2s) + c0(v1s,v2s) +  b1(v1p,v2p) + AdjBreak
+              if ((p1 != -1) && (v1IsRightChild) && (p2 != -1) && (v2IsLeftChild) && ((event1[p1] == GDup)) && ((event2[p2] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(PLUS(C1[s1][j],C0[i][s2]),C0[s1][s2]),B1[p1][p2]),AdjBreak),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b0[v1][v2] =  c1(v1s,v2s) + c0(v1s,v2) + c1(v1,v2s) +  b1(v1p,v2p) + AdjGain + AdjBreak
+              if ((p1 != -1) && (v1IsRightChild) && (p2 != -1) && (v2IsRightChild) && ((event1[p1] == GDup)) && ((event2[p2] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(PLUS(PLUS(C1[s1][s2],C0[s1][j]),C1[i][s2]),B1[p1][p2]),AdjGain),AdjBreak),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b0[v1][v2] =  c1(v1,v2s) + c0(v1s,v2) + c1(v1s,v2s) +  b1(v1p,v2p) + AdjGain + AdjBreak
+              if ((p1 != -1) && (v1IsLeftChild) && (p2 != -1) && (v2IsRightChild) && ((event1[p1] == GDup)) && ((event2[p2] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(PLUS(PLUS(C1[i][s2],C0[s1][j]),C1[s1][s2]),B1[p1][p2]),AdjGain),AdjBreak),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b0[v1][v2] =  c1(v1s,v2s) + c1(v1s,v2) + c0(v1,v2s) +  b1(v1p,v2p) + AdjGain + AdjBreak
+              if ((p1 != -1) && (v1IsRightChild) && (p2 != -1) && (v2IsRightChild) && ((event1[p1] == GDup)) && ((event2[p2] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(PLUS(PLUS(C1[s1][s2],C1[s1][j]),C0[i][s2]),B1[p1][p2]),AdjGain),AdjBreak),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b0[v1][v2] =  c1(v1s,v2) + c0(v1,v2s) + c1(v1s,v2s) +  b1(v1p,v2p) + AdjGain + AdjBreak
+              if ((p1 != -1) && (v1IsRightChild) && (p2 != -1) && (v2IsLeftChild) && ((event1[p1] == GDup)) && ((event2[p2] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(PLUS(PLUS(C1[s1][j],C0[i][s2]),C1[s1][s2]),B1[p1][p2]),AdjGain),AdjBreak),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b0[v1][v2] =  c1(v1s,v2s) + c0(v1,v2s) + c0(v1s,v2) +  b1(v1p,v2p) + AdjBreak
+              if ((p1 != -1) && (v1IsLeftChild) && (p2 != -1) && (v2IsLeftChild) && ((event1[p1] == GDup)) && ((event2[p2] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(PLUS(C1[s1][s2],C0[i][s2]),C0[s1][j]),B1[p1][p2]),AdjBreak),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b0[v1][v2] =  c0(v1,v2s) + c1(v1s,v2) + c0(v1s,v2s) +  b1(v1p,v2p) + AdjBreak
+              if ((p1 != -1) && (v1IsLeftChild) && (p2 != -1) && (v2IsRightChild) && ((event1[p1] == GDup)) && ((event2[p2] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(PLUS(C0[i][s2],C1[s1][j]),C0[s1][s2]),B1[p1][p2]),AdjBreak),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b0[v1][v2] =  c0(v1s,v2) + c1(v1,v2s) + c0(v1s,v2s) +  b1(v1p,v2p) + AdjBreak
+              if ((p1 != -1) && (v1IsRightChild) && (p2 != -1) && (v2IsLeftChild) && ((event1[p1] == GDup)) && ((event2[p2] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(PLUS(C0[s1][j],C1[i][s2]),C0[s1][s2]),B1[p1][p2]),AdjBreak),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b0[v1][v2] =  c1(v1s,v2s) + c0(v1,v2s) + c1(v1s,v2) +  b1(v1p,v2p) + AdjGain + AdjBreak
+              if ((p1 != -1) && (v1IsLeftChild) && (p2 != -1) && (v2IsLeftChild) && ((event1[p1] == GDup)) && ((event2[p2] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(PLUS(PLUS(C1[s1][s2],C0[i][s2]),C1[s1][j]),B1[p1][p2]),AdjGain),AdjBreak),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b0[v1][v2] =  c0(v1,v2s) + c1(v1s,v2) + c1(v1s,v2s) +  b1(v1p,v2p) + AdjGain + AdjBreak
+              if ((p1 != -1) && (v1IsLeftChild) && (p2 != -1) && (v2IsRightChild) && ((event1[p1] == GDup)) && ((event2[p2] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(PLUS(PLUS(C0[i][s2],C1[s1][j]),C1[s1][s2]),B1[p1][p2]),AdjGain),AdjBreak),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b0[v1][v2] =  c1(v1s,v2s) + c1(v1,v2s) + c0(v1s,v2) +  b1(v1p,v2p) + AdjGain + AdjBreak
+              if ((p1 != -1) && (v1IsLeftChild) && (p2 != -1) && (v2IsLeftChild) && ((event1[p1] == GDup)) && ((event2[p2] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(PLUS(PLUS(C1[s1][s2],C1[i][s2]),C0[s1][j]),B1[p1][p2]),AdjGain),AdjBreak),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b0[v1][v2] =  c0(v1s,v2) + c1(v1,v2s) + c1(v1s,v2s) +  b1(v1p,v2p) + AdjGain + AdjBreak
+              if ((p1 != -1) && (v1IsRightChild) && (p2 != -1) && (v2IsLeftChild) && ((event1[p1] == GDup)) && ((event2[p2] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(PLUS(PLUS(C0[s1][j],C1[i][s2]),C1[s1][s2]),B1[p1][p2]),AdjGain),AdjBreak),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b0[v1][v2] =  c0(v1s,v2s) + c1(v1,v2s) + c1(v1s,v2) +  b1(v1p,v2p)
+              if ((p1 != -1) && (v1IsLeftChild) && (p2 != -1) && (v2IsLeftChild) && ((event1[p1] == GDup)) && ((event2[p2] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(C0[s1][s2],C1[i][s2]),C1[s1][j]),B1[p1][p2]),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b0[v1][v2] =  c0(v1s,v2s) + c1(v1s,v2) + c1(v1,v2s) +  b1(v1p,v2p)
+              if ((p1 != -1) && (v1IsRightChild) && (p2 != -1) && (v2IsRightChild) && ((event1[p1] == GDup)) && ((event2[p2] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(C0[s1][s2],C1[s1][j]),C1[i][s2]),B1[p1][p2]),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b0[v1][v2] =  c1(v1s,v2s) + c1(v1,v2s) + c1(v1s,v2) +  b1(v1p,v2p) + AdjGain
+              if ((p1 != -1) && (v1IsLeftChild) && (p2 != -1) && (v2IsLeftChild) && ((event1[p1] == GDup)) && ((event2[p2] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(PLUS(C1[s1][s2],C1[i][s2]),C1[s1][j]),B1[p1][p2]),AdjGain),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b0[v1][v2] =  c1(v1s,v2s) + c1(v1s,v2) + c1(v1,v2s) +  b1(v1p,v2p) + AdjGain
+              if ((p1 != -1) && (v1IsRightChild) && (p2 != -1) && (v2IsRightChild) && ((event1[p1] == GDup)) && ((event2[p2] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(PLUS(C1[s1][s2],C1[s1][j]),C1[i][s2]),B1[p1][p2]),AdjGain),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b0[v1][v2] =  c0(v1s,v2s) + c1(v1,v2s) + c0(v1s,v2) +  b1(v1p,v2p) + AdjBreak
+              if ((p1 != -1) && (v1IsLeftChild) && (p2 != -1) && (v2IsLeftChild) && ((event1[p1] == GDup)) && ((event2[p2] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(PLUS(C0[s1][s2],C1[i][s2]),C0[s1][j]),B1[p1][p2]),AdjBreak),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b0[v1][v2] =  c0(v1s,v2s) + c1(v1s,v2) + c0(v1,v2s) +  b1(v1p,v2p) + AdjBreak
+              if ((p1 != -1) && (v1IsRightChild) && (p2 != -1) && (v2IsRightChild) && ((event1[p1] == GDup)) && ((event2[p2] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(PLUS(C0[s1][s2],C1[s1][j]),C0[i][s2]),B1[p1][p2]),AdjBreak),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b0[v1][v2] =  c0(v1s,v2) + c0(v1,v2s) + c1(v1s,v2s) +  b1(v1p,v2p) + AdjBreak
+              if ((p1 != -1) && (v1IsRightChild) && (p2 != -1) && (v2IsLeftChild) && ((event1[p1] == GDup)) && ((event2[p2] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(PLUS(C0[s1][j],C0[i][s2]),C1[s1][s2]),B1[p1][p2]),AdjBreak),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b0[v1][v2] =  c0(v1s,v2s) + c0(v1,v2s) + c1(v1s,v2) +  b1(v1p,v2p) + AdjBreak
+              if ((p1 != -1) && (v1IsLeftChild) && (p2 != -1) && (v2IsLeftChild) && ((event1[p1] == GDup)) && ((event2[p2] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(PLUS(C0[s1][s2],C0[i][s2]),C1[s1][j]),B1[p1][p2]),AdjBreak),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b0[v1][v2] =  c0(v1s,v2s) + c0(v1s,v2) + c1(v1,v2s) +  b1(v1p,v2p) + AdjBreak
+              if ((p1 != -1) && (v1IsRightChild) && (p2 != -1) && (v2IsRightChild) && ((event1[p1] == GDup)) && ((event2[p2] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(PLUS(C0[s1][s2],C0[s1][j]),C1[i][s2]),B1[p1][p2]),AdjBreak),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b0[v1][v2] =  c0(v1,v2s) + c0(v1s,v2) + c1(v1s,v2s) +  b1(v1p,v2p) + AdjBreak
+              if ((p1 != -1) && (v1IsLeftChild) && (p2 != -1) && (v2IsRightChild) && ((event1[p1] == GDup)) && ((event2[p2] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(PLUS(C0[i][s2],C0[s1][j]),C1[s1][s2]),B1[p1][p2]),AdjBreak),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b0[v1][v2] =  c0(v1s,v2s) + c0(v1,v2s) + c0(v1s,v2) +  b1(v1p,v2p) + AdjBreak + AdjBreak
+              if ((p1 != -1) && (v1IsLeftChild) && (p2 != -1) && (v2IsLeftChild) && ((event1[p1] == GDup)) && ((event2[p2] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(PLUS(PLUS(C0[s1][s2],C0[i][s2]),C0[s1][j]),B1[p1][p2]),AdjBreak),AdjBreak),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b0[v1][v2] =  c0(v1s,v2s) + c0(v1s,v2) + c0(v1,v2s) +  b1(v1p,v2p) + AdjBreak + AdjBreak
+              if ((p1 != -1) && (v1IsRightChild) && (p2 != -1) && (v2IsRightChild) && ((event1[p1] == GDup)) && ((event2[p2] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(PLUS(PLUS(C0[s1][s2],C0[s1][j]),C0[i][s2]),B1[p1][p2]),AdjBreak),AdjBreak),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b0[v1][v2] =  c0(v1,v2s) + c0(v1s,v2) + c0(v1s,v2s) +  b1(v1p,v2p) + AdjBreak + AdjBreak
+              if ((p1 != -1) && (v1IsLeftChild) && (p2 != -1) && (v2IsRightChild) && ((event1[p1] == GDup)) && ((event2[p2] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(PLUS(PLUS(C0[i][s2],C0[s1][j]),C0[s1][s2]),B1[p1][p2]),AdjBreak),AdjBreak),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              // b0[v1][v2] =  c0(v1s,v2) + c0(v1,v2s) + c0(v1s,v2s) +  b1(v1p,v2p) + AdjBreak + AdjBreak
+              if ((p1 != -1) && (v1IsRightChild) && (p2 != -1) && (v2IsLeftChild) && ((event1[p1] == GDup)) && ((event2[p2] == GDup)))
+              {
+                  tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(PLUS(PLUS(C0[s1][j],C0[i][s2]),C0[s1][s2]),B1[p1][p2]),AdjBreak),AdjBreak),RESCALING_FACTOR((((event1[p1]!=GDup)&&(event2[p2]!=GDup))?1:0))), "COMMENT", false, v1->getND(), v2->getND());
+              }
+              B0[i][j] = tmp;
+
+
+            }
+	}
+    }
+
+    RESULT_TYPE*** W = new RESULT_TYPE**[t1->size()];
+    for(int i=0;i<t1->size();i++) 
+    { 
+      W[i] = new RESULT_TYPE*[t2->size()]; 
+      for(int j=0;j<t2->size();j++) 
+      { 
+        W[i][j] = new RESULT_TYPE[72]; 
+        for(int k=0;k<72;k++)
+        {
+            W[i][j][k] = INF;
+        }
+      }
+    }
+    for(int i=0;i<Dfo1.size();i++) 
+    {
+	RecTree * v1 = Dfo1[i];
+	for(int j=0;j<Dfo2.size();j++) 
+	{
+            RESULT_TYPE tmp;
+	    RecTree * v2 = Dfo2[j];
+            if (!sameSpecies(v1,v2))
+            {
+                for(int k=0;k<72;k++)
+                {
+                    W[i][j][k] = INF;
+                }
+            }
+            else
+            {
+              EventType t1 = event1[i];
+              EventType t2 = event2[j];
+              int a1 = (v1->getLeft()?  v1->getLeft()->getIndex():-1);
+              int b1 = (v1->getRight()? v1->getRight()->getIndex():-1);
+              int a2 = (v2->getLeft()?  v2->getLeft()->getIndex():-1);
+              int b2 = (v2->getRight()? v2->getRight()->getIndex():-1);
+
+              if (((t1==Extant)) && ((t2==Extant)))
+              {
+                 W[i][j][C0_EXTANT_EXTANT]
+                     = PLUS(PLUS(IsntAdj(v1,v2,adjacencies),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))),B0[i][j]);
+              }
+              if (((t1==GLos)) && ((t2==Extant) || (t2==Spec) || (t2==GDup)))
+              {
+                 W[i][j][C0_GLOS_ESG]
+                     = PLUS(PLUS(ZERO,RESCALING_FACTOR((v1->numNonGDup() + v2->numNonGDup() - 1))),B0[i][j]);
+              }
+              if (((t1==Extant) || (t1==Spec) || (t1==GDup)) && ((t2==GLos)))
+              {
+                 W[i][j][C0_ESG_GLOS]
+                     = PLUS(PLUS(ZERO,RESCALING_FACTOR((v1->numNonGDup() + v2->numNonGDup() - 1))),B0[i][j]);
+              }
+              if (((t1==GLos)) && ((t2==GLos)))
+              {
+                 W[i][j][C0_GLOS_GLOS]
+                     = PLUS(PLUS(ZERO,RESCALING_FACTOR((v1->numNonGDup() + v2->numNonGDup() - 1))),B0[i][j]);
+              }
+              if (((t1==Extant) || (t1==Spec)) && ((t2==GDup)) && (a2 != -1) && (b2 != -1))
+              {
+                 W[i][j][C0_ES_GDUP_C0V1V2A_C0V1V2B]
+                     = PLUS(PLUS(PLUS(C0[i][b2],C0[i][a2]),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))),B0[i][j]);
+              }
+              if (((t1==Extant) || (t1==Spec)) && ((t2==GDup)) && (a2 != -1) && (b2 != -1))
+              {
+                 W[i][j][C0_ES_GDUP_C0V1V2B_C1V1V2A]
+                     = PLUS(PLUS(PLUS(PLUS(C0[i][b2],C1[i][a2]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))),B0[i][j]);
+              }
+              if (((t1==Extant) || (t1==Spec)) && ((t2==GDup)) && (a2 != -1) && (b2 != -1))
+              {
+                 W[i][j][C0_ES_GDUP_C0V1V2A_C1V1V2B]
+                     = PLUS(PLUS(PLUS(PLUS(C1[i][b2],C0[i][a2]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))),B0[i][j]);
+              }
+              if (((t1==Extant) || (t1==Spec)) && ((t2==GDup)) && (a2 != -1) && (b2 != -1))
+              {
+                 W[i][j][C0_ES_GDUP_C1V1V2A_C1V1V2B]
+                     = PLUS(PLUS(PLUS(PLUS(PLUS(C1[i][b2],C1[i][a2]),AdjGain),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))),B0[i][j]);
+              }
+              if (((t1==GDup)) && ((t2==Extant) || (t2==Spec)) && (a1 != -1) && (b1 != -1))
+              {
+                 W[i][j][C0_GDUP_ES_C0V1AV2_C0V1BV2]
+                     = PLUS(PLUS(PLUS(C0[a1][j],C0[b1][j]),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))),B0[i][j]);
+              }
+              if (((t1==GDup)) && ((t2==Extant) || (t2==Spec)) && (a1 != -1) && (b1 != -1))
+              {
+                 W[i][j][C0_GDUP_ES_C0V1AV2_C1V1BV2]
+                     = PLUS(PLUS(PLUS(PLUS(C0[a1][j],C1[b1][j]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))),B0[i][j]);
+              }
+              if (((t1==GDup)) && ((t2==Extant) || (t2==Spec)) && (a1 != -1) && (b1 != -1))
+              {
+                 W[i][j][C0_GDUP_ES_C0V1BV2_C1V1AV2]
+                     = PLUS(PLUS(PLUS(PLUS(C1[a1][j],C0[b1][j]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))),B0[i][j]);
+              }
+              if (((t1==GDup)) && ((t2==Extant) || (t2==Spec)) && (a1 != -1) && (b1 != -1))
+              {
+                 W[i][j][C0_GDUP_ES_C1V1AV2_C1V1BV2]
+                     = PLUS(PLUS(PLUS(PLUS(PLUS(C1[a1][j],C1[b1][j]),AdjGain),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))),B0[i][j]);
+              }
+              if (((t1==Spec)) && ((t2==Spec)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+              {
+                 W[i][j][C0_SPEC_SPEC_C0V1AV2B_C0V1BV2A]
+                     = PLUS(PLUS(PLUS(C0[a1][b2],C0[b1][a2]),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))),B0[i][j]);
+              }
+              if (((t1==Spec)) && ((t2==Spec)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+              {
+                 W[i][j][C0_SPEC_SPEC_C0V1BV2A_C1V1AV2B]
+                     = PLUS(PLUS(PLUS(PLUS(C1[a1][b2],C0[b1][a2]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))),B0[i][j]);
+              }
+              if (((t1==Spec)) && ((t2==Spec)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+              {
+                 W[i][j][C0_SPEC_SPEC_C0V1AV2B_C1V1BV2A]
+                     = PLUS(PLUS(PLUS(PLUS(C0[a1][b2],C1[b1][a2]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))),B0[i][j]);
+              }
+              if (((t1==Spec)) && ((t2==Spec)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+              {
+                 W[i][j][C0_SPEC_SPEC_C1V1AV2B_C1V1BV2A]
+                     = PLUS(PLUS(PLUS(PLUS(PLUS(C1[a1][b2],C1[b1][a2]),AdjGain),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))),B0[i][j]);
+              }
+              if (((t1==Spec)) && ((t2==Spec)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+              {
+                 W[i][j][C0_SPEC_SPEC_C0V1AV2A_C0V1BV2B]
+                     = PLUS(PLUS(PLUS(C0[a1][a2],C0[b1][b2]),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))),B0[i][j]);
+              }
+              if (((t1==Spec)) && ((t2==Spec)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+              {
+                 W[i][j][C0_SPEC_SPEC_C0V1BV2B_C1V1AV2A]
+                     = PLUS(PLUS(PLUS(PLUS(C1[a1][a2],C0[b1][b2]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))),B0[i][j]);
+              }
+              if (((t1==Spec)) && ((t2==Spec)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+              {
+                 W[i][j][C0_SPEC_SPEC_C0V1AV2A_C1V1BV2B]
+                     = PLUS(PLUS(PLUS(PLUS(C0[a1][a2],C1[b1][b2]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))),B0[i][j]);
+              }
+              if (((t1==Spec)) && ((t2==Spec)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+              {
+                 W[i][j][C0_SPEC_SPEC_C1V1AV2A_C1V1BV2B]
+                     = PLUS(PLUS(PLUS(PLUS(PLUS(C1[a1][a2],C1[b1][b2]),AdjGain),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))),B0[i][j]);
+              }
+              if (((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1))
+              {
+                 W[i][j][C0_GDUP_GDUP_C0V1AV2_C0V1BV2]
+                     = PLUS(PLUS(PLUS(C0[a1][j],C0[b1][j]),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))),B0[i][j]);
+              }
+              if (((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1))
+              {
+                 W[i][j][C0_GDUP_GDUP_C0V1AV2_C1V1BV2]
+                     = PLUS(PLUS(PLUS(PLUS(C0[a1][j],C1[b1][j]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))),B0[i][j]);
+              }
+              if (((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1))
+              {
+                 W[i][j][C0_GDUP_GDUP_C0V1BV2_C1V1AV2]
+                     = PLUS(PLUS(PLUS(PLUS(C1[a1][j],C0[b1][j]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))),B0[i][j]);
+              }
+              if (((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1))
+              {
+                 W[i][j][C0_GDUP_GDUP_C1V1AV2_C1V1BV2]
+                     = PLUS(PLUS(PLUS(PLUS(PLUS(C1[a1][j],C1[b1][j]),AdjGain),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))),B0[i][j]);
+              }
+              if (((t1==GDup)) && ((t2==GDup)) && (a2 != -1) && (b2 != -1))
+              {
+                 W[i][j][C0_GDUP_GDUP_C0V1V2A_C0V1V2B]
+                     = PLUS(PLUS(PLUS(C0[i][a2],C0[i][b2]),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))),B0[i][j]);
+              }
+              if (((t1==GDup)) && ((t2==GDup)) && (a2 != -1) && (b2 != -1))
+              {
+                 W[i][j][C0_GDUP_GDUP_C0V1V2A_C1V1V2B]
+                     = PLUS(PLUS(PLUS(PLUS(C0[i][a2],C1[i][b2]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))),B0[i][j]);
+              }
+              if (((t1==GDup)) && ((t2==GDup)) && (a2 != -1) && (b2 != -1))
+              {
+                 W[i][j][C0_GDUP_GDUP_C0V1V2B_C1V1V2A]
+                     = PLUS(PLUS(PLUS(PLUS(C1[i][a2],C0[i][b2]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))),B0[i][j]);
+              }
+              if (((t1==GDup)) && ((t2==GDup)) && (a2 != -1) && (b2 != -1))
+              {
+                 W[i][j][C0_GDUP_GDUP_C1V1V2A_C1V1V2B]
+                     = PLUS(PLUS(PLUS(PLUS(PLUS(C1[i][a2],C1[i][b2]),AdjGain),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))),B0[i][j]);
+              }
+              if (((t1==Extant)) && ((t2==Extant)))
+              {
+                 W[i][j][C1_EXTANT_EXTANT]
+                     = PLUS(PLUS(IsAdj(v1,v2,adjacencies),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))),B1[i][j]);
+              }
+              if (((t1==GLos)) && ((t2==Extant) || (t2==Spec) || (t2==GDup)))
+              {
+                 W[i][j][C1_GLOS_ESG]
+                     = PLUS(PLUS(ZERO,RESCALING_FACTOR((v1->numNonGDup() + v2->numNonGDup() - 1))),B1[i][j]);
+              }
+              if (((t1==Extant) || (t1==Spec) || (t1==GDup)) && ((t2==GLos)))
+              {
+                 W[i][j][C1_ESG_GLOS]
+                     = PLUS(PLUS(ZERO,RESCALING_FACTOR((v1->numNonGDup() + v2->numNonGDup() - 1))),B1[i][j]);
+              }
+              if (((t1==GLos)) && ((t2==GLos)))
+              {
+                 W[i][j][C1_GLOS_GLOS]
+                     = PLUS(PLUS(ZERO,RESCALING_FACTOR((v1->numNonGDup() + v2->numNonGDup() - 1))),B1[i][j]);
+              }
+              if (((t1==Extant) || (t1==Spec)) && ((t2==GDup)) && (a2 != -1) && (b2 != -1))
+              {
+                 W[i][j][C1_ES_GDUP_C0V1V2A_C1V1V2B]
+                     = PLUS(PLUS(PLUS(C1[i][b2],C0[i][a2]),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))),B1[i][j]);
+              }
+              if (((t1==Extant) || (t1==Spec)) && ((t2==GDup)) && (a2 != -1) && (b2 != -1))
+              {
+                 W[i][j][C1_ES_GDUP_C0V1V2B_C1V1V2A]
+                     = PLUS(PLUS(PLUS(C0[i][b2],C1[i][a2]),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))),B1[i][j]);
+              }
+              if (((t1==Extant) || (t1==Spec)) && ((t2==GDup)) && (a2 != -1) && (b2 != -1))
+              {
+                 W[i][j][C1_ES_GDUP_C1V1V2A_C1V1V2B]
+                     = PLUS(PLUS(PLUS(PLUS(C1[i][b2],C1[i][a2]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))),B1[i][j]);
+              }
+              if (((t1==Extant) || (t1==Spec)) && ((t2==GDup)) && (a2 != -1) && (b2 != -1))
+              {
+                 W[i][j][C1_ES_GDUP_C0V1V2A_C0V1V2B]
+                     = PLUS(PLUS(PLUS(PLUS(C0[i][b2],C0[i][a2]),AdjBreak),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))),B1[i][j]);
+              }
+              if (((t1==GDup)) && ((t2==Extant) || (t2==Spec)) && (a1 != -1) && (b1 != -1))
+              {
+                 W[i][j][C1_GDUP_ES_C0V1BV2_C1V1AV2]
+                     = PLUS(PLUS(PLUS(C1[a1][j],C0[b1][j]),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))),B1[i][j]);
+              }
+              if (((t1==GDup)) && ((t2==Extant) || (t2==Spec)) && (a1 != -1) && (b1 != -1))
+              {
+                 W[i][j][C1_GDUP_ES_C0V1AV2_C1V1BV2]
+                     = PLUS(PLUS(PLUS(C0[a1][j],C1[b1][j]),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))),B1[i][j]);
+              }
+              if (((t1==GDup)) && ((t2==Extant) || (t2==Spec)) && (a1 != -1) && (b1 != -1))
+              {
+                 W[i][j][C1_GDUP_ES_C1V1AV2_C1V1BV2]
+                     = PLUS(PLUS(PLUS(PLUS(C1[a1][j],C1[b1][j]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))),B1[i][j]);
+              }
+              if (((t1==GDup)) && ((t2==Extant) || (t2==Spec)) && (a1 != -1) && (b1 != -1))
+              {
+                 W[i][j][C1_GDUP_ES_C0V1AV2_C0V1BV2]
+                     = PLUS(PLUS(PLUS(PLUS(C0[a1][j],C0[b1][j]),AdjBreak),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))),B1[i][j]);
+              }
+              if (((t1==Spec)) && ((t2==Spec)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+              {
+                 W[i][j][C1_SPEC_SPEC_C1V1AV2B_C1V1BV2A]
+                     = PLUS(PLUS(PLUS(C1[a1][b2],C1[b1][a2]),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))),B1[i][j]);
+              }
+              if (((t1==Spec)) && ((t2==Spec)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+              {
+                 W[i][j][C1_SPEC_SPEC_C0V1BV2A_C1V1AV2B]
+                     = PLUS(PLUS(PLUS(PLUS(C1[a1][b2],C0[b1][a2]),AdjBreak),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))),B1[i][j]);
+              }
+              if (((t1==Spec)) && ((t2==Spec)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+              {
+                 W[i][j][C1_SPEC_SPEC_C0V1AV2B_C1V1BV2A]
+                     = PLUS(PLUS(PLUS(PLUS(C0[a1][b2],C1[b1][a2]),AdjBreak),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))),B1[i][j]);
+              }
+              if (((t1==Spec)) && ((t2==Spec)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+              {
+                 W[i][j][C1_SPEC_SPEC_C0V1AV2B_C0V1BV2A]
+                     = PLUS(PLUS(PLUS(PLUS(PLUS(C0[a1][b2],C0[b1][a2]),AdjBreak),AdjBreak),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))),B1[i][j]);
+              }
+              if (((t1==Spec)) && ((t2==Spec)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+              {
+                 W[i][j][C1_SPEC_SPEC_C1V1AV2A_C1V1BV2B]
+                     = PLUS(PLUS(PLUS(C1[a1][a2],C1[b1][b2]),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))),B1[i][j]);
+              }
+              if (((t1==Spec)) && ((t2==Spec)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+              {
+                 W[i][j][C1_SPEC_SPEC_C0V1BV2B_C1V1AV2A]
+                     = PLUS(PLUS(PLUS(PLUS(C1[a1][a2],C0[b1][b2]),AdjBreak),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))),B1[i][j]);
+              }
+              if (((t1==Spec)) && ((t2==Spec)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+              {
+                 W[i][j][C1_SPEC_SPEC_C0V1AV2A_C1V1BV2B]
+                     = PLUS(PLUS(PLUS(PLUS(C0[a1][a2],C1[b1][b2]),AdjBreak),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))),B1[i][j]);
+              }
+              if (((t1==Spec)) && ((t2==Spec)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+              {
+                 W[i][j][C1_SPEC_SPEC_C0V1AV2A_C0V1BV2B]
+                     = PLUS(PLUS(PLUS(PLUS(PLUS(C0[a1][a2],C0[b1][b2]),AdjBreak),AdjBreak),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))),B1[i][j]);
+              }
+              if (((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1))
+              {
+                 W[i][j][C1_GDUP_GDUP_C0V1BV2_C1V1AV2]
+                     = PLUS(PLUS(PLUS(C1[a1][j],C0[b1][j]),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))),B1[i][j]);
+              }
+              if (((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1))
+              {
+                 W[i][j][C1_GDUP_GDUP_C0V1AV2_C1V1BV2]
+                     = PLUS(PLUS(PLUS(C0[a1][j],C1[b1][j]),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))),B1[i][j]);
+              }
+              if (((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1))
+              {
+                 W[i][j][C1_GDUP_GDUP_C1V1AV2_C1V1BV2]
+                     = PLUS(PLUS(PLUS(PLUS(C1[a1][j],C1[b1][j]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))),B1[i][j]);
+              }
+              if (((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1))
+              {
+                 W[i][j][C1_GDUP_GDUP_C0V1AV2_C0V1BV2]
+                     = PLUS(PLUS(PLUS(PLUS(C0[a1][j],C0[b1][j]),AdjBreak),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))),B1[i][j]);
+              }
+              if (((t1==GDup)) && ((t2==GDup)) && (a2 != -1) && (b2 != -1))
+              {
+                 W[i][j][C1_GDUP_GDUP_C0V1V2B_C1V1V2A]
+                     = PLUS(PLUS(PLUS(C1[i][a2],C0[i][b2]),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))),B1[i][j]);
+              }
+              if (((t1==GDup)) && ((t2==GDup)) && (a2 != -1) && (b2 != -1))
+              {
+                 W[i][j][C1_GDUP_GDUP_C0V1V2A_C1V1V2B]
+                     = PLUS(PLUS(PLUS(C0[i][a2],C1[i][b2]),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))),B1[i][j]);
+              }
+              if (((t1==GDup)) && ((t2==GDup)) && (a2 != -1) && (b2 != -1))
+              {
+                 W[i][j][C1_GDUP_GDUP_C1V1V2A_C1V1V2B]
+                     = PLUS(PLUS(PLUS(PLUS(C1[i][a2],C1[i][b2]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))),B1[i][j]);
+              }
+              if (((t1==GDup)) && ((t2==GDup)) && (a2 != -1) && (b2 != -1))
+              {
+                 W[i][j][C1_GDUP_GDUP_C0V1V2A_C0V1V2B]
+                     = PLUS(PLUS(PLUS(PLUS(C0[i][a2],C0[i][b2]),AdjBreak),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))),B1[i][j]);
+              }
+              if (((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+              {
+                 W[i][j][C1_GDUP_GDUP_C0V1AV2B_C0V1BV2A_C1V1AV2A_C1V1BV2B]
+                     = PLUS(PLUS(PLUS(PLUS(PLUS(C1[a1][a2],C1[b1][b2]),C0[a1][b2]),C0[b1][a2]),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))),B1[i][j]);
+              }
+              if (((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+              {
+                 W[i][j][C1_GDUP_GDUP_C0V1AV2B_C1V1AV2A_C1V1BV2A_C1V1BV2B]
+                     = PLUS(PLUS(PLUS(PLUS(PLUS(PLUS(C1[a1][a2],C1[b1][b2]),C0[a1][b2]),C1[b1][a2]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))),B1[i][j]);
+              }
+              if (((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+              {
+                 W[i][j][C1_GDUP_GDUP_C0V1BV2A_C1V1AV2A_C1V1AV2B_C1V1BV2B]
+                     = PLUS(PLUS(PLUS(PLUS(PLUS(PLUS(C1[a1][a2],C1[b1][b2]),C1[a1][b2]),C0[b1][a2]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))),B1[i][j]);
+              }
+              if (((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+              {
+                 W[i][j][C1_GDUP_GDUP_C1V1AV2A_C1V1AV2B_C1V1BV2A_C1V1BV2B]
+                     = PLUS(PLUS(PLUS(PLUS(PLUS(PLUS(PLUS(C1[a1][a2],C1[b1][b2]),C1[a1][b2]),C1[b1][a2]),AdjGain),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))),B1[i][j]);
+              }
+              if (((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+              {
+                 W[i][j][C1_GDUP_GDUP_C0V1AV2B_C0V1BV2A_C0V1BV2B_C1V1AV2A]
+                     = PLUS(PLUS(PLUS(PLUS(PLUS(PLUS(C1[a1][a2],C0[b1][b2]),C0[a1][b2]),C0[b1][a2]),AdjBreak),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))),B1[i][j]);
+              }
+              if (((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+              {
+                 W[i][j][C1_GDUP_GDUP_C0V1AV2B_C0V1BV2B_C1V1AV2A_C1V1BV2A]
+                     = PLUS(PLUS(PLUS(PLUS(PLUS(PLUS(PLUS(C1[a1][a2],C0[b1][b2]),C0[a1][b2]),C1[b1][a2]),AdjGain),AdjBreak),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))),B1[i][j]);
+              }
+              if (((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+              {
+                 W[i][j][C1_GDUP_GDUP_C0V1BV2A_C0V1BV2B_C1V1AV2A_C1V1AV2B]
+                     = PLUS(PLUS(PLUS(PLUS(PLUS(PLUS(PLUS(C1[a1][a2],C0[b1][b2]),C1[a1][b2]),C0[b1][a2]),AdjGain),AdjBreak),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))),B1[i][j]);
+              }
+              if (((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+              {
+                 W[i][j][C1_GDUP_GDUP_C0V1AV2A_C0V1AV2B_C0V1BV2A_C1V1BV2B]
+                     = PLUS(PLUS(PLUS(PLUS(PLUS(PLUS(C0[a1][a2],C1[b1][b2]),C0[a1][b2]),C0[b1][a2]),AdjBreak),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))),B1[i][j]);
+              }
+              if (((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+              {
+                 W[i][j][C1_GDUP_GDUP_C0V1AV2A_C0V1AV2B_C1V1BV2A_C1V1BV2B]
+                     = PLUS(PLUS(PLUS(PLUS(PLUS(PLUS(PLUS(C0[a1][a2],C1[b1][b2]),C0[a1][b2]),C1[b1][a2]),AdjGain),AdjBreak),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))),B1[i][j]);
+              }
+              if (((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+              {
+                 W[i][j][C1_GDUP_GDUP_C0V1AV2A_C0V1BV2A_C1V1AV2B_C1V1BV2B]
+                     = PLUS(PLUS(PLUS(PLUS(PLUS(PLUS(PLUS(C0[a1][a2],C1[b1][b2]),C1[a1][b2]),C0[b1][a2]),AdjGain),AdjBreak),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))),B1[i][j]);
+              }
+              if (((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+              {
+                 W[i][j][C1_GDUP_GDUP_C0V1AV2A_C0V1BV2B_C1V1AV2B_C1V1BV2A]
+                     = PLUS(PLUS(PLUS(PLUS(PLUS(C0[a1][a2],C0[b1][b2]),C1[a1][b2]),C1[b1][a2]),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))),B1[i][j]);
+              }
+              if (((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+              {
+                 W[i][j][C1_GDUP_GDUP_C0V1AV2A_C1V1AV2B_C1V1BV2A_C1V1BV2B]
+                     = PLUS(PLUS(PLUS(PLUS(PLUS(PLUS(C0[a1][a2],C1[b1][b2]),C1[a1][b2]),C1[b1][a2]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))),B1[i][j]);
+              }
+              if (((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+              {
+                 W[i][j][C1_GDUP_GDUP_C0V1BV2B_C1V1AV2A_C1V1AV2B_C1V1BV2A]
+                     = PLUS(PLUS(PLUS(PLUS(PLUS(PLUS(C1[a1][a2],C0[b1][b2]),C1[a1][b2]),C1[b1][a2]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))),B1[i][j]);
+              }
+              if (((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+              {
+                 W[i][j][C1_GDUP_GDUP_C0V1AV2A_C0V1BV2A_C0V1BV2B_C1V1AV2B]
+                     = PLUS(PLUS(PLUS(PLUS(PLUS(PLUS(C0[a1][a2],C0[b1][b2]),C1[a1][b2]),C0[b1][a2]),AdjBreak),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))),B1[i][j]);
+              }
+              if (((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+              {
+                 W[i][j][C1_GDUP_GDUP_C0V1AV2A_C0V1AV2B_C0V1BV2B_C1V1BV2A]
+                     = PLUS(PLUS(PLUS(PLUS(PLUS(PLUS(C0[a1][a2],C0[b1][b2]),C0[a1][b2]),C1[b1][a2]),AdjBreak),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))),B1[i][j]);
+              }
+              if (((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+              {
+                 W[i][j][C1_GDUP_GDUP_C0V1AV2A_C0V1AV2B_C0V1BV2A_C0V1BV2B]
+                     = PLUS(PLUS(PLUS(PLUS(PLUS(PLUS(PLUS(C0[a1][a2],C0[b1][b2]),C0[a1][b2]),C0[b1][a2]),AdjBreak),AdjBreak),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))),B1[i][j]);
+              }
+
+            }
+        }
+    }
+
+    deleteMatrix(B0,t1,t2);
+    deleteMatrix(B1,t1,t2);
+    return W;
+}
+
+
+RESULT_TYPE*** computeMatrix(RecTree * t1, RecTree * t2, bool adjacent, map<string, map<string,string> > & adjacencies){
+    RESULT_TYPE** C0 = allocateMatrix(t1,t2);
+    RESULT_TYPE** C1 = allocateMatrix(t1,t2);
+
+    vector<RecTree*> Dfo1 = computeDepthFirstOrder(t1);
+    vector<RecTree*> Dfo2 = computeDepthFirstOrder(t2);
+
+    char ** mask = NULL;
+#ifdef CELL_LOOKUP
+    if (CELL_LOOKUP_ACTIVE)
+    { mask = planMatrixCells(Dfo1, Dfo2, C0, C1); }
+#endif
+    for(int i=0;i<Dfo1.size();i++) 
+    {
+        fillMatrixRow(Dfo1[i], Dfo2, C0, C1, adjacencies, (mask? mask[i] : NULL));
+    }
+    if (mask)
+    {
+        for(int i=0;i<Dfo1.size();i++) 
+        { delete[] mask[i]; }
+        delete[] mask;
+    }
+
+    RESULT_TYPE*** finalResult = computeOutsideWeights(t1, t2, Dfo1, Dfo2, C0, C1, adjacencies);
+    // We don't want to delete W: this matrix is the output!
+
+    deleteMatrix(C0,t1,t2);
+    deleteMatrix(C1,t1,t2);
+    return finalResult;
+}
+
@@ -0,0 +1,867 @@
+
+
+RESULT_TYPE** allocateMatrix(RecTree * t1, RecTree * t2)
+{
+	RESULT_TYPE** R = new RESULT_TYPE*[t1->size()];
+	for(int i=0;i<t1->size();i++) 
+	{ R[i] = new RESULT_TYPE[t2->size()]; }
+	return R;
+}
+
+void deleteMatrix(RESULT_TYPE** R, RecTree * t1, RecTree * t2)
+{
+	for(int i=0;i<t1->size();i++) 
+	{
+		delete[] R[i];
+	}
+	delete[] R;
+}
+
+// Fills the (v1,v2) cell of C0/C1, assuming that the cells it depends on are filled
+static void fillMatrixCell(RecTree * v1, RecTree * v2, RESULT_TYPE** C0, RESULT_TYPE** C1, map<string, map<string,string> > & adjacencies)
+{
+    int i = v1->getIndex();
+    int j = v2->getIndex();
+    RESULT_TYPE tmp;
+    if (!sameSpecies(v1,v2))
+    { C1[i][j] = INF; C0[i][j] = INF; }
+    else
+    {
+      EventType t1 = v1->getEvent();
+      EventType t2 = v2->getEvent();
+      int a1 = (v1->getLeft()?  v1->getLeft()->getIndex():-1);
+      int b1 = (v1->getRight()? v1->getRight()->getIndex():-1);
+      int a2 = (v2->getLeft()?  v2->getLeft()->getIndex():-1);
+      int b2 = (v2->getRight()? v2->getRight()->getIndex():-1);
+
+      tmp = INF;
+      // Op#1: c0[v1,v2] = IsntAdj(v1,v2,adjacencies)
+      if (((t1==Extant)) && ((t2==Extant)))
+      {
+         //cout << "     " << "((t1==Extant)) && ((t2==Extant)); Old val:"<< tmp << "; Cand: " << PLUS(IsntAdj(v1,v2,adjacencies),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+         tmp = MIN(tmp, PLUS(IsntAdj(v1,v2,adjacencies),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_EXTANT_EXTANT|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+      }
+      // Op#2: c0[v1,v2] = ZERO
+      if (((t1==GLos)) && ((t2==Extant) || (t2==Spec) || (t2==GDup)))
+      {
+         //cout << "     " << "((t1==GLos)) && ((t2==Extant) || (t2==Spec) || (t2==GDup)); Old val:"<< tmp << "; Cand: " << PLUS(ZERO,RESCALING_FACTOR((v1->numNonGDup() + v2->numNonGDup() - 1))) << endl;
+         tmp = MIN(tmp, PLUS(ZERO,RESCALING_FACTOR((v1->numNonGDup() + v2->numNonGDup() - 1))), ("C0_GLOS_ESG|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+      }
+      // Op#3: c0[v1,v2] = ZERO
+      if (((t1==Extant) || (t1==Spec) || (t1==GDup)) && ((t2==GLos)))
+      {
+         //cout << "     " << "((t1==Extant) || (t1==Spec) || (t1==GDup)) && ((t2==GLos)); Old val:"<< tmp << "; Cand: " << PLUS(ZERO,RESCALING_FACTOR((v1->numNonGDup() + v2->numNonGDup() - 1))) << endl;
+         tmp = MIN(tmp, PLUS(ZERO,RESCALING_FACTOR((v1->numNonGDup() + v2->numNonGDup() - 1))), ("C0_ESG_GLOS|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+      }
+      // Op#4: c0[v1,v2] = ZERO
+      if (((t1==GLos)) && ((t2==GLos)))
+      {
+         //cout << "     " << "((t1==GLos)) && ((t2==GLos)); Old val:"<< tmp << "; Cand: " << PLUS(ZERO,RESCALING_FACTOR((v1->numNonGDup() + v2->numNonGDup() - 1))) << endl;
+         tmp = MIN(tmp, PLUS(ZERO,RESCALING_FACTOR((v1->numNonGDup() + v2->numNonGDup() - 1))), ("C0_GLOS_GLOS|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+      }
+      // Op#5: c0[v1,v2] = c0[v1,v2b] + c0[v1,v2a]
+      if (((t1==Extant) || (t1==Spec)) && ((t2==GDup)) && (a2 != -1) && (b2 != -1))
+      {
+         //cout << "     " << "((t1==Extant) || (t1==Spec)) && ((t2==GDup)) && (a2 != -1) && (b2 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(C0[i][b2],C0[i][a2]),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS3(C0[i][b2],C0[i][a2],RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_ES_GDUP_C0V1V2A_C0V1V2B|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(C0[i][b2],C0[i][a2]),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_ES_GDUP_C0V1V2A_C0V1V2B|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#6: c0[v1,v2] = c0[v1,v2b] + c1[v1,v2a] + AdjGain
+      if (((t1==Extant) || (t1==Spec)) && ((t2==GDup)) && (a2 != -1) && (b2 != -1))
+      {
+         //cout << "     " << "((t1==Extant) || (t1==Spec)) && ((t2==GDup)) && (a2 != -1) && (b2 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(PLUS(C0[i][b2],C1[i][a2]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS4(C0[i][b2],C1[i][a2],AdjGain,RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_ES_GDUP_C0V1V2B_C1V1V2A|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(PLUS(C0[i][b2],C1[i][a2]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_ES_GDUP_C0V1V2B_C1V1V2A|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#7: c0[v1,v2] = c1[v1,v2b] + c0[v1,v2a] + AdjGain
+      if (((t1==Extant) || (t1==Spec)) && ((t2==GDup)) && (a2 != -1) && (b2 != -1))
+      {
+         //cout << "     " << "((t1==Extant) || (t1==Spec)) && ((t2==GDup)) && (a2 != -1) && (b2 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(PLUS(C1[i][b2],C0[i][a2]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS4(C1[i][b2],C0[i][a2],AdjGain,RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_ES_GDUP_C0V1V2A_C1V1V2B|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(PLUS(C1[i][b2],C0[i][a2]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_ES_GDUP_C0V1V2A_C1V1V2B|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#8: c0[v1,v2] = c1[v1,v2b] + c1[v1,v2a] + AdjGain + AdjGain
+      if (((t1==Extant) || (t1==Spec)) && ((t2==GDup)) && (a2 != -1) && (b2 != -1))
+      {
+         //cout << "     " << "((t1==Extant) || (t1==Spec)) && ((t2==GDup)) && (a2 != -1) && (b2 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(PLUS(PLUS(C1[i][b2],C1[i][a2]),AdjGain),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS5(C1[i][b2],C1[i][a2],AdjGain,AdjGain,RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_ES_GDUP_C1V1V2A_C1V1V2B|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(C1[i][b2],C1[i][a2]),AdjGain),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_ES_GDUP_C1V1V2A_C1V1V2B|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#9: c0[v1,v2] = c0[v1a,v2] + c0[v1b,v2]
+      if (((t1==GDup)) && ((t2==Extant) || (t2==Spec)) && (a1 != -1) && (b1 != -1))
+      {
+         //cout << "     " << "((t1==GDup)) && ((t2==Extant) || (t2==Spec)) && (a1 != -1) && (b1 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(C0[a1][j],C0[b1][j]),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS3(C0[a1][j],C0[b1][j],RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_GDUP_ES_C0V1AV2_C0V1BV2|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(C0[a1][j],C0[b1][j]),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_GDUP_ES_C0V1AV2_C0V1BV2|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#10: c0[v1,v2] = c0[v1a,v2] + c1[v1b,v2] + AdjGain
+      if (((t1==GDup)) && ((t2==Extant) || (t2==Spec)) && (a1 != -1) && (b1 != -1))
+      {
+         //cout << "     " << "((t1==GDup)) && ((t2==Extant) || (t2==Spec)) && (a1 != -1) && (b1 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(PLUS(C0[a1][j],C1[b1][j]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS4(C0[a1][j],C1[b1][j],AdjGain,RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_GDUP_ES_C0V1AV2_C1V1BV2|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(PLUS(C0[a1][j],C1[b1][j]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_GDUP_ES_C0V1AV2_C1V1BV2|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#11: c0[v1,v2] = c1[v1a,v2] + c0[v1b,v2] + AdjGain
+      if (((t1==GDup)) && ((t2==Extant) || (t2==Spec)) && (a1 != -1) && (b1 != -1))
+      {
+         //cout << "     " << "((t1==GDup)) && ((t2==Extant) || (t2==Spec)) && (a1 != -1) && (b1 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(PLUS(C1[a1][j],C0[b1][j]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS4(C1[a1][j],C0[b1][j],AdjGain,RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_GDUP_ES_C0V1BV2_C1V1AV2|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(PLUS(C1[a1][j],C0[b1][j]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_GDUP_ES_C0V1BV2_C1V1AV2|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#12: c0[v1,v2] = c1[v1a,v2] + c1[v1b,v2] + AdjGain + AdjGain
+      if (((t1==GDup)) && ((t2==Extant) || (t2==Spec)) && (a1 != -1) && (b1 != -1))
+      {
+         //cout << "     " << "((t1==GDup)) && ((t2==Extant) || (t2==Spec)) && (a1 != -1) && (b1 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(PLUS(PLUS(C1[a1][j],C1[b1][j]),AdjGain),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS5(C1[a1][j],C1[b1][j],AdjGain,AdjGain,RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_GDUP_ES_C1V1AV2_C1V1BV2|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(C1[a1][j],C1[b1][j]),AdjGain),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_GDUP_ES_C1V1AV2_C1V1BV2|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#13: c0[v1,v2] = c0[v1a,v2b] + c0[v1b,v2a]
+      if (((t1==Spec)) && ((t2==Spec)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+      {
+         //cout << "     " << "((t1==Spec)) && ((t2==Spec)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(C0[a1][b2],C0[b1][a2]),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS3(C0[a1][b2],C0[b1][a2],RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_SPEC_SPEC_C0V1AV2B_C0V1BV2A|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(C0[a1][b2],C0[b1][a2]),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_SPEC_SPEC_C0V1AV2B_C0V1BV2A|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#14: c0[v1,v2] = c1[v1a,v2b] + c0[v1b,v2a] + AdjGain
+      if (((t1==Spec)) && ((t2==Spec)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+      {
+         //cout << "     " << "((t1==Spec)) && ((t2==Spec)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(PLUS(C1[a1][b2],C0[b1][a2]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS4(C1[a1][b2],C0[b1][a2],AdjGain,RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_SPEC_SPEC_C0V1BV2A_C1V1AV2B|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(PLUS(C1[a1][b2],C0[b1][a2]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_SPEC_SPEC_C0V1BV2A_C1V1AV2B|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#15: c0[v1,v2] = c0[v1a,v2b] + c1[v1b,v2a] + AdjGain
+      if (((t1==Spec)) && ((t2==Spec)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+      {
+         //cout << "     " << "((t1==Spec)) && ((t2==Spec)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(PLUS(C0[a1][b2],C1[b1][a2]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS4(C0[a1][b2],C1[b1][a2],AdjGain,RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_SPEC_SPEC_C0V1AV2B_C1V1BV2A|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(PLUS(C0[a1][b2],C1[b1][a2]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_SPEC_SPEC_C0V1AV2B_C1V1BV2A|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#16: c0[v1,v2] = c1[v1a,v2b] + c1[v1b,v2a] + AdjGain + AdjGain
+      if (((t1==Spec)) && ((t2==Spec)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+      {
+         //cout << "     " << "((t1==Spec)) && ((t2==Spec)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(PLUS(PLUS(C1[a1][b2],C1[b1][a2]),AdjGain),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS5(C1[a1][b2],C1[b1][a2],AdjGain,AdjGain,RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_SPEC_SPEC_C1V1AV2B_C1V1BV2A|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(C1[a1][b2],C1[b1][a2]),AdjGain),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_SPEC_SPEC_C1V1AV2B_C1V1BV2A|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#17: c0[v1,v2] = c0[v1a,v2a] + c0[v1b,v2b]
+      if (((t1==Spec)) && ((t2==Spec)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+      {
+         //cout << "     " << "((t1==Spec)) && ((t2==Spec)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(C0[a1][a2],C0[b1][b2]),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS3(C0[a1][a2],C0[b1][b2],RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_SPEC_SPEC_C0V1AV2A_C0V1BV2B|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(C0[a1][a2],C0[b1][b2]),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_SPEC_SPEC_C0V1AV2A_C0V1BV2B|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#18: c0[v1,v2] = c1[v1a,v2a] + c0[v1b,v2b] + AdjGain
+      if (((t1==Spec)) && ((t2==Spec)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+      {
+         //cout << "     " << "((t1==Spec)) && ((t2==Spec)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(PLUS(C1[a1][a2],C0[b1][b2]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS4(C1[a1][a2],C0[b1][b2],AdjGain,RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_SPEC_SPEC_C0V1BV2B_C1V1AV2A|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(PLUS(C1[a1][a2],C0[b1][b2]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_SPEC_SPEC_C0V1BV2B_C1V1AV2A|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#19: c0[v1,v2] = c0[v1a,v2a] + c1[v1b,v2b] + AdjGain
+      if (((t1==Spec)) && ((t2==Spec)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+      {
+         //cout << "     " << "((t1==Spec)) && ((t2==Spec)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(PLUS(C0[a1][a2],C1[b1][b2]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS4(C0[a1][a2],C1[b1][b2],AdjGain,RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_SPEC_SPEC_C0V1AV2A_C1V1BV2B|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(PLUS(C0[a1][a2],C1[b1][b2]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_SPEC_SPEC_C0V1AV2A_C1V1BV2B|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#20: c0[v1,v2] = c1[v1a,v2a] + c1[v1b,v2b] + AdjGain + AdjGain
+      if (((t1==Spec)) && ((t2==Spec)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+      {
+         //cout << "     " << "((t1==Spec)) && ((t2==Spec)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(PLUS(PLUS(C1[a1][a2],C1[b1][b2]),AdjGain),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS5(C1[a1][a2],C1[b1][b2],AdjGain,AdjGain,RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_SPEC_SPEC_C1V1AV2A_C1V1BV2B|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(C1[a1][a2],C1[b1][b2]),AdjGain),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_SPEC_SPEC_C1V1AV2A_C1V1BV2B|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#21: c0[v1,v2] = c0[v1a,v2] + c0[v1b,v2]
+      if (((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1))
+      {
+         //cout << "     " << "((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(C0[a1][j],C0[b1][j]),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS3(C0[a1][j],C0[b1][j],RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_GDUP_GDUP_C0V1AV2_C0V1BV2|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(C0[a1][j],C0[b1][j]),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_GDUP_GDUP_C0V1AV2_C0V1BV2|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#22: c0[v1,v2] = c0[v1a,v2] + c1[v1b,v2] + AdjGain
+      if (((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1))
+      {
+         //cout << "     " << "((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(PLUS(C0[a1][j],C1[b1][j]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS4(C0[a1][j],C1[b1][j],AdjGain,RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_GDUP_GDUP_C0V1AV2_C1V1BV2|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(PLUS(C0[a1][j],C1[b1][j]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_GDUP_GDUP_C0V1AV2_C1V1BV2|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#23: c0[v1,v2] = c1[v1a,v2] + c0[v1b,v2] + AdjGain
+      if (((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1))
+      {
+         //cout << "     " << "((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(PLUS(C1[a1][j],C0[b1][j]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS4(C1[a1][j],C0[b1][j],AdjGain,RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_GDUP_GDUP_C0V1BV2_C1V1AV2|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(PLUS(C1[a1][j],C0[b1][j]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_GDUP_GDUP_C0V1BV2_C1V1AV2|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#24: c0[v1,v2] = c1[v1a,v2] + c1[v1b,v2] + AdjGain + AdjGain
+      if (((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1))
+      {
+         //cout << "     " << "((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(PLUS(PLUS(C1[a1][j],C1[b1][j]),AdjGain),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS5(C1[a1][j],C1[b1][j],AdjGain,AdjGain,RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_GDUP_GDUP_C1V1AV2_C1V1BV2|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(C1[a1][j],C1[b1][j]),AdjGain),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_GDUP_GDUP_C1V1AV2_C1V1BV2|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#25: c0[v1,v2] = c0[v1,v2a] + c0[v1,v2b]
+      if (((t1==GDup)) && ((t2==GDup)) && (a2 != -1) && (b2 != -1))
+      {
+         //cout << "     " << "((t1==GDup)) && ((t2==GDup)) && (a2 != -1) && (b2 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(C0[i][a2],C0[i][b2]),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS3(C0[i][a2],C0[i][b2],RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_GDUP_GDUP_C0V1V2A_C0V1V2B|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(C0[i][a2],C0[i][b2]),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_GDUP_GDUP_C0V1V2A_C0V1V2B|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#26: c0[v1,v2] = c0[v1,v2a] + c1[v1,v2b] + AdjGain
+      if (((t1==GDup)) && ((t2==GDup)) && (a2 != -1) && (b2 != -1))
+      {
+         //cout << "     " << "((t1==GDup)) && ((t2==GDup)) && (a2 != -1) && (b2 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(PLUS(C0[i][a2],C1[i][b2]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS4(C0[i][a2],C1[i][b2],AdjGain,RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_GDUP_GDUP_C0V1V2A_C1V1V2B|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(PLUS(C0[i][a2],C1[i][b2]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_GDUP_GDUP_C0V1V2A_C1V1V2B|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#27: c0[v1,v2] = c1[v1,v2a] + c0[v1,v2b] + AdjGain
+      if (((t1==GDup)) && ((t2==GDup)) && (a2 != -1) && (b2 != -1))
+      {
+         //cout << "     " << "((t1==GDup)) && ((t2==GDup)) && (a2 != -1) && (b2 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(PLUS(C1[i][a2],C0[i][b2]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS4(C1[i][a2],C0[i][b2],AdjGain,RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_GDUP_GDUP_C0V1V2B_C1V1V2A|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(PLUS(C1[i][a2],C0[i][b2]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_GDUP_GDUP_C0V1V2B_C1V1V2A|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#28: c0[v1,v2] = c1[v1,v2a] + c1[v1,v2b] + AdjGain + AdjGain
+      if (((t1==GDup)) && ((t2==GDup)) && (a2 != -1) && (b2 != -1))
+      {
+         //cout << "     " << "((t1==GDup)) && ((t2==GDup)) && (a2 != -1) && (b2 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(PLUS(PLUS(C1[i][a2],C1[i][b2]),AdjGain),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS5(C1[i][a2],C1[i][b2],AdjGain,AdjGain,RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_GDUP_GDUP_C1V1V2A_C1V1V2B|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(C1[i][a2],C1[i][b2]),AdjGain),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C0_GDUP_GDUP_C1V1V2A_C1V1V2B|"+v1->getSpecies()), false, v1->getND(), v2->getND());
+#endif
+      }
+      C0[i][j] = tmp;
+
+      tmp = INF;
+      // Op#29: c1[v1,v2] = IsAdj(v1,v2,adjacencies)
+      if (((t1==Extant)) && ((t2==Extant)))
+      {
+         //cout << "     " << "((t1==Extant)) && ((t2==Extant)); Old val:"<< tmp << "; Cand: " << PLUS(IsAdj(v1,v2,adjacencies),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+         tmp = MIN(tmp, PLUS(IsAdj(v1,v2,adjacencies),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_EXTANT_EXTANT|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+      }
+      // Op#30: c1[v1,v2] = ZERO
+      if (((t1==GLos)) && ((t2==Extant) || (t2==Spec) || (t2==GDup)))
+      {
+         //cout << "     " << "((t1==GLos)) && ((t2==Extant) || (t2==Spec) || (t2==GDup)); Old val:"<< tmp << "; Cand: " << PLUS(ZERO,RESCALING_FACTOR((v1->numNonGDup() + v2->numNonGDup() - 1))) << endl;
+         tmp = MIN(tmp, PLUS(ZERO,RESCALING_FACTOR((v1->numNonGDup() + v2->numNonGDup() - 1))), ("C1_GLOS_ESG|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+      }
+      // Op#31: c1[v1,v2] = ZERO
+      if (((t1==Extant) || (t1==Spec) || (t1==GDup)) && ((t2==GLos)))
+      {
+         //cout << "     " << "((t1==Extant) || (t1==Spec) || (t1==GDup)) && ((t2==GLos)); Old val:"<< tmp << "; Cand: " << PLUS(ZERO,RESCALING_FACTOR((v1->numNonGDup() + v2->numNonGDup() - 1))) << endl;
+         tmp = MIN(tmp, PLUS(ZERO,RESCALING_FACTOR((v1->numNonGDup() + v2->numNonGDup() - 1))), ("C1_ESG_GLOS|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+      }
+      // Op#32: c1[v1,v2] = ZERO
+      if (((t1==GLos)) && ((t2==GLos)))
+      {
+         //cout << "     " << "((t1==GLos)) && ((t2==GLos)); Old val:"<< tmp << "; Cand: " << PLUS(ZERO,RESCALING_FACTOR((v1->numNonGDup() + v2->numNonGDup() - 1))) << endl;
+         tmp = MIN(tmp, PLUS(ZERO,RESCALING_FACTOR((v1->numNonGDup() + v2->numNonGDup() - 1))), ("C1_GLOS_GLOS|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+      }
+      // Op#33: c1[v1,v2] = c1[v1,v2b] + c0[v1,v2a]
+      if (((t1==Extant) || (t1==Spec)) && ((t2==GDup)) && (a2 != -1) && (b2 != -1))
+      {
+         //cout << "     " << "((t1==Extant) || (t1==Spec)) && ((t2==GDup)) && (a2 != -1) && (b2 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(C1[i][b2],C0[i][a2]),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS3(C1[i][b2],C0[i][a2],RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_ES_GDUP_C0V1V2A_C1V1V2B|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(C1[i][b2],C0[i][a2]),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_ES_GDUP_C0V1V2A_C1V1V2B|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#34: c1[v1,v2] = c0[v1,v2b] + c1[v1,v2a]
+      if (((t1==Extant) || (t1==Spec)) && ((t2==GDup)) && (a2 != -1) && (b2 != -1))
+      {
+         //cout << "     " << "((t1==Extant) || (t1==Spec)) && ((t2==GDup)) && (a2 != -1) && (b2 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(C0[i][b2],C1[i][a2]),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS3(C0[i][b2],C1[i][a2],RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_ES_GDUP_C0V1V2B_C1V1V2A|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(C0[i][b2],C1[i][a2]),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_ES_GDUP_C0V1V2B_C1V1V2A|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#35: c1[v1,v2] = c1[v1,v2b] + c1[v1,v2a] + AdjGain
+      if (((t1==Extant) || (t1==Spec)) && ((t2==GDup)) && (a2 != -1) && (b2 != -1))
+      {
+         //cout << "     " << "((t1==Extant) || (t1==Spec)) && ((t2==GDup)) && (a2 != -1) && (b2 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(PLUS(C1[i][b2],C1[i][a2]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS4(C1[i][b2],C1[i][a2],AdjGain,RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_ES_GDUP_C1V1V2A_C1V1V2B|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(PLUS(C1[i][b2],C1[i][a2]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_ES_GDUP_C1V1V2A_C1V1V2B|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#36: c1[v1,v2] = c0[v1,v2b] + c0[v1,v2a] + AdjBreak
+      if (((t1==Extant) || (t1==Spec)) && ((t2==GDup)) && (a2 != -1) && (b2 != -1))
+      {
+         //cout << "     " << "((t1==Extant) || (t1==Spec)) && ((t2==GDup)) && (a2 != -1) && (b2 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(PLUS(C0[i][b2],C0[i][a2]),AdjBreak),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS4(C0[i][b2],C0[i][a2],AdjBreak,RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_ES_GDUP_C0V1V2A_C0V1V2B|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(PLUS(C0[i][b2],C0[i][a2]),AdjBreak),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_ES_GDUP_C0V1V2A_C0V1V2B|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#37: c1[v1,v2] = c1[v1a,v2] + c0[v1b,v2]
+      if (((t1==GDup)) && ((t2==Extant) || (t2==Spec)) && (a1 != -1) && (b1 != -1))
+      {
+         //cout << "     " << "((t1==GDup)) && ((t2==Extant) || (t2==Spec)) && (a1 != -1) && (b1 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(C1[a1][j],C0[b1][j]),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS3(C1[a1][j],C0[b1][j],RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_ES_C0V1BV2_C1V1AV2|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(C1[a1][j],C0[b1][j]),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_ES_C0V1BV2_C1V1AV2|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#38: c1[v1,v2] = c0[v1a,v2] + c1[v1b,v2]
+      if (((t1==GDup)) && ((t2==Extant) || (t2==Spec)) && (a1 != -1) && (b1 != -1))
+      {
+         //cout << "     " << "((t1==GDup)) && ((t2==Extant) || (t2==Spec)) && (a1 != -1) && (b1 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(C0[a1][j],C1[b1][j]),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS3(C0[a1][j],C1[b1][j],RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_ES_C0V1AV2_C1V1BV2|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(C0[a1][j],C1[b1][j]),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_ES_C0V1AV2_C1V1BV2|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#39: c1[v1,v2] = c1[v1a,v2] + c1[v1b,v2] + AdjGain
+      if (((t1==GDup)) && ((t2==Extant) || (t2==Spec)) && (a1 != -1) && (b1 != -1))
+      {
+         //cout << "     " << "((t1==GDup)) && ((t2==Extant) || (t2==Spec)) && (a1 != -1) && (b1 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(PLUS(C1[a1][j],C1[b1][j]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS4(C1[a1][j],C1[b1][j],AdjGain,RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_ES_C1V1AV2_C1V1BV2|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(PLUS(C1[a1][j],C1[b1][j]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_ES_C1V1AV2_C1V1BV2|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#40: c1[v1,v2] = c0[v1a,v2] + c0[v1b,v2] + AdjBreak
+      if (((t1==GDup)) && ((t2==Extant) || (t2==Spec)) && (a1 != -1) && (b1 != -1))
+      {
+         //cout << "     " << "((t1==GDup)) && ((t2==Extant) || (t2==Spec)) && (a1 != -1) && (b1 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(PLUS(C0[a1][j],C0[b1][j]),AdjBreak),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS4(C0[a1][j],C0[b1][j],AdjBreak,RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_ES_C0V1AV2_C0V1BV2|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(PLUS(C0[a1][j],C0[b1][j]),AdjBreak),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_ES_C0V1AV2_C0V1BV2|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#41: c1[v1,v2] = c1[v1a,v2b] + c1[v1b,v2a]
+      if (((t1==Spec)) && ((t2==Spec)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+      {
+         //cout << "     " << "((t1==Spec)) && ((t2==Spec)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(C1[a1][b2],C1[b1][a2]),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS3(C1[a1][b2],C1[b1][a2],RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_SPEC_SPEC_C1V1AV2B_C1V1BV2A|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(C1[a1][b2],C1[b1][a2]),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_SPEC_SPEC_C1V1AV2B_C1V1BV2A|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#42: c1[v1,v2] = c1[v1a,v2b] + c0[v1b,v2a] + AdjBreak
+      if (((t1==Spec)) && ((t2==Spec)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+      {
+         //cout << "     " << "((t1==Spec)) && ((t2==Spec)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(PLUS(C1[a1][b2],C0[b1][a2]),AdjBreak),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS4(C1[a1][b2],C0[b1][a2],AdjBreak,RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_SPEC_SPEC_C0V1BV2A_C1V1AV2B|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(PLUS(C1[a1][b2],C0[b1][a2]),AdjBreak),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_SPEC_SPEC_C0V1BV2A_C1V1AV2B|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#43: c1[v1,v2] = c0[v1a,v2b] + c1[v1b,v2a] + AdjBreak
+      if (((t1==Spec)) && ((t2==Spec)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+      {
+         //cout << "     " << "((t1==Spec)) && ((t2==Spec)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(PLUS(C0[a1][b2],C1[b1][a2]),AdjBreak),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS4(C0[a1][b2],C1[b1][a2],AdjBreak,RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_SPEC_SPEC_C0V1AV2B_C1V1BV2A|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(PLUS(C0[a1][b2],C1[b1][a2]),AdjBreak),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_SPEC_SPEC_C0V1AV2B_C1V1BV2A|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#44: c1[v1,v2] = c0[v1a,v2b] + c0[v1b,v2a] + AdjBreak + AdjBreak
+      if (((t1==Spec)) && ((t2==Spec)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+      {
+         //cout << "     " << "((t1==Spec)) && ((t2==Spec)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(PLUS(PLUS(C0[a1][b2],C0[b1][a2]),AdjBreak),AdjBreak),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS5(C0[a1][b2],C0[b1][a2],AdjBreak,AdjBreak,RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_SPEC_SPEC_C0V1AV2B_C0V1BV2A|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(C0[a1][b2],C0[b1][a2]),AdjBreak),AdjBreak),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_SPEC_SPEC_C0V1AV2B_C0V1BV2A|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#45: c1[v1,v2] = c1[v1a,v2a] + c1[v1b,v2b]
+      if (((t1==Spec)) && ((t2==Spec)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+      {
+         //cout << "     " << "((t1==Spec)) && ((t2==Spec)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(C1[a1][a2],C1[b1][b2]),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS3(C1[a1][a2],C1[b1][b2],RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_SPEC_SPEC_C1V1AV2A_C1V1BV2B|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(C1[a1][a2],C1[b1][b2]),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_SPEC_SPEC_C1V1AV2A_C1V1BV2B|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#46: c1[v1,v2] = c1[v1a,v2a] + c0[v1b,v2b] + AdjBreak
+      if (((t1==Spec)) && ((t2==Spec)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+      {
+         //cout << "     " << "((t1==Spec)) && ((t2==Spec)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(PLUS(C1[a1][a2],C0[b1][b2]),AdjBreak),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS4(C1[a1][a2],C0[b1][b2],AdjBreak,RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_SPEC_SPEC_C0V1BV2B_C1V1AV2A|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(PLUS(C1[a1][a2],C0[b1][b2]),AdjBreak),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_SPEC_SPEC_C0V1BV2B_C1V1AV2A|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#47: c1[v1,v2] = c0[v1a,v2a] + c1[v1b,v2b] + AdjBreak
+      if (((t1==Spec)) && ((t2==Spec)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+      {
+         //cout << "     " << "((t1==Spec)) && ((t2==Spec)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(PLUS(C0[a1][a2],C1[b1][b2]),AdjBreak),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS4(C0[a1][a2],C1[b1][b2],AdjBreak,RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_SPEC_SPEC_C0V1AV2A_C1V1BV2B|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(PLUS(C0[a1][a2],C1[b1][b2]),AdjBreak),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_SPEC_SPEC_C0V1AV2A_C1V1BV2B|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#48: c1[v1,v2] = c0[v1a,v2a] + c0[v1b,v2b] + AdjBreak + AdjBreak
+      if (((t1==Spec)) && ((t2==Spec)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+      {
+         //cout << "     " << "((t1==Spec)) && ((t2==Spec)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(PLUS(PLUS(C0[a1][a2],C0[b1][b2]),AdjBreak),AdjBreak),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS5(C0[a1][a2],C0[b1][b2],AdjBreak,AdjBreak,RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_SPEC_SPEC_C0V1AV2A_C0V1BV2B|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(C0[a1][a2],C0[b1][b2]),AdjBreak),AdjBreak),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_SPEC_SPEC_C0V1AV2A_C0V1BV2B|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#49: c1[v1,v2] = c1[v1a,v2] + c0[v1b,v2]
+      if (((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1))
+      {
+         //cout << "     " << "((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(C1[a1][j],C0[b1][j]),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS3(C1[a1][j],C0[b1][j],RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_GDUP_C0V1BV2_C1V1AV2|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(C1[a1][j],C0[b1][j]),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_GDUP_C0V1BV2_C1V1AV2|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#50: c1[v1,v2] = c0[v1a,v2] + c1[v1b,v2]
+      if (((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1))
+      {
+         //cout << "     " << "((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(C0[a1][j],C1[b1][j]),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS3(C0[a1][j],C1[b1][j],RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_GDUP_C0V1AV2_C1V1BV2|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(C0[a1][j],C1[b1][j]),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_GDUP_C0V1AV2_C1V1BV2|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#51: c1[v1,v2] = c1[v1a,v2] + c1[v1b,v2] + AdjGain
+      if (((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1))
+      {
+         //cout << "     " << "((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(PLUS(C1[a1][j],C1[b1][j]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS4(C1[a1][j],C1[b1][j],AdjGain,RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_GDUP_C1V1AV2_C1V1BV2|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(PLUS(C1[a1][j],C1[b1][j]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_GDUP_C1V1AV2_C1V1BV2|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#52: c1[v1,v2] = c0[v1a,v2] + c0[v1b,v2] + AdjBreak
+      if (((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1))
+      {
+         //cout << "     " << "((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(PLUS(C0[a1][j],C0[b1][j]),AdjBreak),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS4(C0[a1][j],C0[b1][j],AdjBreak,RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_GDUP_C0V1AV2_C0V1BV2|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(PLUS(C0[a1][j],C0[b1][j]),AdjBreak),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_GDUP_C0V1AV2_C0V1BV2|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#53: c1[v1,v2] = c1[v1,v2a] + c0[v1,v2b]
+      if (((t1==GDup)) && ((t2==GDup)) && (a2 != -1) && (b2 != -1))
+      {
+         //cout << "     " << "((t1==GDup)) && ((t2==GDup)) && (a2 != -1) && (b2 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(C1[i][a2],C0[i][b2]),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS3(C1[i][a2],C0[i][b2],RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_GDUP_C0V1V2B_C1V1V2A|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(C1[i][a2],C0[i][b2]),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_GDUP_C0V1V2B_C1V1V2A|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#54: c1[v1,v2] = c0[v1,v2a] + c1[v1,v2b]
+      if (((t1==GDup)) && ((t2==GDup)) && (a2 != -1) && (b2 != -1))
+      {
+         //cout << "     " << "((t1==GDup)) && ((t2==GDup)) && (a2 != -1) && (b2 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(C0[i][a2],C1[i][b2]),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS3(C0[i][a2],C1[i][b2],RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_GDUP_C0V1V2A_C1V1V2B|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(C0[i][a2],C1[i][b2]),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_GDUP_C0V1V2A_C1V1V2B|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#55: c1[v1,v2] = c1[v1,v2a] + c1[v1,v2b] + AdjGain
+      if (((t1==GDup)) && ((t2==GDup)) && (a2 != -1) && (b2 != -1))
+      {
+         //cout << "     " << "((t1==GDup)) && ((t2==GDup)) && (a2 != -1) && (b2 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(PLUS(C1[i][a2],C1[i][b2]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS4(C1[i][a2],C1[i][b2],AdjGain,RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_GDUP_C1V1V2A_C1V1V2B|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(PLUS(C1[i][a2],C1[i][b2]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_GDUP_C1V1V2A_C1V1V2B|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#56: c1[v1,v2] = c0[v1,v2a] + c0[v1,v2b] + AdjBreak
+      if (((t1==GDup)) && ((t2==GDup)) && (a2 != -1) && (b2 != -1))
+      {
+         //cout << "     " << "((t1==GDup)) && ((t2==GDup)) && (a2 != -1) && (b2 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(PLUS(C0[i][a2],C0[i][b2]),AdjBreak),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS4(C0[i][a2],C0[i][b2],AdjBreak,RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_GDUP_C0V1V2A_C0V1V2B|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(PLUS(C0[i][a2],C0[i][b2]),AdjBreak),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_GDUP_C0V1V2A_C0V1V2B|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#57: c1[v1,v2] = c1[v1a,v2a] + c1[v1b,v2b] + c0[v1a,v2b] + c0[v1b,v2a]
+      if (((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+      {
+         //cout << "     " << "((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(PLUS(PLUS(C1[a1][a2],C1[b1][b2]),C0[a1][b2]),C0[b1][a2]),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS5(C1[a1][a2],C1[b1][b2],C0[a1][b2],C0[b1][a2],RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_GDUP_C0V1AV2B_C0V1BV2A_C1V1AV2A_C1V1BV2B|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(C1[a1][a2],C1[b1][b2]),C0[a1][b2]),C0[b1][a2]),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_GDUP_C0V1AV2B_C0V1BV2A_C1V1AV2A_C1V1BV2B|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#58: c1[v1,v2] = c1[v1a,v2a] + c1[v1b,v2b] + c0[v1a,v2b] + c1[v1b,v2a] + AdjGain
+      if (((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+      {
+         //cout << "     " << "((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(PLUS(PLUS(PLUS(C1[a1][a2],C1[b1][b2]),C0[a1][b2]),C1[b1][a2]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS6(C1[a1][a2],C1[b1][b2],C0[a1][b2],C1[b1][a2],AdjGain,RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_GDUP_C0V1AV2B_C1V1AV2A_C1V1BV2A_C1V1BV2B|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(PLUS(C1[a1][a2],C1[b1][b2]),C0[a1][b2]),C1[b1][a2]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_GDUP_C0V1AV2B_C1V1AV2A_C1V1BV2A_C1V1BV2B|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#59: c1[v1,v2] = c1[v1a,v2a] + c1[v1b,v2b] + c1[v1a,v2b] + c0[v1b,v2a] + AdjGain
+      if (((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+      {
+         //cout << "     " << "((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(PLUS(PLUS(PLUS(C1[a1][a2],C1[b1][b2]),C1[a1][b2]),C0[b1][a2]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS6(C1[a1][a2],C1[b1][b2],C1[a1][b2],C0[b1][a2],AdjGain,RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_GDUP_C0V1BV2A_C1V1AV2A_C1V1AV2B_C1V1BV2B|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(PLUS(C1[a1][a2],C1[b1][b2]),C1[a1][b2]),C0[b1][a2]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_GDUP_C0V1BV2A_C1V1AV2A_C1V1AV2B_C1V1BV2B|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#60: c1[v1,v2] = c1[v1a,v2a] + c1[v1b,v2b] + c1[v1a,v2b] + c1[v1b,v2a] + AdjGain + AdjGain
+      if (((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+      {
+         //cout << "     " << "((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(PLUS(PLUS(PLUS(PLUS(C1[a1][a2],C1[b1][b2]),C1[a1][b2]),C1[b1][a2]),AdjGain),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS7(C1[a1][a2],C1[b1][b2],C1[a1][b2],C1[b1][a2],AdjGain,AdjGain,RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_GDUP_C1V1AV2A_C1V1AV2B_C1V1BV2A_C1V1BV2B|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(PLUS(PLUS(C1[a1][a2],C1[b1][b2]),C1[a1][b2]),C1[b1][a2]),AdjGain),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_GDUP_C1V1AV2A_C1V1AV2B_C1V1BV2A_C1V1BV2B|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#61: c1[v1,v2] = c1[v1a,v2a] + c0[v1b,v2b] + c0[v1a,v2b] + c0[v1b,v2a] + AdjBreak
+      if (((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+      {
+         //cout << "     " << "((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(PLUS(PLUS(PLUS(C1[a1][a2],C0[b1][b2]),C0[a1][b2]),C0[b1][a2]),AdjBreak),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS6(C1[a1][a2],C0[b1][b2],C0[a1][b2],C0[b1][a2],AdjBreak,RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_GDUP_C0V1AV2B_C0V1BV2A_C0V1BV2B_C1V1AV2A|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(PLUS(C1[a1][a2],C0[b1][b2]),C0[a1][b2]),C0[b1][a2]),AdjBreak),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_GDUP_C0V1AV2B_C0V1BV2A_C0V1BV2B_C1V1AV2A|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#62: c1[v1,v2] = c1[v1a,v2a] + c0[v1b,v2b] + c0[v1a,v2b] + c1[v1b,v2a] + AdjGain + AdjBreak
+      if (((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+      {
+         //cout << "     " << "((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(PLUS(PLUS(PLUS(PLUS(C1[a1][a2],C0[b1][b2]),C0[a1][b2]),C1[b1][a2]),AdjGain),AdjBreak),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS7(C1[a1][a2],C0[b1][b2],C0[a1][b2],C1[b1][a2],AdjGain,AdjBreak,RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_GDUP_C0V1AV2B_C0V1BV2B_C1V1AV2A_C1V1BV2A|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(PLUS(PLUS(C1[a1][a2],C0[b1][b2]),C0[a1][b2]),C1[b1][a2]),AdjGain),AdjBreak),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_GDUP_C0V1AV2B_C0V1BV2B_C1V1AV2A_C1V1BV2A|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#63: c1[v1,v2] = c1[v1a,v2a] + c0[v1b,v2b] + c1[v1a,v2b] + c0[v1b,v2a] + AdjGain + AdjBreak
+      if (((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+      {
+         //cout << "     " << "((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(PLUS(PLUS(PLUS(PLUS(C1[a1][a2],C0[b1][b2]),C1[a1][b2]),C0[b1][a2]),AdjGain),AdjBreak),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS7(C1[a1][a2],C0[b1][b2],C1[a1][b2],C0[b1][a2],AdjGain,AdjBreak,RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_GDUP_C0V1BV2A_C0V1BV2B_C1V1AV2A_C1V1AV2B|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(PLUS(PLUS(C1[a1][a2],C0[b1][b2]),C1[a1][b2]),C0[b1][a2]),AdjGain),AdjBreak),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_GDUP_C0V1BV2A_C0V1BV2B_C1V1AV2A_C1V1AV2B|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#64: c1[v1,v2] = c0[v1a,v2a] + c1[v1b,v2b] + c0[v1a,v2b] + c0[v1b,v2a] + AdjBreak
+      if (((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+      {
+         //cout << "     " << "((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(PLUS(PLUS(PLUS(C0[a1][a2],C1[b1][b2]),C0[a1][b2]),C0[b1][a2]),AdjBreak),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS6(C0[a1][a2],C1[b1][b2],C0[a1][b2],C0[b1][a2],AdjBreak,RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_GDUP_C0V1AV2A_C0V1AV2B_C0V1BV2A_C1V1BV2B|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(PLUS(C0[a1][a2],C1[b1][b2]),C0[a1][b2]),C0[b1][a2]),AdjBreak),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_GDUP_C0V1AV2A_C0V1AV2B_C0V1BV2A_C1V1BV2B|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#65: c1[v1,v2] = c0[v1a,v2a] + c1[v1b,v2b] + c0[v1a,v2b] + c1[v1b,v2a] + AdjGain + AdjBreak
+      if (((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+      {
+         //cout << "     " << "((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(PLUS(PLUS(PLUS(PLUS(C0[a1][a2],C1[b1][b2]),C0[a1][b2]),C1[b1][a2]),AdjGain),AdjBreak),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS7(C0[a1][a2],C1[b1][b2],C0[a1][b2],C1[b1][a2],AdjGain,AdjBreak,RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_GDUP_C0V1AV2A_C0V1AV2B_C1V1BV2A_C1V1BV2B|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(PLUS(PLUS(C0[a1][a2],C1[b1][b2]),C0[a1][b2]),C1[b1][a2]),AdjGain),AdjBreak),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_GDUP_C0V1AV2A_C0V1AV2B_C1V1BV2A_C1V1BV2B|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#66: c1[v1,v2] = c0[v1a,v2a] + c1[v1b,v2b] + c1[v1a,v2b] + c0[v1b,v2a] + AdjGain + AdjBreak
+      if (((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+      {
+         //cout << "     " << "((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(PLUS(PLUS(PLUS(PLUS(C0[a1][a2],C1[b1][b2]),C1[a1][b2]),C0[b1][a2]),AdjGain),AdjBreak),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS7(C0[a1][a2],C1[b1][b2],C1[a1][b2],C0[b1][a2],AdjGain,AdjBreak,RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_GDUP_C0V1AV2A_C0V1BV2A_C1V1AV2B_C1V1BV2B|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(PLUS(PLUS(C0[a1][a2],C1[b1][b2]),C1[a1][b2]),C0[b1][a2]),AdjGain),AdjBreak),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_GDUP_C0V1AV2A_C0V1BV2A_C1V1AV2B_C1V1BV2B|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#67: c1[v1,v2] = c0[v1a,v2a] + c0[v1b,v2b] + c1[v1a,v2b] + c1[v1b,v2a]
+      if (((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+      {
+         //cout << "     " << "((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(PLUS(PLUS(C0[a1][a2],C0[b1][b2]),C1[a1][b2]),C1[b1][a2]),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS5(C0[a1][a2],C0[b1][b2],C1[a1][b2],C1[b1][a2],RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_GDUP_C0V1AV2A_C0V1BV2B_C1V1AV2B_C1V1BV2A|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(C0[a1][a2],C0[b1][b2]),C1[a1][b2]),C1[b1][a2]),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_GDUP_C0V1AV2A_C0V1BV2B_C1V1AV2B_C1V1BV2A|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#68: c1[v1,v2] = c0[v1a,v2a] + c1[v1b,v2b] + c1[v1a,v2b] + c1[v1b,v2a] + AdjGain
+      if (((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+      {
+         //cout << "     " << "((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(PLUS(PLUS(PLUS(C0[a1][a2],C1[b1][b2]),C1[a1][b2]),C1[b1][a2]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS6(C0[a1][a2],C1[b1][b2],C1[a1][b2],C1[b1][a2],AdjGain,RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_GDUP_C0V1AV2A_C1V1AV2B_C1V1BV2A_C1V1BV2B|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(PLUS(C0[a1][a2],C1[b1][b2]),C1[a1][b2]),C1[b1][a2]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_GDUP_C0V1AV2A_C1V1AV2B_C1V1BV2A_C1V1BV2B|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#69: c1[v1,v2] = c1[v1a,v2a] + c0[v1b,v2b] + c1[v1a,v2b] + c1[v1b,v2a] + AdjGain
+      if (((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+      {
+         //cout << "     " << "((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(PLUS(PLUS(PLUS(C1[a1][a2],C0[b1][b2]),C1[a1][b2]),C1[b1][a2]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS6(C1[a1][a2],C0[b1][b2],C1[a1][b2],C1[b1][a2],AdjGain,RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_GDUP_C0V1BV2B_C1V1AV2A_C1V1AV2B_C1V1BV2A|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(PLUS(C1[a1][a2],C0[b1][b2]),C1[a1][b2]),C1[b1][a2]),AdjGain),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_GDUP_C0V1BV2B_C1V1AV2A_C1V1AV2B_C1V1BV2A|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#70: c1[v1,v2] = c0[v1a,v2a] + c0[v1b,v2b] + c1[v1a,v2b] + c0[v1b,v2a] + AdjBreak
+      if (((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+      {
+         //cout << "     " << "((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(PLUS(PLUS(PLUS(C0[a1][a2],C0[b1][b2]),C1[a1][b2]),C0[b1][a2]),AdjBreak),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS6(C0[a1][a2],C0[b1][b2],C1[a1][b2],C0[b1][a2],AdjBreak,RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_GDUP_C0V1AV2A_C0V1BV2A_C0V1BV2B_C1V1AV2B|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(PLUS(C0[a1][a2],C0[b1][b2]),C1[a1][b2]),C0[b1][a2]),AdjBreak),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_GDUP_C0V1AV2A_C0V1BV2A_C0V1BV2B_C1V1AV2B|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#71: c1[v1,v2] = c0[v1a,v2a] + c0[v1b,v2b] + c0[v1a,v2b] + c1[v1b,v2a] + AdjBreak
+      if (((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+      {
+         //cout << "     " << "((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(PLUS(PLUS(PLUS(C0[a1][a2],C0[b1][b2]),C0[a1][b2]),C1[b1][a2]),AdjBreak),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS6(C0[a1][a2],C0[b1][b2],C0[a1][b2],C1[b1][a2],AdjBreak,RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_GDUP_C0V1AV2A_C0V1AV2B_C0V1BV2B_C1V1BV2A|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(PLUS(C0[a1][a2],C0[b1][b2]),C0[a1][b2]),C1[b1][a2]),AdjBreak),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_GDUP_C0V1AV2A_C0V1AV2B_C0V1BV2B_C1V1BV2A|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#endif
+      }
+      // Op#72: c1[v1,v2] = c0[v1a,v2a] + c0[v1b,v2b] + c0[v1a,v2b] + c0[v1b,v2a] + AdjBreak + AdjBreak
+      if (((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+      {
+         //cout << "     " << "((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1); Old val:"<< tmp << "; Cand: " << PLUS(PLUS(PLUS(PLUS(PLUS(PLUS(C0[a1][a2],C0[b1][b2]),C0[a1][b2]),C0[b1][a2]),AdjBreak),AdjBreak),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))) << endl;
+#ifdef PLUS_CHAINS
+         tmp = MIN(tmp, PLUS7(C0[a1][a2],C0[b1][b2],C0[a1][b2],C0[b1][a2],AdjBreak,AdjBreak,RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_GDUP_C0V1AV2A_C0V1AV2B_C0V1BV2A_C0V1BV2B|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#else
+         tmp = MIN(tmp, PLUS(PLUS(PLUS(PLUS(PLUS(PLUS(C0[a1][a2],C0[b1][b2]),C0[a1][b2]),C0[b1][a2]),AdjBreak),AdjBreak),RESCALING_FACTOR((((t1!=GDup)&&(t2!=GDup))?1:0))), ("C1_GDUP_GDUP_C0V1AV2A_C0V1AV2B_C0V1BV2A_C0V1BV2B|"+v1->getSpecies()), true, v1->getND(), v2->getND());
+#endif
+      }
+      C1[i][j] = tmp;
+
+#ifdef CELL_STORE
+      CELL_STORE(i,j,v1,v2,C0[i][j],C1[i][j]);
+#endif
+    }
+    //cerr << "Node: " << v1->getLabel() << " (" << v1->getSpecies() << ") " << v2->getLabel() << " (" << v2->getSpecies() << ")" << endl;
+}
+
+// Fills the row of v1 in C0/C1. If mask is not NULL, only fills the cells marked as CELL_COMPUTE.
+static void fillMatrixRow(RecTree * v1, vector<RecTree*> & Dfo2, RESULT_TYPE** C0, RESULT_TYPE** C1, map<string, map<string,string> > & adjacencies, const char * mask)
+{
+    for(int j=0;j<Dfo2.size();j++) 
+    {
+        if ((mask==NULL) || (mask[j]==CELL_COMPUTE))
+        { fillMatrixCell(v1, Dfo2[j], C0, C1, adjacencies); }
+    }
+}
+
+#ifdef computeRow
+// Fills the row of v1 in tables kept by the caller, whose (stable) indices may 
+// not follow a depth-first order, as long as the rows of the children of v1 are filled
+void computeRow(RecTree * v1, vector<RecTree*> & Dfo2, RESULT_TYPE** C0, RESULT_TYPE** C1, map<string, map<string,string> > & adjacencies, const char * mask)
+{
+    fillMatrixRow(v1, Dfo2, C0, C1, adjacencies, mask);
+}
+#endif
+
+// Marks (as CELL_COMPUTE) the cells that the (v1,v2) cell depends on 
+static void markCellDependencies(RecTree * v1, RecTree * v2, char ** mask)
+{
+    int i = v1->getIndex();
+    int j = v2->getIndex();
+    EventType t1 = v1->getEvent();
+    EventType t2 = v2->getEvent();
+    int a1 = (v1->getLeft()?  v1->getLeft()->getIndex():-1);
+    int b1 = (v1->getRight()? v1->getRight()->getIndex():-1);
+    int a2 = (v2->getLeft()?  v2->getLeft()->getIndex():-1);
+    int b2 = (v2->getRight()? v2->getRight()->getIndex():-1);
+    if (((t1==Extant) || (t1==Spec)) && ((t2==GDup)) && (a2 != -1) && (b2 != -1))
+    {
+      mask[i][b2] = CELL_COMPUTE;
+      mask[i][a2] = CELL_COMPUTE;
+    }
+    if (((t1==GDup)) && ((t2==Extant) || (t2==Spec)) && (a1 != -1) && (b1 != -1))
+    {
+      mask[a1][j] = CELL_COMPUTE;
+      mask[b1][j] = CELL_COMPUTE;
+    }
+    if (((t1==Spec)) && ((t2==Spec)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+    {
+      mask[a1][b2] = CELL_COMPUTE;
+      mask[b1][a2] = CELL_COMPUTE;
+      mask[a1][a2] = CELL_COMPUTE;
+      mask[b1][b2] = CELL_COMPUTE;
+    }
+    if (((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1))
+    {
+      mask[a1][j] = CELL_COMPUTE;
+      mask[b1][j] = CELL_COMPUTE;
+    }
+    if (((t1==GDup)) && ((t2==GDup)) && (a2 != -1) && (b2 != -1))
+    {
+      mask[i][a2] = CELL_COMPUTE;
+      mask[i][b2] = CELL_COMPUTE;
+    }
+    if (((t1==GDup)) && ((t2==GDup)) && (a1 != -1) && (b1 != -1) && (a2 != -1) && (b2 != -1))
+    {
+      mask[a1][a2] = CELL_COMPUTE;
+      mask[b1][b2] = CELL_COMPUTE;
+      mask[a1][b2] = CELL_COMPUTE;
+      mask[b1][a2] = CELL_COMPUTE;
+    }
+}
+
+#ifdef CELL_LOOKUP
+// Top-down pass from the root cell, which finds the cells that are actually needed
+// to compute the root: cells retrieved through CELL_LOOKUP are marked CELL_KNOWN, 
+// and their dependencies are not explored further.
+static char ** planMatrixCells(vector<RecTree*> & Dfo1, vector<RecTree*> & Dfo2, RESULT_TYPE** C0, RESULT_TYPE** C1)
+{
+    char ** mask = new char*[Dfo1.size()];
+    for(int i=0;i<Dfo1.size();i++) 
+    {
+        mask[i] = new char[Dfo2.size()];
+        for(int j=0;j<Dfo2.size();j++) 
+        { mask[i][j] = CELL_SKIP; }
+    }
+    mask[Dfo1.size()-1][Dfo2.size()-1] = CELL_COMPUTE;
+    for(int i=Dfo1.size()-1;i>=0;i--) 
+    {
+        RecTree * v1 = Dfo1[i];
+        for(int j=Dfo2.size()-1;j>=0;j--) 
+        {
+            RecTree * v2 = Dfo2[j];
+            if ((mask[i][j]==CELL_COMPUTE) && sameSpecies(v1,v2))
+            {
+                if (CELL_LOOKUP(i,j,v1,v2,C0[i][j],C1[i][j]))
+                { mask[i][j] = CELL_KNOWN; }
+                else
+                { markCellDependencies(v1,v2,mask); }
+            }
+        }
+    }
+    return mask;
+}
+#endif
+
+
+RESULT_TYPE computeMatrix(RecTree * t1, RecTree * t2, bool adjacent, map<string, map<string,string> > & adjacencies){
+    RESULT_TYPE** C0 = allocateMatrix(t1,t2);
+    RESULT_TYPE** C1 = allocateMatrix(t1,t2);
+
+    vector<RecTree*> Dfo1 = computeDepthFirstOrder(t1);
+    vector<RecTree*> Dfo2 = computeDepthFirstOrder(t2);
+
+    char ** mask = NULL;
+#ifdef CELL_LOOKUP
+    if (CELL_LOOKUP_ACTIVE)
+    { mask = planMatrixCells(Dfo1, Dfo2, C0, C1); }
+#endif
+    for(int i=0;i<Dfo1.size();i++) 
+    {
+        fillMatrixRow(Dfo1[i], Dfo2, C0, C1, adjacencies, (mask? mask[i] : NULL));
+    }
+    if (mask)
+    {
+        for(int i=0;i<Dfo1.size();i++) 
+        { delete[] mask[i]; }
+        delete[] mask;
+    }
+
+    RESULT_TYPE finalResult = (adjacent?C1[Dfo1.size()-1][Dfo2.size()-1]:C0[Dfo1.size()-1][Dfo2.size()-1]);
+
+    deleteMatrix(C0,t1,t2);
+    deleteMatrix(C1,t1,t2);
+    return finalResult;
+}
+
@@ -401,6 +401,109 @@ vector<Tree *>  computeStatsTreeRec(Tree * speciesTree, EditTree * ops, StatsAcc
 
 
 
+ScenarioPool::ScenarioPool()
+{
+}
+
+void ScenarioPool::newScenario()
+{
+	starts.push_back(events.size());
+}
+
+void ScenarioPool::addEvent(int i, int j, NodeType t)
+{
+	events.push_back(ReconciliationEvent(i,j,t));
+}
+
+void ScenarioPool::dropScenario()
+{
+	events.erase(events.begin()+starts.back(),events.end());
+	starts.pop_back();
+}
+
+int ScenarioPool::size() const
+{
+	return starts.size();
+}
+
+const ReconciliationEvent * ScenarioPool::begin(int k) const
+{
+	return &events[0]+starts[k];
+}
+
+const ReconciliationEvent * ScenarioPool::end(int k) const
+{
+	return &events[0]+((k+1<starts.size())? starts[k+1] : events.size());
+}
+
+NodeType ** ScenarioPool::eventsAsMatrix(int k, Tree * geneTree, Tree * speciesTree) const
+{
+	NodeType ** vals = new NodeType*[geneTree->size()];
+	for(int i =0;i<geneTree->size();i++){
+		vals[i] = new NodeType[speciesTree->size()];
+		for(int j =0;j<speciesTree->size();j++){
+			vals[i][j] = NONE_TYPE;
+		}
+	}
+	for (const ReconciliationEvent * e=begin(k);e!=end(k);e++)
+	{
+		vals[e->gene][e->species] = e->type;
+	}
+	return vals;
+}
+
+EditTree * ScenarioPool::asEditTree(int k, Tree * geneTree, Tree * speciesTree) const
+{
+	vector<Tree*> DfoS = computeDepthFirstOrder(speciesTree);
+	EditTree * root = NULL;
+	// Nodes still missing children, along with the side (0: left, 1: right) 
+	// of the next one
+	vector<pair<EditTree*,int> > open;
+	for (const ReconciliationEvent * e=begin(k);e!=end(k);e++)
+	{
+		string name;
+		switch(e->type)
+		{
+			case (DUP_TYPE): name = "Dup"; break;
+			case (SPEC_AB_TYPE): name = "Spec_ab"; break;
+			case (SPEC_BA_TYPE): name = "Spec_ba"; break;
+			case (LOSS_A_TYPE): name = "Loss_a"; break;
+			case (LOSS_B_TYPE): name = "Loss_b"; break;
+			default: name = "Match"; break;
+		}
+		EditTree * t = new EditTree(formatLabel(name,DfoS[e->species]),NULL,NULL,e->type);
+		if (open.empty())
+		{ root = t; }
+		else
+		{
+			pair<EditTree*,int> & p = open.back();
+			if (p.second==0)
+			{ p.first->setLeft(t); }
+			else
+			{ p.first->setRight(t); }
+			if ((p.second==0) && (p.first->getNodeType()==DUP_TYPE || p.first->getNodeType()==SPEC_AB_TYPE || p.first->getNodeType()==SPEC_BA_TYPE))
+			{ p.second = 1; }
+			else
+			{ open.pop_back(); }
+		}
+		switch(e->type)
+		{
+			case (DUP_TYPE): 
+			case (SPEC_AB_TYPE): 
+			case (SPEC_BA_TYPE): 
+			case (LOSS_B_TYPE): 
+				open.push_back(pair<EditTree*,int>(t,0)); 
+				break;
+			case (LOSS_A_TYPE): 
+				open.push_back(pair<EditTree*,int>(t,1)); 
+				break;
+			default:
+				break;
+		}
+	}
+	return root;
+}
+
 vector<Tree *> applyEditTree(Tree * speciesTree, EditTree * ops)
 {
 	return applyEditTreeRec(speciesTree, ops);
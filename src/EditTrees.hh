@@ -72,6 +72,39 @@ class EditTree: public Tree{
 		
 };
 
+// Event of a reconciliation: gene node i (by index) mapped onto species node j
+class ReconciliationEvent{
+	public:
+		int gene;
+		int species;
+		NodeType type;
+		ReconciliationEvent(int i, int j, NodeType t) : gene(i), species(j), type(t) {}
+};
+
+// Reconciliations stored back to back in a single array of events, each in 
+// pre-order (left before right). Labels and trees are only built on output.
+class ScenarioPool{
+	private:
+		vector<ReconciliationEvent> events;
+		vector<size_t> starts;
+		
+	public:
+		ScenarioPool();
+		
+		// Opens a new scenario, to which events are then added
+		void newScenario();
+		void addEvent(int i, int j, NodeType t);
+		// Drops the events of the last scenario
+		void dropScenario();
+		
+		int size() const;
+		const ReconciliationEvent * begin(int k) const;
+		const ReconciliationEvent * end(int k) const;
+		
+		// Same as EditTree::eventsAsMatrix, and as the backtracked EditTree
+		NodeType ** eventsAsMatrix(int k, Tree * geneTree, Tree * speciesTree) const;
+		EditTree * asEditTree(int k, Tree * geneTree, Tree * speciesTree) const;
+};
 
 vector<Tree *> applyEditTree(Tree * speciesTree, EditTree * ops);
 
@@ -0,0 +1,366 @@
+/*  DeClone: A software for computing and analyzing ancestral adjacency scenarios.
+ *  Copyright (C) 2015 Cedric Chauve, Yann Ponty, Ashok Rajaraman, Joao P.P. Zanetti
+ *
+ *  This file is part of DeClone.
+ *  
+ *  DeClone is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  DeClone is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with DeClone.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Contact: <yann.ponty@lix.polytechnique.fr>.
+ *
+ *
+ *  DeClone uses the Quickhull algorithm implementation programmed by 
+ *  Anatoly V. Tomilov. The code is available on <https://bitbucket.org/tomilov/quickhull/src/585267abb3a63794c04fc8325aa9ec9f726112ed/include/quickhull.hpp?at=master>.
+ *
+ *  Contact: <tomilovanatoliy@gmail.com>
+ */
+
+#include "IntPolytope.hh"
+#include "Polygon2D.hh"
+
+#include <set>
+#include <utility>
+#include <map>
+
+using namespace std;
+
+typedef array<int32_t,2> point2_type;
+typedef array<int32_t,3> point3_type;
+
+
+static long long cross2(const point2_type & o, const point2_type & a, const point2_type & b)
+{
+  return ((long long)a[0]-o[0])*((long long)b[1]-o[1]) - ((long long)a[1]-o[1])*((long long)b[0]-o[0]);
+}
+
+// Indices of the vertices of the hull of sorted points (monotone chain)
+static vector<size_t> monotoneChain(const vector<point2_type> & points)
+{
+  size_t n = points.size();
+  if (n<3)
+  {
+    vector<size_t> res;
+    for (size_t i=0;i<n;i++)
+    { res.push_back(i); }
+    return res;
+  }
+  vector<size_t> hull(2*n);
+  size_t k = 0;
+  for (size_t i=0;i<n;i++)
+  {
+    while (k>=2 && cross2(points[hull[k-2]],points[hull[k-1]],points[i])<=0)
+    { k--; }
+    hull[k++] = i;
+  }
+  for (size_t i=n-1,t=k+1;i>0;i--)
+  {
+    while (k>=t && cross2(points[hull[k-2]],points[hull[k-1]],points[i-1])<=0)
+    { k--; }
+    hull[k++] = i-1;
+  }
+  hull.resize(k-1);
+  // Collinear points: both ends only
+  if ((hull.size()==2) && (hull[0]==hull[1]))
+  { hull.resize(1); }
+  return hull;
+}
+
+static vector<point2_type> selectPoints(const vector<point2_type> & points, vector<size_t> indices)
+{
+  sort(indices.begin(),indices.end());
+  vector<point2_type> res;
+  for (size_t i=0;i<indices.size();i++)
+  { res.push_back(points[indices[i]]); }
+  return res;
+}
+
+void hullVertices(vector<point2_type> & points)
+{
+  points = selectPoints(points,monotoneChain(points));
+}
+
+
+// Integer vector in 3D, with 64 bits coordinates for the intermediate products 
+struct vector3{
+  long long x, y, z;
+  vector3(long long a, long long b, long long c) : x(a), y(b), z(c) {}
+  vector3(const point3_type & from, const point3_type & to) : x((long long)to[0]-from[0]), y((long long)to[1]-from[1]), z((long long)to[2]-from[2]) {}
+  bool isNull() const { return (x==0) && (y==0) && (z==0); }
+};
+
+static vector3 cross3(const vector3 & u, const vector3 & v)
+{
+  return vector3(u.y*v.z-u.z*v.y, u.z*v.x-u.x*v.z, u.x*v.y-u.y*v.x);
+}
+
+static long long dot3(const vector3 & u, const vector3 & v)
+{
+  return u.x*v.x+u.y*v.y+u.z*v.z;
+}
+
+// Sign of the volume of (a,b,c,d): >0 iff d lies above the plane of (a,b,c) 
+static int orientation(const point3_type & a, const point3_type & b, const point3_type & c, const point3_type & d)
+{
+  long long v = dot3(cross3(vector3(a,b),vector3(a,c)),vector3(a,d));
+  return (v>0)?1:((v<0)?-1:0);
+}
+
+static long long gcd(long long a, long long b)
+{
+  if (a<0) a=-a;
+  if (b<0) b=-b;
+  while (b!=0)
+  {
+    long long t = a%b;
+    a = b;
+    b = t;
+  }
+  return a;
+}
+
+static vector3 reduced(const vector3 & u)
+{
+  long long g = gcd(gcd(u.x,u.y),u.z);
+  if (g<=1)
+  { return u; }
+  return vector3(u.x/g,u.y/g,u.z/g);
+}
+
+static bool independent(const vector3 & u, const vector3 & v, const vector3 & w)
+{
+  __int128 d = (__int128)u.x*((__int128)v.y*w.z-(__int128)v.z*w.y)
+             - (__int128)u.y*((__int128)v.x*w.z-(__int128)v.z*w.x)
+             + (__int128)u.z*((__int128)v.x*w.y-(__int128)v.y*w.x);
+  return d!=0;
+}
+
+struct face3{
+  size_t v[3];
+  face3(size_t a, size_t b, size_t c) { v[0]=a; v[1]=b; v[2]=c; }
+};
+
+void hullVertices(vector<point3_type> & points)
+{
+  size_t n = points.size();
+  if (n<3)
+  { return; }
+  // Initial simplex
+  size_t i2 = n, i3 = n;
+  vector3 u(points[0],points[1]);
+  for (size_t k=2;(k<n)&&(i2==n);k++)
+  {
+    if (!cross3(u,vector3(points[0],points[k])).isNull())
+    { i2 = k; }
+  }
+  if (i2==n)
+  {
+    // Collinear points: both ends (first and last in lexicographic order)
+    point3_type first = points.front(), last = points.back();
+    points.clear();
+    points.push_back(first);
+    points.push_back(last);
+    return;
+  }
+  for (size_t k=2;(k<n)&&(i3==n);k++)
+  {
+    if (orientation(points[0],points[1],points[i2],points[k])!=0)
+    { i3 = k; }
+  }
+  if (i3==n)
+  {
+    // Flat polytope: hull of its projection on the plane of the two coordinates
+    // along which it is not degenerate
+    vector3 normal = cross3(u,vector3(points[0],points[i2]));
+    long long ax = llabs(normal.x), ay = llabs(normal.y), az = llabs(normal.z);
+    int drop = ((ax>=ay)&&(ax>=az))?0:((ay>=az)?1:2);
+    vector<point2_type> projected(n);
+    for (size_t k=0;k<n;k++)
+    {
+      int l = 0;
+      for (int d=0;d<3;d++)
+      {
+        if (d!=drop)
+        { projected[k][l++] = points[k][d]; }
+      }
+    }
+    // The projection may reverse the lexicographic order, so sort it along
+    vector<pair<point2_type,size_t> > order(n);
+    for (size_t k=0;k<n;k++)
+    { order[k] = make_pair(projected[k],k); }
+    sort(order.begin(),order.end());
+    for (size_t k=0;k<n;k++)
+    { projected[k] = order[k].first; }
+    vector<size_t> hull = monotoneChain(projected);
+    vector<size_t> indices;
+    for (size_t k=0;k<hull.size();k++)
+    { indices.push_back(order[hull[k]].second); }
+    sort(indices.begin(),indices.end());
+    vector<point3_type> res;
+    for (size_t k=0;k<indices.size();k++)
+    { res.push_back(points[indices[k]]); }
+    points = res;
+    return;
+  }
+
+  // Incremental hull, faces oriented so that the hull lies below them
+  size_t s[4] = {0,1,i2,i3};
+  vector<face3> faces;
+  for (int k=0;k<4;k++)
+  {
+    face3 f(s[(k+1)%4],s[(k+2)%4],s[(k+3)%4]);
+    if (orientation(points[f.v[0]],points[f.v[1]],points[f.v[2]],points[s[k]])>0)
+    { swap(f.v[1],f.v[2]); }
+    faces.push_back(f);
+  }
+  for (size_t p=1;p<n;p++)
+  {
+    if ((p==i2) || (p==i3))
+    { continue; }
+    set<pair<size_t,size_t> > edges;
+    vector<face3> kept;
+    for (size_t k=0;k<faces.size();k++)
+    {
+      const face3 & f = faces[k];
+      if (orientation(points[f.v[0]],points[f.v[1]],points[f.v[2]],points[p])>0)
+      {
+        for (int l=0;l<3;l++)
+        { edges.insert(make_pair(f.v[l],f.v[(l+1)%3])); }
+      }
+      else
+      { kept.push_back(f); }
+    }
+    if (edges.size()==0)
+    { continue; }
+    // Horizon: edges of visible faces whose other face is not visible
+    for (set<pair<size_t,size_t> >::const_iterator it=edges.begin();it!=edges.end();it++)
+    {
+      if (edges.find(make_pair(it->second,it->first))==edges.end())
+      { kept.push_back(face3(it->first,it->second,p)); }
+    }
+    faces.swap(kept);
+  }
+
+  // Vertices of the triangulated hull which lie on facets or edges have normals 
+  // spanning a plane at most
+  vector<vector<vector3> > normals(n);
+  for (size_t k=0;k<faces.size();k++)
+  {
+    const face3 & f = faces[k];
+    vector3 normal = reduced(cross3(vector3(points[f.v[0]],points[f.v[1]]),vector3(points[f.v[0]],points[f.v[2]])));
+    for (int l=0;l<3;l++)
+    { normals[f.v[l]].push_back(normal); }
+  }
+  vector<point3_type> res;
+  for (size_t k=0;k<n;k++)
+  {
+    const vector<vector3> & nv = normals[k];
+    bool extreme = false;
+    for (size_t a=1;(a<nv.size())&&!extreme;a++)
+    {
+      if (!cross3(nv[0],nv[a]).isNull())
+      {
+        for (size_t b=a+1;(b<nv.size())&&!extreme;b++)
+        { extreme = independent(nv[0],nv[a],nv[b]); }
+      }
+    }
+    if (extreme)
+    { res.push_back(points[k]); }
+  }
+  points = res;
+}
+
+
+static Polygon2D toPolygon(const vector<point2_type> & points)
+{
+  vector<Polygon2D::vertex_type> vertices;
+  for (size_t i=0;i<points.size();i++)
+  { vertices.push_back(Polygon2D::vertex_type(points[i][0],points[i][1])); }
+  return Polygon2D(vertices);
+}
+
+static void fromPolygon(const Polygon2D & p, vector<point2_type> & points)
+{
+  points.clear();
+  for (size_t i=0;i<p.size();i++)
+  {
+    point2_type q = {{(int32_t)p.getVertices()[i].first,(int32_t)p.getVertices()[i].second}};
+    points.push_back(q);
+  }
+  sort(points.begin(),points.end());
+}
+
+static void splitLayers(const vector<point3_type> & points, map<int32_t,vector<point2_type> > & layers)
+{
+  for (size_t i=0;i<points.size();i++)
+  {
+    point2_type q = {{points[i][0],points[i][1]}};
+    layers[points[i][2]].push_back(q);
+  }
+}
+
+static void mergeLayers(map<int32_t,vector<point2_type> > & layers, vector<point3_type> & points)
+{
+  points.clear();
+  for (map<int32_t,vector<point2_type> >::iterator it=layers.begin();it!=layers.end();it++)
+  {
+    vector<point2_type> & layer = it->second;
+    for (size_t i=0;i<layer.size();i++)
+    {
+      point3_type q = {{layer[i][0],layer[i][1],it->first}};
+      points.push_back(q);
+    }
+  }
+  sort(points.begin(),points.end());
+  hullVertices(points);
+}
+
+double simplifyVertices(vector<point2_type> & points, size_t budget, double g, double b)
+{
+  Polygon2D p = toPolygon(points).simplify(budget,g,b);
+  fromPolygon(p,points);
+  return p.getError();
+}
+
+// The hull of the union of the layers is within the largest of their 
+// Hausdorff distances
+double simplifyVertices(vector<point3_type> & points, size_t budget, double g, double b)
+{
+  map<int32_t,vector<point2_type> > layers;
+  splitLayers(points,layers);
+  size_t total = points.size();
+  double error = 0.;
+  for (map<int32_t,vector<point2_type> >::iterator it=layers.begin();it!=layers.end();it++)
+  {
+    vector<point2_type> & layer = it->second;
+    error = max(error,simplifyVertices(layer,max((size_t)3,budget*layer.size()/total),g,b));
+  }
+  mergeLayers(layers,points);
+  return error;
+}
+
+void restrictVerticesToCone(vector<point2_type> & points, double g1, double b1, double g2, double b2)
+{
+  fromPolygon(toPolygon(points).restrictToCone(g1,b1,g2,b2),points);
+}
+
+// A vertex optimal for costs (g,b,w) is optimal for (g,b) within its layer
+void restrictVerticesToCone(vector<point3_type> & points, double g1, double b1, double g2, double b2)
+{
+  map<int32_t,vector<point2_type> > layers;
+  splitLayers(points,layers);
+  for (map<int32_t,vector<point2_type> >::iterator it=layers.begin();it!=layers.end();it++)
+  {
+    restrictVerticesToCone(it->second,g1,b1,g2,b2);
+  }
+  mergeLayers(layers,points);
+}
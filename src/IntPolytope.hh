@@ -0,0 +1,240 @@
+/*  DeClone: A software for computing and analyzing ancestral adjacency scenarios.
+ *  Copyright (C) 2015 Cedric Chauve, Yann Ponty, Ashok Rajaraman, Joao P.P. Zanetti
+ *
+ *  This file is part of DeClone.
+ *  
+ *  DeClone is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  DeClone is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with DeClone.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Contact: <yann.ponty@lix.polytechnique.fr>.
+ *
+ *
+ *  DeClone uses the Quickhull algorithm implementation programmed by 
+ *  Anatoly V. Tomilov. The code is available on <https://bitbucket.org/tomilov/quickhull/src/585267abb3a63794c04fc8325aa9ec9f726112ed/include/quickhull.hpp?at=master>.
+ *
+ *  Contact: <tomilovanatoliy@gmail.com>
+ */
+
+#ifndef INT_POLYTOPE_HH
+#define INT_POLYTOPE_HH
+
+#include <iostream>
+#include <vector>
+#include <array>
+#include <algorithm>
+#include <stdint.h>
+
+#include "ConvexPolytope.hh"
+
+// Extreme points of the convex hull of a sorted set of points, computed with
+// exact integer predicates (monotone chain in 2D, incremental hull in 3D). 
+// Points lying on a facet or an edge are discarded.
+void hullVertices(std::vector<std::array<int32_t,2> > & points);
+void hullVertices(std::vector<std::array<int32_t,3> > & points);
+
+// Reduces the vertices of a polytope to about budget ones (see 
+// Polygon2D::simplify, applied to each layer of equal third coordinate in 3D),
+// and returns the Hausdorff distance of the approximation
+double simplifyVertices(std::vector<std::array<int32_t,2> > & points, size_t budget, double g, double b);
+double simplifyVertices(std::vector<std::array<int32_t,3> > & points, size_t budget, double g, double b);
+
+// Keeps the vertices of minimal cost g*x+b*y for some (g,b) in the cone 
+// spanned by (g1,b1) and (g2,b2) (see Polygon2D::restrictToCone), within each
+// layer of equal third coordinate in 3D
+void restrictVerticesToCone(std::vector<std::array<int32_t,2> > & points, double g1, double b1, double g2, double b2);
+void restrictVerticesToCone(std::vector<std::array<int32_t,3> > & points, double g1, double b1, double g2, double b2);
+
+// Polytope of fixed dimension D with integer coordinates (event counts). 
+// Points are stored contiguously, sorted in lexicographic order and without
+// duplicates, and are the vertices of the polytope once reduced (convexSum, 
+// minkovskiSum). An empty polytope stands for an impossible case (INF). 
+// Approximate polytopes (see simplify) carry an upper bound on their 
+// Hausdorff distance to the exact polytope.
+template<size_t D> class IntPolytope{
+  public:
+    typedef int32_t coord_type;
+    typedef std::array<coord_type,D> point_type;
+
+  private:
+    std::vector<point_type> points;
+    double error;
+
+    void normalize()
+    {
+      std::sort(points.begin(),points.end());
+      points.erase(std::unique(points.begin(),points.end()),points.end());
+    }
+
+    IntPolytope<D> translate(const point_type & t) const
+    {
+      IntPolytope<D> res(*this);
+      for (size_t i=0;i<res.points.size();i++)
+      {
+        for (size_t k=0;k<D;k++)
+        {
+          res.points[i][k] += t[k];
+        }
+      }
+      return res;
+    }
+
+  public:
+    IntPolytope() : error(0.)
+    {
+    }
+
+    IntPolytope(const coord_type * point) : error(0.)
+    {
+      point_type p;
+      std::copy(point,point+D,p.begin());
+      points.push_back(p);
+    }
+
+    IntPolytope(const std::vector<point_type> & p) : points(p), error(0.)
+    {
+      normalize();
+    }
+
+    bool isEmpty() const
+    {
+      return points.empty();
+    }
+
+    size_t size() const
+    {
+      return points.size();
+    }
+
+    const std::vector<point_type> & getPoints() const
+    {
+      return points;
+    }
+
+    double getError() const
+    {
+      return error;
+    }
+
+    IntPolytope<D> convexHull() const
+    {
+      IntPolytope<D> res(*this);
+      hullVertices(res.points);
+      return res;
+    }
+
+    // Minkowski sum, reduced to its extreme points
+    IntPolytope<D> minkovskiSum(const IntPolytope<D> & p2) const
+    {
+      if (isEmpty() || p2.isEmpty())
+      {
+        return IntPolytope<D>();
+      }
+      // Translations keep the lexicographic order
+      if (p2.size()==1)
+      {
+        IntPolytope<D> res = translate(p2.points[0]);
+        res.error += p2.error;
+        return res;
+      }
+      if (size()==1)
+      {
+        IntPolytope<D> res = p2.translate(points[0]);
+        res.error += error;
+        return res;
+      }
+      IntPolytope<D> res;
+      res.error = error+p2.error;
+      res.points.resize(size()*p2.size());
+      size_t k = 0;
+      for (size_t i=0;i<size();i++)
+      {
+        for (size_t j=0;j<p2.size();j++)
+        {
+          for (size_t l=0;l<D;l++)
+          {
+            res.points[k][l] = points[i][l]+p2.points[j][l];
+          }
+          k++;
+        }
+      }
+      res.normalize();
+      hullVertices(res.points);
+      return res;
+    }
+
+    // Convex hull of the union, reduced to its extreme points
+    IntPolytope<D> convexSum(const IntPolytope<D> & p2) const
+    {
+      if (isEmpty())
+      {
+        return p2;
+      }
+      if (p2.isEmpty())
+      {
+        return *this;
+      }
+      IntPolytope<D> res;
+      res.error = std::max(error,p2.error);
+      res.points.resize(size()+p2.size());
+      std::merge(points.begin(),points.end(),p2.points.begin(),p2.points.end(),res.points.begin());
+      res.points.erase(std::unique(res.points.begin(),res.points.end()),res.points.end());
+      hullVertices(res.points);
+      return res;
+    }
+
+    // Inner approximation by about budget vertices, keeping those of minimal 
+    // cost g*x+b*y
+    IntPolytope<D> simplify(size_t budget, double g, double b) const
+    {
+      IntPolytope<D> res(*this);
+      if (size()>budget)
+      {
+        res.error += simplifyVertices(res.points,budget,g,b);
+      }
+      return res;
+    }
+
+    // Vertices that may be optimal for some costs in the cone spanned by 
+    // (g1,b1) and (g2,b2), and any value of the other coordinates
+    IntPolytope<D> restrictToCone(double g1, double b1, double g2, double b2) const
+    {
+      IntPolytope<D> res(*this);
+      restrictVerticesToCone(res.points,g1,b1,g2,b2);
+      return res;
+    }
+
+    // Generic representation, used for the normals and the output
+    Polytope toPolytope() const
+    {
+      points_type pts(points.size());
+      for (size_t i=0;i<points.size();i++)
+      {
+        pts[i].resize(D);
+        for (size_t k=0;k<D;k++)
+        {
+          pts[i][k] = points[i][k];
+        }
+      }
+      Polytope res(D,pts);
+      res.setError(error);
+      return res;
+    }
+
+    friend std::ostream & operator<<(std::ostream & o, const IntPolytope<D> & p)
+    {
+      o<<p.toPolytope();
+      return o;
+    }
+};
+
+#endif
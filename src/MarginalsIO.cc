@@ -0,0 +1,225 @@
+/*  DeClone: A software for computing and analyzing ancestral adjacency scenarios.
+ *  Copyright (C) 2015 Cedric Chauve, Yann Ponty, Ashok Rajaraman, Joao P.P. Zanetti
+ *
+ *  This file is part of DeClone.
+ *  
+ *  DeClone is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  DeClone is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with DeClone.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Contact: <yann.ponty@lix.polytechnique.fr>.
+ *
+ *
+ *  DeClone uses the Quickhull algorithm implementation programmed by 
+ *  Anatoly V. Tomilov. The code is available on <https://bitbucket.org/tomilov/quickhull/src/585267abb3a63794c04fc8325aa9ec9f726112ed/include/quickhull.hpp?at=master>.
+ *
+ *  Contact: <tomilovanatoliy@gmail.com>
+ */
+
+#include "MarginalsIO.hh"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "OperationsList.hh"
+
+int writeMarginals(string path, vector<RecTree*> & Dfo1, vector<RecTree*> & Dfo2, double*** W, double Z, double threshold)
+{
+     vector<double> probas;
+     vector<int32_t> nd1;
+     vector<int32_t> nd2;
+     vector<int32_t> species;
+     map<string,int> speciesIds;
+     vector<string> speciesNames;
+     vector<CaseLabel> c1Lbls = C1Labels();
+
+     for (int i = 0; i < Dfo1.size(); i++)
+     {
+          for (int j = 0; j < Dfo2.size(); j++)
+          {
+               if (!sameSpecies(Dfo1[i],Dfo2[j]))
+               { continue; }
+               double c1Weight = 0.0;
+               for (int k = 0; k < c1Lbls.size(); k++)
+               {
+                    c1Weight += W[Dfo1[i]->getIndex()][Dfo2[j]->getIndex()][c1Lbls[k]];
+               }
+               double p = c1Weight/Z;
+               if (p < threshold)
+               { continue; }
+               string s = Dfo1[i]->getSpecies();
+               map<string,int>::iterator it = speciesIds.find(s);
+               if (it == speciesIds.end())
+               {
+                    speciesIds[s] = speciesNames.size();
+                    speciesNames.push_back(s);
+                    it = speciesIds.find(s);
+               }
+               probas.push_back(p);
+               nd1.push_back(atoi(Dfo1[i]->getND().c_str()));
+               nd2.push_back(atoi(Dfo2[j]->getND().c_str()));
+               species.push_back(it->second);
+          }
+     }
+
+     FILE * f = fopen(path.c_str(),"wb");
+     if (f==NULL)
+     { return -1; }
+     MarginalsHeader h;
+     memcpy(h.magic, MARGINALS_MAGIC, 4);
+     h.version = MARGINALS_VERSION;
+     h.nbRecords = probas.size();
+     h.nbSpecies = speciesNames.size();
+     h.threshold = threshold;
+     fwrite(&h, sizeof(MarginalsHeader), 1, f);
+     uint32_t n = probas.size();
+     if (n>0)
+     {
+          fwrite(&probas[0], sizeof(double), n, f);
+          fwrite(&nd1[0], sizeof(int32_t), n, f);
+          fwrite(&nd2[0], sizeof(int32_t), n, f);
+          fwrite(&species[0], sizeof(int32_t), n, f);
+     }
+     for (int k = 0; k < speciesNames.size(); k++)
+     {
+          uint32_t len = speciesNames[k].size();
+          fwrite(&len, sizeof(uint32_t), 1, f);
+          fwrite(speciesNames[k].c_str(), 1, len, f);
+     }
+     fclose(f);
+     return n;
+}
+
+MarginalsFile::MarginalsFile()
+{
+     data = NULL;
+     length = 0;
+     header = NULL;
+}
+
+MarginalsFile::~MarginalsFile()
+{
+     close();
+}
+
+bool MarginalsFile::open(string path)
+{
+     close();
+     int fd = ::open(path.c_str(), O_RDONLY);
+     if (fd<0)
+     { return false; }
+     struct stat st;
+     if ((fstat(fd,&st)!=0) || (st.st_size < sizeof(MarginalsHeader)))
+     {
+          ::close(fd);
+          return false;
+     }
+     length = st.st_size;
+     data = mmap(NULL, length, PROT_READ, MAP_PRIVATE, fd, 0);
+     ::close(fd);
+     if (data==MAP_FAILED)
+     {
+          data = NULL;
+          return false;
+     }
+     header = (const MarginalsHeader *) data;
+     size_t n = header->nbRecords;
+     size_t columns = sizeof(MarginalsHeader) + n*(sizeof(double)+3*sizeof(int32_t));
+     if ((memcmp(header->magic, MARGINALS_MAGIC, 4)!=0) || (header->version!=MARGINALS_VERSION) || (columns > length))
+     {
+          close();
+          return false;
+     }
+     const char * base = (const char *) data;
+     probas = (const double *) (base + sizeof(MarginalsHeader));
+     nd1 = (const int32_t *) (probas + n);
+     nd2 = nd1 + n;
+     species = nd2 + n;
+     const char * p = (const char *) (species + n);
+     for (int k = 0; k < header->nbSpecies; k++)
+     {
+          uint32_t len;
+          if (p + sizeof(uint32_t) > base + length)
+          {
+               close();
+               return false;
+          }
+          memcpy(&len, p, sizeof(uint32_t));
+          p += sizeof(uint32_t);
+          if (p + len > base + length)
+          {
+               close();
+               return false;
+          }
+          speciesNames.push_back(string(p,len));
+          p += len;
+     }
+     // Species ids are checked once here, so that getSpecies can trust them
+     for (size_t k = 0; k < n; k++)
+     {
+          if ((species[k]<0) || ((uint32_t) species[k]>=header->nbSpecies))
+          {
+               close();
+               return false;
+          }
+     }
+     return true;
+}
+
+void MarginalsFile::close()
+{
+     if (data!=NULL)
+     { munmap(data, length); }
+     data = NULL;
+     header = NULL;
+     length = 0;
+     speciesNames.clear();
+}
+
+int MarginalsFile::size() const
+{ return (header? header->nbRecords : 0); }
+
+double MarginalsFile::getThreshold() const
+{ return header->threshold; }
+
+double MarginalsFile::getProbability(int k) const
+{ return probas[k]; }
+
+int MarginalsFile::getND1(int k) const
+{ return nd1[k]; }
+
+int MarginalsFile::getND2(int k) const
+{ return nd2[k]; }
+
+const string & MarginalsFile::getSpecies(int k) const
+{ return speciesNames[species[k]]; }
+
+const double * MarginalsFile::probabilities() const
+{ return probas; }
+
+bool dumpMarginals(string path, ostream & o)
+{
+     MarginalsFile f;
+     if (!f.open(path))
+     { return false; }
+     for (int k = 0; k < f.size(); k++)
+     {
+          o << f.getND1(k) << "\t" << f.getND2(k) << "\t" << f.getSpecies(k) << "\t" << f.getProbability(k) << endl;
+     }
+     return true;
+}
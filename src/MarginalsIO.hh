@@ -0,0 +1,96 @@
+/*  DeClone: A software for computing and analyzing ancestral adjacency scenarios.
+ *  Copyright (C) 2015 Cedric Chauve, Yann Ponty, Ashok Rajaraman, Joao P.P. Zanetti
+ *
+ *  This file is part of DeClone.
+ *  
+ *  DeClone is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  DeClone is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with DeClone.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Contact: <yann.ponty@lix.polytechnique.fr>.
+ *
+ *
+ *  DeClone uses the Quickhull algorithm implementation programmed by 
+ *  Anatoly V. Tomilov. The code is available on <https://bitbucket.org/tomilov/quickhull/src/585267abb3a63794c04fc8325aa9ec9f726112ed/include/quickhull.hpp?at=master>.
+ *
+ *  Contact: <tomilovanatoliy@gmail.com>
+ */
+
+#include <string>
+#include <vector>
+#include <stdint.h>
+#include "RecTrees.hh"
+
+#ifndef MARGINALS_IO_HH
+#define MARGINALS_IO_HH
+
+using namespace std;
+
+// Binary (columnar) format for the probabilities of ancestral adjacencies.
+// 
+// Only the pairs of nodes having the same species, and a probability at least 
+// equal to some threshold, are stored. Layout (little-endian on usual hosts):
+//   Header: "DCMG", version, nb. records n, nb. species s (uint32), threshold (double)
+//   Columns: probability (n doubles), ND of node 1, ND of node 2, species id (n int32 each)
+//   Species dictionary: s strings, each stored as its length (uint32) followed by its chars
+// Numerical columns are 8-byte aligned, so that the file can be memory-mapped.
+
+#define MARGINALS_MAGIC "DCMG"
+#define MARGINALS_VERSION 1
+
+struct MarginalsHeader{
+     char magic[4];
+     uint32_t version;
+     uint32_t nbRecords;
+     uint32_t nbSpecies;
+     double threshold;
+};
+
+// Writes the probabilities of ancestral adjacencies from the weights W of the 
+// outside DP, and the partition function Z. Returns the number of records.
+int writeMarginals(string path, vector<RecTree*> & Dfo1, vector<RecTree*> & Dfo2, double*** W, double Z, double threshold);
+
+// Read-only access to a memory-mapped marginals file 
+class MarginalsFile{
+private:
+     void * data;
+     size_t length;
+     const MarginalsHeader * header;
+     const double * probas;
+     const int32_t * nd1;
+     const int32_t * nd2;
+     const int32_t * species;
+     vector<string> speciesNames;
+
+public:
+     MarginalsFile();
+     ~MarginalsFile();
+
+     // Returns false if the file cannot be mapped, or is not a marginals file
+     bool open(string path);
+     void close();
+
+     int size() const;
+     double getThreshold() const;
+     double getProbability(int k) const;
+     int getND1(int k) const;
+     int getND2(int k) const;
+     const string & getSpecies(int k) const;
+
+     // Columns, for vectorised scans
+     const double * probabilities() const;
+};
+
+// Outputs the records of a marginals file as text (one 'nd1 nd2 species proba' per line)
+bool dumpMarginals(string path, ostream & o);
+
+#endif
@@ -0,0 +1,153 @@
+/*  DeClone: A software for computing and analyzing ancestral adjacency scenarios.
+ *  Copyright (C) 2015 Cedric Chauve, Yann Ponty, Ashok Rajaraman, Joao P.P. Zanetti
+ *
+ *  This file is part of DeClone.
+ *  
+ *  DeClone is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  DeClone is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with DeClone.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Contact: <yann.ponty@lix.polytechnique.fr>.
+ *
+ *
+ *  DeClone uses the Quickhull algorithm implementation programmed by 
+ *  Anatoly V. Tomilov. The code is available on <https://bitbucket.org/tomilov/quickhull/src/585267abb3a63794c04fc8325aa9ec9f726112ed/include/quickhull.hpp?at=master>.
+ *
+ *  Contact: <tomilovanatoliy@gmail.com>
+ */
+
+#include "NormalFan.hh"
+
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+
+typedef Polygon2D::vertex_type vertex_type;
+
+// 0 for the directions in [0,pi), 1 for [pi,2pi)
+template<class T> static int halfPlane(T x, T y)
+{
+  return (y<0 || (y==0 && x<0))?1:0;
+}
+
+// Is the polar angle of edge e smaller than that of direction (x,y)?
+static bool edgeBefore(const vertex_type & e, double x, double y)
+{
+  int h1 = halfPlane<double>(e.first,e.second);
+  int h2 = halfPlane<double>(x,y);
+  if (h1!=h2)
+  { return h1<h2; }
+  return ((double)e.first)*y - ((double)e.second)*x > 0;
+}
+
+NormalFan2D::NormalFan2D(const Polygon2D & p) : polygon(p)
+{
+  const vector<vertex_type> & v = polygon.getVertices();
+  if (v.size()>1)
+  {
+    for (size_t k=0;k<v.size();k++)
+    {
+      const vertex_type & next = v[(k+1)%v.size()];
+      edges.push_back(vertex_type(next.first-v[k].first,next.second-v[k].second));
+    }
+  }
+}
+
+int NormalFan2D::optimalVertex(double g, double b) const
+{
+  if (polygon.isEmpty())
+  { return -1; }
+  // Moving along an edge e decreases the cost iff (g,b).e<0. From the lowest 
+  // vertex, the first edge that does not decrease the cost has the first angle 
+  // after that of (b,-g), i.e. the cost rotated by -pi/2.
+  size_t lo = 0, hi = edges.size();
+  while (lo<hi)
+  {
+    size_t mid = (lo+hi)/2;
+    if (edgeBefore(edges[mid],b,-g))
+    { lo = mid+1; }
+    else
+    { hi = mid; }
+  }
+  return (lo==edges.size())? 0 : lo;
+}
+
+const vertex_type & NormalFan2D::getVertex(int k) const
+{
+  return polygon.getVertices()[k];
+}
+
+
+NormalFan::NormalFan(const Polytope & p)
+{
+  dimension = p.getDimension();
+  map<double,vector<vertex_type> > byLevel;
+  const points_type & points = p.getPoints();
+  for (size_t k=0;k<points.size();k++)
+  {
+    double level = (dimension>2)? points[k][2] : 0.;
+    byLevel[level].push_back(vertex_type((Polygon2D::coord_type)points[k][0],(Polygon2D::coord_type)points[k][1]));
+  }
+  for (map<double,vector<vertex_type> >::iterator it=byLevel.begin();it!=byLevel.end();it++)
+  {
+    levels.push_back(it->first);
+    layers.push_back(NormalFan2D(Polygon2D(it->second)));
+  }
+}
+
+bool NormalFan::optimalVertex(const vector<double> & costs, point_type & vertex, double & cost) const
+{
+  double g = (costs.size()>0)? costs[0] : 0.;
+  double b = (costs.size()>1)? costs[1] : 0.;
+  double w = (costs.size()>2)? costs[2] : 0.;
+  bool found = false;
+  for (size_t l=0;l<layers.size();l++)
+  {
+    int k = layers[l].optimalVertex(g,b);
+    if (k<0)
+    { continue; }
+    const vertex_type & v = layers[l].getVertex(k);
+    double c = g*v.first + b*v.second + w*levels[l];
+    if (!found || (c<cost))
+    {
+      found = true;
+      cost = c;
+      vertex.resize(dimension);
+      vertex[0] = v.first;
+      vertex[1] = v.second;
+      if (dimension>2)
+      { vertex[2] = levels[l]; }
+    }
+  }
+  return found;
+}
+
+bool loadCostVectors(string path, vector<vector<double> > & result)
+{
+  ifstream in(path.c_str());
+  if (!in.good())
+  { return false; }
+  string line;
+  while (getline(in,line))
+  {
+    if ((line.size()==0) || (line[0]=='#'))
+    { continue; }
+    istringstream fields(line);
+    vector<double> costs;
+    double c;
+    while (fields >> c)
+    { costs.push_back(c); }
+    if (costs.size()>0)
+    { result.push_back(costs); }
+  }
+  return true;
+}
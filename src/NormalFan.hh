@@ -0,0 +1,78 @@
+/*  DeClone: A software for computing and analyzing ancestral adjacency scenarios.
+ *  Copyright (C) 2015 Cedric Chauve, Yann Ponty, Ashok Rajaraman, Joao P.P. Zanetti
+ *
+ *  This file is part of DeClone.
+ *  
+ *  DeClone is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  DeClone is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with DeClone.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Contact: <yann.ponty@lix.polytechnique.fr>.
+ *
+ *
+ *  DeClone uses the Quickhull algorithm implementation programmed by 
+ *  Anatoly V. Tomilov. The code is available on <https://bitbucket.org/tomilov/quickhull/src/585267abb3a63794c04fc8325aa9ec9f726112ed/include/quickhull.hpp?at=master>.
+ *
+ *  Contact: <tomilovanatoliy@gmail.com>
+ */
+
+#ifndef NORMAL_FAN_HH
+#define NORMAL_FAN_HH
+
+#include <string>
+#include <vector>
+#include <map>
+#include <stdint.h>
+
+#include "ConvexPolytope.hh"
+#include "Polygon2D.hh"
+
+using namespace std;
+
+// Normal fan of a convex polygon: the edges, sorted by polar angle from the 
+// lowest vertex, delimit the cones of costs (g,b) for which each vertex has 
+// minimal cost. A query is a binary search of the angle of the cost.
+class NormalFan2D{
+  private:
+    Polygon2D polygon;
+    vector<Polygon2D::vertex_type> edges;
+
+  public:
+    NormalFan2D(const Polygon2D & p);
+
+    // Index of a vertex of minimal cost g*x+b*y (-1 if empty)
+    int optimalVertex(double g, double b) const;
+    const Polygon2D::vertex_type & getVertex(int k) const;
+};
+
+// Normal fan of a polytope of dimension 2 or 3, whose points are split into 
+// layers along the third coordinate (e.g. the number of occurrences of an 
+// adjacency, for -l), each being queried through its 2D normal fan
+class NormalFan{
+  private:
+    size_t dimension;
+    vector<double> levels;
+    vector<NormalFan2D> layers;
+
+  public:
+    NormalFan(const Polytope & p);
+
+    // Vertex minimizing the scalar product with the cost vector (of 2 or 3 
+    // values), false if the polytope is empty
+    bool optimalVertex(const vector<double> & costs, point_type & vertex, double & cost) const;
+};
+
+// Loads cost vectors, one per line (e.g. 'g b' for -y, 'g b w' for -l). 
+// Returns false if the file cannot be read.
+bool loadCostVectors(string path, vector<vector<double> > & result);
+
+#endif
@@ -0,0 +1,342 @@
+#include "OperationsList.hh"
+using namespace std;
+string label2String(CaseLabel c) {
+    switch(c) {
+     case (C0_EXTANT_EXTANT):{
+       return "C0_EXTANT_EXTANT";
+     }
+     break;
+     case (C0_GLOS_ESG):{
+       return "C0_GLOS_ESG";
+     }
+     break;
+     case (C0_ESG_GLOS):{
+       return "C0_ESG_GLOS";
+     }
+     break;
+     case (C0_GLOS_GLOS):{
+       return "C0_GLOS_GLOS";
+     }
+     break;
+     case (C0_ES_GDUP_C0V1V2A_C0V1V2B):{
+       return "C0_ES_GDUP_C0V1V2A_C0V1V2B";
+     }
+     break;
+     case (C0_ES_GDUP_C0V1V2B_C1V1V2A):{
+       return "C0_ES_GDUP_C0V1V2B_C1V1V2A";
+     }
+     break;
+     case (C0_ES_GDUP_C0V1V2A_C1V1V2B):{
+       return "C0_ES_GDUP_C0V1V2A_C1V1V2B";
+     }
+     break;
+     case (C0_ES_GDUP_C1V1V2A_C1V1V2B):{
+       return "C0_ES_GDUP_C1V1V2A_C1V1V2B";
+     }
+     break;
+     case (C0_GDUP_ES_C0V1AV2_C0V1BV2):{
+       return "C0_GDUP_ES_C0V1AV2_C0V1BV2";
+     }
+     break;
+     case (C0_GDUP_ES_C0V1AV2_C1V1BV2):{
+       return "C0_GDUP_ES_C0V1AV2_C1V1BV2";
+     }
+     break;
+     case (C0_GDUP_ES_C0V1BV2_C1V1AV2):{
+       return "C0_GDUP_ES_C0V1BV2_C1V1AV2";
+     }
+     break;
+     case (C0_GDUP_ES_C1V1AV2_C1V1BV2):{
+       return "C0_GDUP_ES_C1V1AV2_C1V1BV2";
+     }
+     break;
+     case (C0_SPEC_SPEC_C0V1AV2B_C0V1BV2A):{
+       return "C0_SPEC_SPEC_C0V1AV2B_C0V1BV2A";
+     }
+     break;
+     case (C0_SPEC_SPEC_C0V1BV2A_C1V1AV2B):{
+       return "C0_SPEC_SPEC_C0V1BV2A_C1V1AV2B";
+     }
+     break;
+     case (C0_SPEC_SPEC_C0V1AV2B_C1V1BV2A):{
+       return "C0_SPEC_SPEC_C0V1AV2B_C1V1BV2A";
+     }
+     break;
+     case (C0_SPEC_SPEC_C1V1AV2B_C1V1BV2A):{
+       return "C0_SPEC_SPEC_C1V1AV2B_C1V1BV2A";
+     }
+     break;
+     case (C0_SPEC_SPEC_C0V1AV2A_C0V1BV2B):{
+       return "C0_SPEC_SPEC_C0V1AV2A_C0V1BV2B";
+     }
+     break;
+     case (C0_SPEC_SPEC_C0V1BV2B_C1V1AV2A):{
+       return "C0_SPEC_SPEC_C0V1BV2B_C1V1AV2A";
+     }
+     break;
+     case (C0_SPEC_SPEC_C0V1AV2A_C1V1BV2B):{
+       return "C0_SPEC_SPEC_C0V1AV2A_C1V1BV2B";
+     }
+     break;
+     case (C0_SPEC_SPEC_C1V1AV2A_C1V1BV2B):{
+       return "C0_SPEC_SPEC_C1V1AV2A_C1V1BV2B";
+     }
+     break;
+     case (C0_GDUP_GDUP_C0V1AV2_C0V1BV2):{
+       return "C0_GDUP_GDUP_C0V1AV2_C0V1BV2";
+     }
+     break;
+     case (C0_GDUP_GDUP_C0V1AV2_C1V1BV2):{
+       return "C0_GDUP_GDUP_C0V1AV2_C1V1BV2";
+     }
+     break;
+     case (C0_GDUP_GDUP_C0V1BV2_C1V1AV2):{
+       return "C0_GDUP_GDUP_C0V1BV2_C1V1AV2";
+     }
+     break;
+     case (C0_GDUP_GDUP_C1V1AV2_C1V1BV2):{
+       return "C0_GDUP_GDUP_C1V1AV2_C1V1BV2";
+     }
+     break;
+     case (C0_GDUP_GDUP_C0V1V2A_C0V1V2B):{
+       return "C0_GDUP_GDUP_C0V1V2A_C0V1V2B";
+     }
+     break;
+     case (C0_GDUP_GDUP_C0V1V2A_C1V1V2B):{
+       return "C0_GDUP_GDUP_C0V1V2A_C1V1V2B";
+     }
+     break;
+     case (C0_GDUP_GDUP_C0V1V2B_C1V1V2A):{
+       return "C0_GDUP_GDUP_C0V1V2B_C1V1V2A";
+     }
+     break;
+     case (C0_GDUP_GDUP_C1V1V2A_C1V1V2B):{
+       return "C0_GDUP_GDUP_C1V1V2A_C1V1V2B";
+     }
+     break;
+     case (C1_EXTANT_EXTANT):{
+       return "C1_EXTANT_EXTANT";
+     }
+     break;
+     case (C1_GLOS_ESG):{
+       return "C1_GLOS_ESG";
+     }
+     break;
+     case (C1_ESG_GLOS):{
+       return "C1_ESG_GLOS";
+     }
+     break;
+     case (C1_GLOS_GLOS):{
+       return "C1_GLOS_GLOS";
+     }
+     break;
+     case (C1_ES_GDUP_C0V1V2A_C1V1V2B):{
+       return "C1_ES_GDUP_C0V1V2A_C1V1V2B";
+     }
+     break;
+     case (C1_ES_GDUP_C0V1V2B_C1V1V2A):{
+       return "C1_ES_GDUP_C0V1V2B_C1V1V2A";
+     }
+     break;
+     case (C1_ES_GDUP_C1V1V2A_C1V1V2B):{
+       return "C1_ES_GDUP_C1V1V2A_C1V1V2B";
+     }
+     break;
+     case (C1_ES_GDUP_C0V1V2A_C0V1V2B):{
+       return "C1_ES_GDUP_C0V1V2A_C0V1V2B";
+     }
+     break;
+     case (C1_GDUP_ES_C0V1BV2_C1V1AV2):{
+       return "C1_GDUP_ES_C0V1BV2_C1V1AV2";
+     }
+     break;
+     case (C1_GDUP_ES_C0V1AV2_C1V1BV2):{
+       return "C1_GDUP_ES_C0V1AV2_C1V1BV2";
+     }
+     break;
+     case (C1_GDUP_ES_C1V1AV2_C1V1BV2):{
+       return "C1_GDUP_ES_C1V1AV2_C1V1BV2";
+     }
+     break;
+     case (C1_GDUP_ES_C0V1AV2_C0V1BV2):{
+       return "C1_GDUP_ES_C0V1AV2_C0V1BV2";
+     }
+     break;
+     case (C1_SPEC_SPEC_C1V1AV2B_C1V1BV2A):{
+       return "C1_SPEC_SPEC_C1V1AV2B_C1V1BV2A";
+     }
+     break;
+     case (C1_SPEC_SPEC_C0V1BV2A_C1V1AV2B):{
+       return "C1_SPEC_SPEC_C0V1BV2A_C1V1AV2B";
+     }
+     break;
+     case (C1_SPEC_SPEC_C0V1AV2B_C1V1BV2A):{
+       return "C1_SPEC_SPEC_C0V1AV2B_C1V1BV2A";
+     }
+     break;
+     case (C1_SPEC_SPEC_C0V1AV2B_C0V1BV2A):{
+       return "C1_SPEC_SPEC_C0V1AV2B_C0V1BV2A";
+     }
+     break;
+     case (C1_SPEC_SPEC_C1V1AV2A_C1V1BV2B):{
+       return "C1_SPEC_SPEC_C1V1AV2A_C1V1BV2B";
+     }
+     break;
+     case (C1_SPEC_SPEC_C0V1BV2B_C1V1AV2A):{
+       return "C1_SPEC_SPEC_C0V1BV2B_C1V1AV2A";
+     }
+     break;
+     case (C1_SPEC_SPEC_C0V1AV2A_C1V1BV2B):{
+       return "C1_SPEC_SPEC_C0V1AV2A_C1V1BV2B";
+     }
+     break;
+     case (C1_SPEC_SPEC_C0V1AV2A_C0V1BV2B):{
+       return "C1_SPEC_SPEC_C0V1AV2A_C0V1BV2B";
+     }
+     break;
+     case (C1_GDUP_GDUP_C0V1BV2_C1V1AV2):{
+       return "C1_GDUP_GDUP_C0V1BV2_C1V1AV2";
+     }
+     break;
+     case (C1_GDUP_GDUP_C0V1AV2_C1V1BV2):{
+       return "C1_GDUP_GDUP_C0V1AV2_C1V1BV2";
+     }
+     break;
+     case (C1_GDUP_GDUP_C1V1AV2_C1V1BV2):{
+       return "C1_GDUP_GDUP_C1V1AV2_C1V1BV2";
+     }
+     break;
+     case (C1_GDUP_GDUP_C0V1AV2_C0V1BV2):{
+       return "C1_GDUP_GDUP_C0V1AV2_C0V1BV2";
+     }
+     break;
+     case (C1_GDUP_GDUP_C0V1V2B_C1V1V2A):{
+       return "C1_GDUP_GDUP_C0V1V2B_C1V1V2A";
+     }
+     break;
+     case (C1_GDUP_GDUP_C0V1V2A_C1V1V2B):{
+       return "C1_GDUP_GDUP_C0V1V2A_C1V1V2B";
+     }
+     break;
+     case (C1_GDUP_GDUP_C1V1V2A_C1V1V2B):{
+       return "C1_GDUP_GDUP_C1V1V2A_C1V1V2B";
+     }
+     break;
+     case (C1_GDUP_GDUP_C0V1V2A_C0V1V2B):{
+       return "C1_GDUP_GDUP_C0V1V2A_C0V1V2B";
+     }
+     break;
+     case (C1_GDUP_GDUP_C0V1AV2B_C0V1BV2A_C1V1AV2A_C1V1BV2B):{
+       return "C1_GDUP_GDUP_C0V1AV2B_C0V1BV2A_C1V1AV2A_C1V1BV2B";
+     }
+     break;
+     case (C1_GDUP_GDUP_C0V1AV2B_C1V1AV2A_C1V1BV2A_C1V1BV2B):{
+       return "C1_GDUP_GDUP_C0V1AV2B_C1V1AV2A_C1V1BV2A_C1V1BV2B";
+     }
+     break;
+     case (C1_GDUP_GDUP_C0V1BV2A_C1V1AV2A_C1V1AV2B_C1V1BV2B):{
+       return "C1_GDUP_GDUP_C0V1BV2A_C1V1AV2A_C1V1AV2B_C1V1BV2B";
+     }
+     break;
+     case (C1_GDUP_GDUP_C1V1AV2A_C1V1AV2B_C1V1BV2A_C1V1BV2B):{
+       return "C1_GDUP_GDUP_C1V1AV2A_C1V1AV2B_C1V1BV2A_C1V1BV2B";
+     }
+     break;
+     case (C1_GDUP_GDUP_C0V1AV2B_C0V1BV2A_C0V1BV2B_C1V1AV2A):{
+       return "C1_GDUP_GDUP_C0V1AV2B_C0V1BV2A_C0V1BV2B_C1V1AV2A";
+     }
+     break;
+     case (C1_GDUP_GDUP_C0V1AV2B_C0V1BV2B_C1V1AV2A_C1V1BV2A):{
+       return "C1_GDUP_GDUP_C0V1AV2B_C0V1BV2B_C1V1AV2A_C1V1BV2A";
+     }
+     break;
+     case (C1_GDUP_GDUP_C0V1BV2A_C0V1BV2B_C1V1AV2A_C1V1AV2B):{
+       return "C1_GDUP_GDUP_C0V1BV2A_C0V1BV2B_C1V1AV2A_C1V1AV2B";
+     }
+     break;
+     case (C1_GDUP_GDUP_C0V1AV2A_C0V1AV2B_C0V1BV2A_C1V1BV2B):{
+       return "C1_GDUP_GDUP_C0V1AV2A_C0V1AV2B_C0V1BV2A_C1V1BV2B";
+     }
+     break;
+     case (C1_GDUP_GDUP_C0V1AV2A_C0V1AV2B_C1V1BV2A_C1V1BV2B):{
+       return "C1_GDUP_GDUP_C0V1AV2A_C0V1AV2B_C1V1BV2A_C1V1BV2B";
+     }
+     break;
+     case (C1_GDUP_GDUP_C0V1AV2A_C0V1BV2A_C1V1AV2B_C1V1BV2B):{
+       return "C1_GDUP_GDUP_C0V1AV2A_C0V1BV2A_C1V1AV2B_C1V1BV2B";
+     }
+     break;
+     case (C1_GDUP_GDUP_C0V1AV2A_C0V1BV2B_C1V1AV2B_C1V1BV2A):{
+       return "C1_GDUP_GDUP_C0V1AV2A_C0V1BV2B_C1V1AV2B_C1V1BV2A";
+     }
+     break;
+     case (C1_GDUP_GDUP_C0V1AV2A_C1V1AV2B_C1V1BV2A_C1V1BV2B):{
+       return "C1_GDUP_GDUP_C0V1AV2A_C1V1AV2B_C1V1BV2A_C1V1BV2B";
+     }
+     break;
+     case (C1_GDUP_GDUP_C0V1BV2B_C1V1AV2A_C1V1AV2B_C1V1BV2A):{
+       return "C1_GDUP_GDUP_C0V1BV2B_C1V1AV2A_C1V1AV2B_C1V1BV2A";
+     }
+     break;
+     case (C1_GDUP_GDUP_C0V1AV2A_C0V1BV2A_C0V1BV2B_C1V1AV2B):{
+       return "C1_GDUP_GDUP_C0V1AV2A_C0V1BV2A_C0V1BV2B_C1V1AV2B";
+     }
+     break;
+     case (C1_GDUP_GDUP_C0V1AV2A_C0V1AV2B_C0V1BV2B_C1V1BV2A):{
+       return "C1_GDUP_GDUP_C0V1AV2A_C0V1AV2B_C0V1BV2B_C1V1BV2A";
+     }
+     break;
+     case (C1_GDUP_GDUP_C0V1AV2A_C0V1AV2B_C0V1BV2A_C0V1BV2B):{
+       return "C1_GDUP_GDUP_C0V1AV2A_C0V1AV2B_C0V1BV2A_C0V1BV2B";
+     }
+     break;
+    }
+}
+vector<CaseLabel> C1Labels() {
+  vector<CaseLabel> result;
+  result.push_back(C1_EXTANT_EXTANT);
+  result.push_back(C1_GLOS_ESG);
+  result.push_back(C1_ESG_GLOS);
+  result.push_back(C1_GLOS_GLOS);
+  result.push_back(C1_ES_GDUP_C0V1V2A_C1V1V2B);
+  result.push_back(C1_ES_GDUP_C0V1V2B_C1V1V2A);
+  result.push_back(C1_ES_GDUP_C1V1V2A_C1V1V2B);
+  result.push_back(C1_ES_GDUP_C0V1V2A_C0V1V2B);
+  result.push_back(C1_GDUP_ES_C0V1BV2_C1V1AV2);
+  result.push_back(C1_GDUP_ES_C0V1AV2_C1V1BV2);
+  result.push_back(C1_GDUP_ES_C1V1AV2_C1V1BV2);
+  result.push_back(C1_GDUP_ES_C0V1AV2_C0V1BV2);
+  result.push_back(C1_SPEC_SPEC_C1V1AV2B_C1V1BV2A);
+  result.push_back(C1_SPEC_SPEC_C0V1BV2A_C1V1AV2B);
+  result.push_back(C1_SPEC_SPEC_C0V1AV2B_C1V1BV2A);
+  result.push_back(C1_SPEC_SPEC_C0V1AV2B_C0V1BV2A);
+  result.push_back(C1_SPEC_SPEC_C1V1AV2A_C1V1BV2B);
+  result.push_back(C1_SPEC_SPEC_C0V1BV2B_C1V1AV2A);
+  result.push_back(C1_SPEC_SPEC_C0V1AV2A_C1V1BV2B);
+  result.push_back(C1_SPEC_SPEC_C0V1AV2A_C0V1BV2B);
+  result.push_back(C1_GDUP_GDUP_C0V1BV2_C1V1AV2);
+  result.push_back(C1_GDUP_GDUP_C0V1AV2_C1V1BV2);
+  result.push_back(C1_GDUP_GDUP_C1V1AV2_C1V1BV2);
+  result.push_back(C1_GDUP_GDUP_C0V1AV2_C0V1BV2);
+  result.push_back(C1_GDUP_GDUP_C0V1V2B_C1V1V2A);
+  result.push_back(C1_GDUP_GDUP_C0V1V2A_C1V1V2B);
+  result.push_back(C1_GDUP_GDUP_C1V1V2A_C1V1V2B);
+  result.push_back(C1_GDUP_GDUP_C0V1V2A_C0V1V2B);
+  result.push_back(C1_GDUP_GDUP_C0V1AV2B_C0V1BV2A_C1V1AV2A_C1V1BV2B);
+  result.push_back(C1_GDUP_GDUP_C0V1AV2B_C1V1AV2A_C1V1BV2A_C1V1BV2B);
+  result.push_back(C1_GDUP_GDUP_C0V1BV2A_C1V1AV2A_C1V1AV2B_C1V1BV2B);
+  result.push_back(C1_GDUP_GDUP_C1V1AV2A_C1V1AV2B_C1V1BV2A_C1V1BV2B);
+  result.push_back(C1_GDUP_GDUP_C0V1AV2B_C0V1BV2A_C0V1BV2B_C1V1AV2A);
+  result.push_back(C1_GDUP_GDUP_C0V1AV2B_C0V1BV2B_C1V1AV2A_C1V1BV2A);
+  result.push_back(C1_GDUP_GDUP_C0V1BV2A_C0V1BV2B_C1V1AV2A_C1V1AV2B);
+  result.push_back(C1_GDUP_GDUP_C0V1AV2A_C0V1AV2B_C0V1BV2A_C1V1BV2B);
+  result.push_back(C1_GDUP_GDUP_C0V1AV2A_C0V1AV2B_C1V1BV2A_C1V1BV2B);
+  result.push_back(C1_GDUP_GDUP_C0V1AV2A_C0V1BV2A_C1V1AV2B_C1V1BV2B);
+  result.push_back(C1_GDUP_GDUP_C0V1AV2A_C0V1BV2B_C1V1AV2B_C1V1BV2A);
+  result.push_back(C1_GDUP_GDUP_C0V1AV2A_C1V1AV2B_C1V1BV2A_C1V1BV2B);
+  result.push_back(C1_GDUP_GDUP_C0V1BV2B_C1V1AV2A_C1V1AV2B_C1V1BV2A);
+  result.push_back(C1_GDUP_GDUP_C0V1AV2A_C0V1BV2A_C0V1BV2B_C1V1AV2B);
+  result.push_back(C1_GDUP_GDUP_C0V1AV2A_C0V1AV2B_C0V1BV2B_C1V1BV2A);
+  result.push_back(C1_GDUP_GDUP_C0V1AV2A_C0V1AV2B_C0V1BV2A_C0V1BV2B);
+  return result;
+}
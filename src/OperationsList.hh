@@ -0,0 +1,83 @@
+#ifndef OPERATIONS_HH
+#define OPERATIONS_HH
+#include <string>
+#include <vector>
+using namespace std;
+#define NUM_CASES 72
+typedef enum {
+   C0_ESG_GLOS,
+   C0_ES_GDUP_C0V1V2A_C0V1V2B,
+   C0_ES_GDUP_C0V1V2A_C1V1V2B,
+   C0_ES_GDUP_C0V1V2B_C1V1V2A,
+   C0_ES_GDUP_C1V1V2A_C1V1V2B,
+   C0_EXTANT_EXTANT,
+   C0_GDUP_ES_C0V1AV2_C0V1BV2,
+   C0_GDUP_ES_C0V1AV2_C1V1BV2,
+   C0_GDUP_ES_C0V1BV2_C1V1AV2,
+   C0_GDUP_ES_C1V1AV2_C1V1BV2,
+   C0_GDUP_GDUP_C0V1AV2_C0V1BV2,
+   C0_GDUP_GDUP_C0V1AV2_C1V1BV2,
+   C0_GDUP_GDUP_C0V1BV2_C1V1AV2,
+   C0_GDUP_GDUP_C0V1V2A_C0V1V2B,
+   C0_GDUP_GDUP_C0V1V2A_C1V1V2B,
+   C0_GDUP_GDUP_C0V1V2B_C1V1V2A,
+   C0_GDUP_GDUP_C1V1AV2_C1V1BV2,
+   C0_GDUP_GDUP_C1V1V2A_C1V1V2B,
+   C0_GLOS_ESG,
+   C0_GLOS_GLOS,
+   C0_SPEC_SPEC_C0V1AV2A_C0V1BV2B,
+   C0_SPEC_SPEC_C0V1AV2A_C1V1BV2B,
+   C0_SPEC_SPEC_C0V1AV2B_C0V1BV2A,
+   C0_SPEC_SPEC_C0V1AV2B_C1V1BV2A,
+   C0_SPEC_SPEC_C0V1BV2A_C1V1AV2B,
+   C0_SPEC_SPEC_C0V1BV2B_C1V1AV2A,
+   C0_SPEC_SPEC_C1V1AV2A_C1V1BV2B,
+   C0_SPEC_SPEC_C1V1AV2B_C1V1BV2A,
+   C1_ESG_GLOS,
+   C1_ES_GDUP_C0V1V2A_C0V1V2B,
+   C1_ES_GDUP_C0V1V2A_C1V1V2B,
+   C1_ES_GDUP_C0V1V2B_C1V1V2A,
+   C1_ES_GDUP_C1V1V2A_C1V1V2B,
+   C1_EXTANT_EXTANT,
+   C1_GDUP_ES_C0V1AV2_C0V1BV2,
+   C1_GDUP_ES_C0V1AV2_C1V1BV2,
+   C1_GDUP_ES_C0V1BV2_C1V1AV2,
+   C1_GDUP_ES_C1V1AV2_C1V1BV2,
+   C1_GDUP_GDUP_C0V1AV2A_C0V1AV2B_C0V1BV2A_C0V1BV2B,
+   C1_GDUP_GDUP_C0V1AV2A_C0V1AV2B_C0V1BV2A_C1V1BV2B,
+   C1_GDUP_GDUP_C0V1AV2A_C0V1AV2B_C0V1BV2B_C1V1BV2A,
+   C1_GDUP_GDUP_C0V1AV2A_C0V1AV2B_C1V1BV2A_C1V1BV2B,
+   C1_GDUP_GDUP_C0V1AV2A_C0V1BV2A_C0V1BV2B_C1V1AV2B,
+   C1_GDUP_GDUP_C0V1AV2A_C0V1BV2A_C1V1AV2B_C1V1BV2B,
+   C1_GDUP_GDUP_C0V1AV2A_C0V1BV2B_C1V1AV2B_C1V1BV2A,
+   C1_GDUP_GDUP_C0V1AV2A_C1V1AV2B_C1V1BV2A_C1V1BV2B,
+   C1_GDUP_GDUP_C0V1AV2B_C0V1BV2A_C0V1BV2B_C1V1AV2A,
+   C1_GDUP_GDUP_C0V1AV2B_C0V1BV2A_C1V1AV2A_C1V1BV2B,
+   C1_GDUP_GDUP_C0V1AV2B_C0V1BV2B_C1V1AV2A_C1V1BV2A,
+   C1_GDUP_GDUP_C0V1AV2B_C1V1AV2A_C1V1BV2A_C1V1BV2B,
+   C1_GDUP_GDUP_C0V1AV2_C0V1BV2,
+   C1_GDUP_GDUP_C0V1AV2_C1V1BV2,
+   C1_GDUP_GDUP_C0V1BV2A_C0V1BV2B_C1V1AV2A_C1V1AV2B,
+   C1_GDUP_GDUP_C0V1BV2A_C1V1AV2A_C1V1AV2B_C1V1BV2B,
+   C1_GDUP_GDUP_C0V1BV2B_C1V1AV2A_C1V1AV2B_C1V1BV2A,
+   C1_GDUP_GDUP_C0V1BV2_C1V1AV2,
+   C1_GDUP_GDUP_C0V1V2A_C0V1V2B,
+   C1_GDUP_GDUP_C0V1V2A_C1V1V2B,
+   C1_GDUP_GDUP_C0V1V2B_C1V1V2A,
+   C1_GDUP_GDUP_C1V1AV2A_C1V1AV2B_C1V1BV2A_C1V1BV2B,
+   C1_GDUP_GDUP_C1V1AV2_C1V1BV2,
+   C1_GDUP_GDUP_C1V1V2A_C1V1V2B,
+   C1_GLOS_ESG,
+   C1_GLOS_GLOS,
+   C1_SPEC_SPEC_C0V1AV2A_C0V1BV2B,
+   C1_SPEC_SPEC_C0V1AV2A_C1V1BV2B,
+   C1_SPEC_SPEC_C0V1AV2B_C0V1BV2A,
+   C1_SPEC_SPEC_C0V1AV2B_C1V1BV2A,
+   C1_SPEC_SPEC_C0V1BV2A_C1V1AV2B,
+   C1_SPEC_SPEC_C0V1BV2B_C1V1AV2A,
+   C1_SPEC_SPEC_C1V1AV2A_C1V1BV2B,
+   C1_SPEC_SPEC_C1V1AV2B_C1V1BV2A,
+} CaseLabel;
+string label2String(CaseLabel c);
+vector<CaseLabel> C1Labels();
+#endif
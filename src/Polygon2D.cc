@@ -0,0 +1,359 @@
+/*  DeClone: A software for computing and analyzing ancestral adjacency scenarios.
+ *  Copyright (C) 2015 Cedric Chauve, Yann Ponty, Ashok Rajaraman, Joao P.P. Zanetti
+ *
+ *  This file is part of DeClone.
+ *  
+ *  DeClone is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  DeClone is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with DeClone.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Contact: <yann.ponty@lix.polytechnique.fr>.
+ *
+ *
+ *  DeClone uses the Quickhull algorithm implementation programmed by 
+ *  Anatoly V. Tomilov. The code is available on <https://bitbucket.org/tomilov/quickhull/src/585267abb3a63794c04fc8325aa9ec9f726112ed/include/quickhull.hpp?at=master>.
+ *
+ *  Contact: <tomilovanatoliy@gmail.com>
+ */
+
+#include "Polygon2D.hh"
+
+#include <algorithm>
+#include <set>
+#include <cmath>
+
+using namespace std;
+
+typedef Polygon2D::coord_type coord_type;
+typedef Polygon2D::vertex_type vertex_type;
+
+
+static coord_type cross(const vertex_type & o, const vertex_type & a, const vertex_type & b)
+{
+  return (a.first-o.first)*(b.second-o.second) - (a.second-o.second)*(b.first-o.first);
+}
+
+static bool lowerLeft(const vertex_type & a, const vertex_type & b)
+{
+  return (a.second<b.second) || (a.second==b.second && a.first<b.first);
+}
+
+// 0 for the directions in [0,pi), 1 for [pi,2pi)
+static int halfPlane(const vertex_type & d)
+{
+  return (d.second<0 || (d.second==0 && d.first<0))?1:0;
+}
+
+// Exact comparison of the polar angles of two edges
+static int compareAngles(const vertex_type & d1, const vertex_type & d2)
+{
+  int h1 = halfPlane(d1);
+  int h2 = halfPlane(d2);
+  if (h1!=h2)
+  { return (h1<h2)?-1:1; }
+  coord_type c = d1.first*d2.second - d1.second*d2.first;
+  if (c>0)
+  { return -1; }
+  if (c<0)
+  { return 1; }
+  return 0;
+}
+
+
+Polygon2D::Polygon2D() : error(0.)
+{
+}
+
+Polygon2D::Polygon2D(coord_type x, coord_type y) : error(0.)
+{
+  vertices.push_back(vertex_type(x,y));
+}
+
+Polygon2D::Polygon2D(vector<vertex_type> points) : error(0.)
+{
+  sort(points.begin(),points.end());
+  points.erase(unique(points.begin(),points.end()),points.end());
+  size_t n = points.size();
+  if (n<3)
+  {
+    vertices = points;
+  }
+  else
+  {
+    // Andrew's monotone chain, collinear points are dropped
+    vertices.resize(2*n);
+    size_t k = 0;
+    for (size_t i=0;i<n;i++)
+    {
+      while (k>=2 && cross(vertices[k-2],vertices[k-1],points[i])<=0)
+      { k--; }
+      vertices[k++] = points[i];
+    }
+    for (size_t i=n-1,t=k+1;i>0;i--)
+    {
+      while (k>=t && cross(vertices[k-2],vertices[k-1],points[i-1])<=0)
+      { k--; }
+      vertices[k++] = points[i-1];
+    }
+    vertices.resize(k-1);
+  }
+  if (vertices.size()>1)
+  {
+    rotate(vertices.begin(),min_element(vertices.begin(),vertices.end(),lowerLeft),vertices.end());
+  }
+}
+
+bool Polygon2D::isEmpty() const
+{
+  return vertices.empty();
+}
+
+size_t Polygon2D::size() const
+{
+  return vertices.size();
+}
+
+const vector<vertex_type> & Polygon2D::getVertices() const
+{
+  return vertices;
+}
+
+double Polygon2D::getError() const
+{
+  return error;
+}
+
+Polygon2D Polygon2D::minkovskiSum(const Polygon2D & p2) const
+{
+  Polygon2D res;
+  if (isEmpty() || p2.isEmpty())
+  {
+    return res;
+  }
+  // The Hausdorff distance is subadditive w.r.t. Minkowski sums
+  res.error = error+p2.error;
+  const vector<vertex_type> & P = vertices;
+  const vector<vertex_type> & Q = p2.vertices;
+  size_t n = P.size();
+  size_t m = Q.size();
+  if (n==1 || m==1)
+  {
+    // Translation of the other polygon
+    const vertex_type & t = (n==1)?P[0]:Q[0];
+    res.vertices = (n==1)?Q:P;
+    for (size_t k=0;k<res.vertices.size();k++)
+    {
+      res.vertices[k].first += t.first;
+      res.vertices[k].second += t.second;
+    }
+    return res;
+  }
+  res.vertices.reserve(n+m);
+  // Both polygons start from their lowest vertex, so their edges are 
+  // sorted by increasing polar angle, and can simply be merged
+  size_t i = 0, j = 0;
+  while (i<n || j<m)
+  {
+    const vertex_type & a = P[i%n];
+    const vertex_type & b = Q[j%m];
+    res.vertices.push_back(vertex_type(a.first+b.first,a.second+b.second));
+    if (i==n)
+    { j++; }
+    else if (j==m)
+    { i++; }
+    else
+    {
+      const vertex_type & a2 = P[(i+1)%n];
+      const vertex_type & b2 = Q[(j+1)%m];
+      int c = compareAngles(vertex_type(a2.first-a.first,a2.second-a.second),
+                            vertex_type(b2.first-b.first,b2.second-b.second));
+      if (c<=0)
+      { i++; }
+      if (c>=0)
+      { j++; }
+    }
+  }
+  return res;
+}
+
+Polygon2D Polygon2D::convexSum(const Polygon2D & p2) const
+{
+  if (isEmpty())
+  {
+    return p2;
+  }
+  if (p2.isEmpty())
+  {
+    return *this;
+  }
+  vector<vertex_type> points(vertices);
+  points.insert(points.end(),p2.vertices.begin(),p2.vertices.end());
+  Polygon2D res(points);
+  res.error = max(error,p2.error);
+  return res;
+}
+
+// Distance from p to the segment [a,c]
+static double segmentDistance(const vertex_type & p, const vertex_type & a, const vertex_type & c)
+{
+  double dx = c.first-a.first, dy = c.second-a.second;
+  double px = p.first-a.first, py = p.second-a.second;
+  double l = dx*dx+dy*dy;
+  double t = (l>0)? (px*dx+py*dy)/l : 0.;
+  t = min(1.,max(0.,t));
+  return hypot(px-t*dx,py-t*dy);
+}
+
+Polygon2D Polygon2D::simplify(size_t budget, double g, double b) const
+{
+  size_t n = vertices.size();
+  budget = max(budget,(size_t)3);
+  if (n<=budget)
+  {
+    return *this;
+  }
+  size_t best = 0;
+  for (size_t k=1;k<n;k++)
+  {
+    if (g*vertices[k].first+b*vertices[k].second < g*vertices[best].first+b*vertices[best].second)
+    { best = k; }
+  }
+  vector<size_t> prev(n), next(n);
+  vector<bool> removable(n,true);
+  vector<double> cost(n);
+  for (size_t k=0;k<n;k++)
+  {
+    prev[k] = (k+n-1)%n;
+    next[k] = (k+1)%n;
+  }
+  removable[best] = removable[prev[best]] = removable[next[best]] = false;
+  set<pair<double,size_t> > queue;
+  for (size_t k=0;k<n;k++)
+  {
+    cost[k] = segmentDistance(vertices[k],vertices[prev[k]],vertices[next[k]]);
+    if (removable[k])
+    { queue.insert(make_pair(cost[k],k)); }
+  }
+  size_t remaining = n;
+  vector<bool> kept(n,true);
+  while ((remaining>budget) && !queue.empty())
+  {
+    size_t k = queue.begin()->second;
+    queue.erase(queue.begin());
+    kept[k] = false;
+    remaining--;
+    size_t p = prev[k], q = next[k];
+    next[p] = q;
+    prev[q] = p;
+    size_t ends[2] = {p,q};
+    for (size_t e=0;e<2;e++)
+    {
+      size_t v = ends[e];
+      if (removable[v])
+      {
+        queue.erase(make_pair(cost[v],v));
+        cost[v] = segmentDistance(vertices[v],vertices[prev[v]],vertices[next[v]]);
+        queue.insert(make_pair(cost[v],v));
+      }
+    }
+  }
+  // The approximation lies inside the polygon, so its Hausdorff distance is
+  // reached at a removed vertex, and bounded by the distance to the chord 
+  // replacing it
+  Polygon2D res;
+  res.error = error;
+  size_t first = 0;
+  while (!kept[first])
+  { first++; }
+  size_t k = first;
+  do
+  {
+    res.vertices.push_back(vertices[k]);
+    for (size_t r=(k+1)%n;r!=next[k];r=(r+1)%n)
+    {
+      res.error = max(res.error,error+segmentDistance(vertices[r],vertices[k],vertices[next[k]]));
+    }
+    k = next[k];
+  }
+  while (k!=first);
+  rotate(res.vertices.begin(),min_element(res.vertices.begin(),res.vertices.end(),lowerLeft),res.vertices.end());
+  return res;
+}
+
+Polytope Polygon2D::toPolytope() const
+{
+  points_type pts(vertices.size());
+  for (size_t i=0;i<vertices.size();i++)
+  {
+    pts[i].resize(2);
+    pts[i][0] = vertices[i].first;
+    pts[i][1] = vertices[i].second;
+  }
+  Polytope res(2,pts);
+  res.setError(error);
+  return res;
+}
+
+std::ostream & operator<<(std::ostream & o, const Polygon2D & p)
+{
+  o<<p.toPolytope();
+  return o;
+}
+
+// Is the direction (x,y) within the cone spanned by d1 and d2?
+static bool inCone(double x, double y, double g1, double b1, double g2, double b2)
+{
+  double s = g1*b2-b1*g2;
+  if (s<0)
+  {
+    swap(g1,g2);
+    swap(b1,b2);
+  }
+  if (s==0)
+  {
+    return (g1*y-b1*x==0) && (g1*x+b1*y>=0);
+  }
+  return (g1*y-b1*x>=0) && (x*b2-y*g2>=0);
+}
+
+Polygon2D Polygon2D::restrictToCone(double g1, double b1, double g2, double b2) const
+{
+  size_t n = vertices.size();
+  if (n<3)
+  {
+    return *this;
+  }
+  Polygon2D res;
+  res.error = error;
+  for (size_t k=0;k<n;k++)
+  {
+    const vertex_type & p = vertices[(k+n-1)%n];
+    const vertex_type & v = vertices[k];
+    const vertex_type & q = vertices[(k+1)%n];
+    // The costs for which v is optimal are spanned by the inner normals of its
+    // edges, i.e. d.(v-p)<=0 and d.(q-v)>=0
+    double np[2] = {(double)(p.second-v.second),(double)(v.first-p.first)};
+    double nq[2] = {(double)(v.second-q.second),(double)(q.first-v.first)};
+    bool optimal = inCone(np[0],np[1],g1,b1,g2,b2) || inCone(nq[0],nq[1],g1,b1,g2,b2);
+    optimal = optimal || ((g1*(v.first-p.first)+b1*(v.second-p.second)<=0) && (g1*(q.first-v.first)+b1*(q.second-v.second)>=0));
+    optimal = optimal || ((g2*(v.first-p.first)+b2*(v.second-p.second)<=0) && (g2*(q.first-v.first)+b2*(q.second-v.second)>=0));
+    if (optimal)
+    {
+      res.vertices.push_back(v);
+    }
+  }
+  if (res.vertices.size()>1)
+  {
+    rotate(res.vertices.begin(),min_element(res.vertices.begin(),res.vertices.end(),lowerLeft),res.vertices.end());
+  }
+  return res;
+}
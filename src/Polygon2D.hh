@@ -0,0 +1,83 @@
+/*  DeClone: A software for computing and analyzing ancestral adjacency scenarios.
+ *  Copyright (C) 2015 Cedric Chauve, Yann Ponty, Ashok Rajaraman, Joao P.P. Zanetti
+ *
+ *  This file is part of DeClone.
+ *  
+ *  DeClone is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  DeClone is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with DeClone.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Contact: <yann.ponty@lix.polytechnique.fr>.
+ *
+ *
+ *  DeClone uses the Quickhull algorithm implementation programmed by 
+ *  Anatoly V. Tomilov. The code is available on <https://bitbucket.org/tomilov/quickhull/src/585267abb3a63794c04fc8325aa9ec9f726112ed/include/quickhull.hpp?at=master>.
+ *
+ *  Contact: <tomilovanatoliy@gmail.com>
+ */
+
+#ifndef POLYGON2D_HH
+#define POLYGON2D_HH
+
+#include <iostream>
+#include <vector>
+#include <utility>
+
+#include "ConvexPolytope.hh"
+
+// Convex polygon with integer coordinates (#gains, #breaks), specialized for 
+// the 2-dimensional polytope propagation. 
+// Vertices are the extreme points only, stored in counterclockwise order 
+// starting from the lowest (then leftmost) one. An empty polygon stands for 
+// an impossible case (INF). Approximate polygons (see simplify) carry an 
+// upper bound on their Hausdorff distance to the exact polygon.
+class Polygon2D{
+  public:
+    typedef long coord_type;
+    typedef std::pair<coord_type,coord_type> vertex_type;
+
+  private:
+    std::vector<vertex_type> vertices;
+    double error;
+
+  public:
+    Polygon2D();
+    Polygon2D(coord_type x, coord_type y);
+    Polygon2D(std::vector<vertex_type> points);
+
+    bool isEmpty() const;
+    size_t size() const;
+    const std::vector<vertex_type> & getVertices() const;
+    double getError() const;
+
+    // Minkowski sum, by merging the edges of both polygons in O(n+m)
+    Polygon2D minkovskiSum(const Polygon2D & p2) const;
+
+    // Convex hull of the union, by the monotone chain algorithm
+    Polygon2D convexSum(const Polygon2D & p2) const;
+
+    // Inner approximation by at most budget (>=3) vertices, removing first the
+    // vertices closest to the chord of their neighbours. The vertex of minimal
+    // cost g*x+b*y and its neighbours are kept.
+    Polygon2D simplify(size_t budget, double g, double b) const;
+
+    // Vertices of minimal cost g*x+b*y for some costs (g,b) in the cone spanned
+    // by (g1,b1) and (g2,b2) (of angle less than pi), along with their hull
+    Polygon2D restrictToCone(double g1, double b1, double g2, double b2) const;
+
+    // Generic representation, used for the normals and the output
+    Polytope toPolytope() const;
+
+    friend std::ostream & operator<<(std::ostream & o, const Polygon2D & p);
+};
+
+#endif
@@ -0,0 +1,94 @@
+/*  DeClone: A software for computing and analyzing ancestral adjacency scenarios.
+ *  Copyright (C) 2015 Cedric Chauve, Yann Ponty, Ashok Rajaraman, Joao P.P. Zanetti
+ *
+ *  This file is part of DeClone.
+ *  
+ *  DeClone is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  DeClone is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with DeClone.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Contact: <yann.ponty@lix.polytechnique.fr>.
+ *
+ *
+ *  DeClone uses the Quickhull algorithm implementation programmed by 
+ *  Anatoly V. Tomilov. The code is available on <https://bitbucket.org/tomilov/quickhull/src/585267abb3a63794c04fc8325aa9ec9f726112ed/include/quickhull.hpp?at=master>.
+ *
+ *  Contact: <tomilovanatoliy@gmail.com>
+ */
+
+#include "PolytopeChains.hh"
+
+VertexGrowthReport vertexGrowth;
+size_t vertexBudget = 0;
+CostCone costCone;
+
+CostCone::CostCone()
+{
+  enabled = false;
+  g1 = b1 = g2 = b2 = 1.;
+}
+
+VertexGrowthReport::VertexGrowthReport()
+{
+  enabled = false;
+  peak = 0;
+}
+
+bool VertexGrowthReport::open(string path)
+{
+  out.open(path.c_str());
+  enabled = out.good();
+  if (enabled)
+  {
+    out << "#nd1\tnd2\tpeak\tc0\tc1" << endl;
+  }
+  return enabled;
+}
+
+void VertexGrowthReport::close()
+{
+  if (enabled)
+  {
+    out.close();
+  }
+  enabled = false;
+}
+
+bool VertexGrowthReport::isEnabled() const
+{
+  return enabled;
+}
+
+void VertexGrowthReport::comment(const string & text)
+{
+  if (enabled)
+  {
+    out << "# " << text << "\n";
+  }
+}
+
+void VertexGrowthReport::recordSum(size_t nbVertices)
+{
+  if (enabled && (nbVertices>peak))
+  {
+    peak = nbVertices;
+  }
+}
+
+void VertexGrowthReport::recordCell(const string & nd1, const string & nd2, size_t nbVertices0, size_t nbVertices1)
+{
+  if (enabled)
+  {
+    out << nd1 << "\t" << nd2 << "\t" << peak << "\t" << nbVertices0 << "\t" << nbVertices1 << "\n";
+    peak = 0;
+  }
+}
@@ -0,0 +1,115 @@
+/*  DeClone: A software for computing and analyzing ancestral adjacency scenarios.
+ *  Copyright (C) 2015 Cedric Chauve, Yann Ponty, Ashok Rajaraman, Joao P.P. Zanetti
+ *
+ *  This file is part of DeClone.
+ *  
+ *  DeClone is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  DeClone is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with DeClone.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Contact: <yann.ponty@lix.polytechnique.fr>.
+ *
+ *
+ *  DeClone uses the Quickhull algorithm implementation programmed by 
+ *  Anatoly V. Tomilov. The code is available on <https://bitbucket.org/tomilov/quickhull/src/585267abb3a63794c04fc8325aa9ec9f726112ed/include/quickhull.hpp?at=master>.
+ *
+ *  Contact: <tomilovanatoliy@gmail.com>
+ */
+
+#ifndef POLYTOPE_CHAINS_HH
+#define POLYTOPE_CHAINS_HH
+
+#include <string>
+#include <vector>
+#include <fstream>
+#include <algorithm>
+
+using namespace std;
+
+// Per-cell report of the number of vertices of the polytopes built during
+// the propagation: largest intermediate (Minkowski) sum, and final C0/C1 cells
+class VertexGrowthReport{
+  private:
+    ofstream out;
+    bool enabled;
+    size_t peak;
+
+  public:
+    VertexGrowthReport();
+
+    bool open(string path);
+    void close();
+    bool isEnabled() const;
+
+    void comment(const string & text);
+    void recordSum(size_t nbVertices);
+    void recordCell(const string & nd1, const string & nd2, size_t nbVertices0, size_t nbVertices1);
+};
+
+extern VertexGrowthReport vertexGrowth;
+
+// Approximate propagation: the polytopes stored in a cell are simplified down
+// to about vertexBudget vertices (0 for an exact propagation), keeping the 
+// vertices of minimal cost for the costs (g,b) of gains and breaks
+extern size_t vertexBudget;
+
+template<class P> void applyVertexBudget(P & p, double g, double b)
+{
+  if ((vertexBudget>0) && (p.size()>vertexBudget))
+  {
+    p = p.simplify(vertexBudget,g,b);
+  }
+}
+
+// Restricted propagation: only the vertices of minimal cost for some costs of
+// gains and breaks in the cone spanned by (g1,b1) and (g2,b2) are kept by the
+// unions of the propagation
+class CostCone{
+  public:
+    bool enabled;
+    double g1, b1, g2, b2;
+
+    CostCone();
+};
+
+extern CostCone costCone;
+
+template<class P> P coneConvexSum(const P & p1, const P & p2)
+{
+  P res = p1.convexSum(p2);
+  if (costCone.enabled)
+  {
+    res = res.restrictToCone(costCone.g1,costCone.b1,costCone.g2,costCone.b2);
+  }
+  return res;
+}
+
+template<class P> bool smallerPolytope(const P & p1, const P & p2)
+{
+  return p1.size()<p2.size();
+}
+
+// Minkowski sum of a chain of polytopes, from the smallest to the largest one, 
+// so that translations are combined first and intermediate sums stay small. 
+// The binary sum is expected to return extreme points only.
+template<class P> P minkowskiChain(vector<P> ops, P (*sum)(P, P))
+{
+  stable_sort(ops.begin(),ops.end(),smallerPolytope<P>);
+  P res = ops[0];
+  for (size_t i=1;i<ops.size();i++)
+  {
+    res = sum(res,ops[i]);
+  }
+  return res;
+}
+
+#endif
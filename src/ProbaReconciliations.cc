@@ -32,6 +32,10 @@
 #include <iomanip>
 #include <algorithm>
 #include <sstream>
+#include <fstream>
+#include <thread>
+#include <mutex>
+#include <cfloat>
 
 #include "Trees.hh"
 #include "DPParsimony.hh"
@@ -39,6 +43,9 @@
 #include "DPStochasticBacktrack.hh"
 #include "DPGenAll.hh"
 #include "DPInsideOutside.hh"
+#include "DPEventDistribution.hh"
+#include "DPMarginals.hh"
+#include "RecTrees.hh"
 #include "SVGDriver.hh"
 #include "utils.hh"
 
@@ -131,9 +138,21 @@ void test2()
 #define DUP_ANNOTATIONS_OPTION_SHORT             "-j"
 #define TREES_OPTION_LONG           "--trees"
 #define TREES_OPTION_SHORT          "-t"
+#define MARGINALS_OPTION_LONG       "--marginals"
+#define MARGINALS_OPTION_SHORT      "-I"
+#define EVENTS_OPTION_LONG          "--events"
+#define EVENTS_OPTION_SHORT         "-e"
+#define NHX_OPTION_LONG             "--nhx"
+#define NHX_OPTION_SHORT            "-x"
 #define INSIDE_OUTSIDE_OPTION_LONG  "--in-out"
 #define INSIDE_OUTSIDE_OPTION_SHORT "-i"
 #define SET_BOLTZMANN_OPTION_SHORT  "-kT"
+#define GENE_TREES_OPTION_LONG      "--gene-trees"
+#define GENE_TREES_OPTION_SHORT     "-G"
+#define THREADS_OPTION_LONG         "--threads"
+#define THREADS_OPTION_SHORT        "-T"
+#define TRANSFERS_OPTION_LONG       "--transfers"
+#define TRANSFERS_OPTION_SHORT      "-tr"
 
 typedef enum{	PARSIMONY_MODE,
 							COUNT_MODE,
@@ -141,7 +160,10 @@ typedef enum{	PARSIMONY_MODE,
 							PRINT_ALL_MODE, 
 							DUP_ANNOTATIONS_MODE, 
 							INSIDE_OUTSIDE_MODE, 
-							PARTITION_FUNCTION_MODE
+							PARTITION_FUNCTION_MODE,
+							EVENTS_MODE,
+							MARGINALS_MODE,
+							TRANSFERS_MODE
 							} runmode;
 
 void usage(string cmd){
@@ -156,12 +178,20 @@ void usage(string cmd){
 	cerr << "  "<<PRINT_ALL_OPTION_SHORT<<","<<PRINT_ALL_OPTION_LONG<<"         - Exhaustive enumeration of reconciliations"<<endl;
 	cerr << "  "<<INSIDE_OUTSIDE_OPTION_SHORT<<","<<INSIDE_OUTSIDE_OPTION_LONG<<"      - Computes probability dot-plot for duplications"<<endl;
 	cerr << "  "<<PARTITION_FUNCTION_OPTION_SHORT<<","<<PARTITION_FUNCTION_OPTION_LONG<<"      - \"Partition function\" mode"<<endl;
+	cerr << "  "<<MARGINALS_OPTION_SHORT<<","<<MARGINALS_OPTION_LONG<<"    - Computes probability dot-plots for all events (dup, spec, loss, match)"<<endl;
+	cerr << "  "<<TRANSFERS_OPTION_SHORT<<","<<TRANSFERS_OPTION_LONG<<" c - DTL model, transfers of cost c: min. cost, num. reconciliations, partition function and"<<endl;
+	cerr << "                   probability dot-plots for all events, including transfers and receptions"<<endl;
+	cerr << "  "<<EVENTS_OPTION_SHORT<<","<<EVENTS_OPTION_LONG<<"       - Expected dups/losses per species branch, and distributions of their numbers"<<endl;
 	cerr << "  "<<DUP_ANNOTATIONS_OPTION_SHORT<<","<<DUP_ANNOTATIONS_OPTION_LONG<<"      - Exports gene tree annotated duplications (no species tree needed)"<<endl;
 
+	cerr << "  "<<GENE_TREES_OPTION_SHORT<<","<<GENE_TREES_OPTION_LONG<<" f - Batch mode: reconciles each gene tree of file f (one per line)"<<endl;
+	cerr << "                   against the species tree, one output line per tree (modes "<<MAX_LIKELIHOOD_OPTION_SHORT<<", "<<PARTITION_FUNCTION_OPTION_SHORT<<" and "<<INSIDE_OUTSIDE_OPTION_SHORT<<")"<<endl;
+	cerr << "  "<<THREADS_OPTION_SHORT<<","<<THREADS_OPTION_LONG<<" n  - Number of threads used in batch mode (def.=#cores)"<<endl;
 	cerr << "  "<<SET_BOLTZMANN_OPTION_SHORT<<" val  - Sets Boltzmann 'constant' to a given value (def.=1.0)"<<endl;
 	cerr << "  "<<VERBOSE_OPTION_SHORT<<","<<VERBOSE_OPTION_LONG<<" - Verbose mode, provides more (possibly unnecessary) information"<<endl;
 	cerr << "  "<<PRETTY_PRINT_OPTION_SHORT<<","<<PRETTY_PRINT_OPTION_LONG<<" [pdf|jpeg|png] - Display trees as pictures in files (requires GraphViz)"<<endl;
 	cerr << "  "<<TREES_OPTION_SHORT<<","<<TREES_OPTION_LONG<<"      - Output reconciliations as trees (def.= matrices)"<<endl;
+	cerr << "  "<<NHX_OPTION_SHORT<<","<<NHX_OPTION_LONG<<"        - Output reconciliations as reconciled gene trees in NHX format, as read by DeClone"<<endl;
 	cerr << "  "<<HELP_OPTION_SHORT<<","<<HELP_OPTION_LONG<<"        - Displays help and exits"<<endl;
 }
 
@@ -192,9 +222,9 @@ template <class T> void freeMatrix(Tree * GeneTree, Tree * SpeciesTree, T** & va
 	int gsize = GeneTree->size();
 	for(int i=0;i<gsize;i++)
 	{
-		delete vals[i];
+		delete[] vals[i];
 	}
-	delete vals;
+	delete[] vals;
 	vals = NULL;
 }
 
@@ -241,19 +271,173 @@ template <class T> void printMatrix(Tree * GeneTree, Tree * SpeciesTree, T** val
 	}
 }
 
-void showReconciliation(EditTree * t, Tree * GeneTree,Tree * SpeciesTree, bool showAsTrees)
+// Trees (and labels) are only built for the tree outputs
+void showReconciliation(const ScenarioPool & pool, int k, Tree * GeneTree,Tree * SpeciesTree, bool showAsTrees, bool showAsNHX)
 {
-	if (!showAsTrees)
+	if (!showAsTrees && !showAsNHX)
 	{
-		NodeType** m = t->eventsAsMatrix(GeneTree,SpeciesTree);
+		NodeType** m = pool.eventsAsMatrix(k,GeneTree,SpeciesTree);
 		printMatrix(GeneTree, SpeciesTree, m);
 		freeMatrix(GeneTree, SpeciesTree, m);
+		return;
+	}
+	EditTree * t = pool.asEditTree(k,GeneTree,SpeciesTree);
+	if (showAsNHX)
+	{
+		RecTree * r = toRecTree(t, GeneTree, SpeciesTree);
+		r->show(false,0,cout);
+		cout << ";" << endl;
+		delete r;
 	}
 	else
 	{
 		t->show(false,2,cout);
 		cout << endl;
 	}
+	delete t;
+}
+
+// Number of duplications of the LCA mapping of a gene tree, 
+// -1 if some gene leaf has no species
+int countLCADuplications(Tree * GeneTree, const SpeciesTreeIndex & species, const LeafSpeciesIndex & leaves)
+{
+	vector<Tree*> DfoG = computeDepthFirstOrder(GeneTree);
+	vector<int> lcaMap(DfoG.size(),-1);
+	int dups = 0;
+	for(int i=0;i<DfoG.size();i++) 
+	{
+		Tree * g = DfoG[i];
+		if (g->isLeaf())
+		{
+			lcaMap[i] = leaves.getSpecies(i);
+			if (lcaMap[i]==-1)
+			{ return -1; }
+		}
+		else if (g->getRight()==NULL)
+		{ lcaMap[i] = lcaMap[g->getLeft()->getIndex()]; }
+		else
+		{
+			int a = lcaMap[g->getLeft()->getIndex()];
+			int b = lcaMap[g->getRight()->getIndex()];
+			lcaMap[i] = species.lca(a,b);
+			if (lcaMap[i]==a || lcaMap[i]==b)
+			{ dups++; }
+		}
+	}
+	return dups;
+}
+
+// One gene family of a batch: reconciles the gene tree against the shared 
+// species tree tables, and returns its output record
+string reconcileFamily(const string & line, Tree * SpeciesTree, const SpeciesTreeIndex & species, runmode mode)
+{
+	stringbuilder sb;
+	Tree * GeneTree = parseNewickTree(line);
+	switch(mode)
+	{
+		case (PARSIMONY_MODE):
+			{
+				double cost = computeMaxParsimonyCost(GeneTree, SpeciesTree, species);
+				if (cost==DBL_MAX)
+				{ sb << "NA\tNA"; }
+				else
+				{
+					LeafSpeciesIndex leaves(GeneTree, species);
+					sb << cost << "\t" << countLCADuplications(GeneTree, species, leaves);
+				}
+			}
+			break;
+		case (PARTITION_FUNCTION_MODE):
+			{
+				sb << getPartitionFunction(GeneTree, species);
+			}
+			break;
+		case (INSIDE_OUTSIDE_MODE):
+			{
+				int n = GeneTree->size();
+				double** probas = new double*[n];
+				for(int i=0;i<n;i++) 
+				{ probas[i] = new double[species.size()]; }
+				double Z = getProbasDupl(GeneTree, SpeciesTree, species, probas);
+				sb << Z << "\t";
+				for(int i=0;i<n;i++) 
+				{
+					double p = 0.;
+					for(int j=0;j<species.size();j++) 
+					{ p += probas[i][j]; }
+					if (i!=0)
+					{ sb << ","; }
+					sb << p;
+				}
+				freeMatrix(GeneTree, SpeciesTree, probas);
+			}
+			break;
+		default:
+			break;
+	}
+	delete GeneTree;
+	return sb;
+}
+
+// Reconciles every gene tree of a file (one Newick tree per line, blank and 
+// '#' lines skipped) against a single species tree. The tables of the species
+// tree are built once and only read by the worker threads, which pick the 
+// families in turn; records are printed in the order of the input file.
+int reconcileBatch(string path, Tree * SpeciesTree, runmode mode, int nbThreads)
+{
+	ifstream in(path.c_str());
+	if (!in)
+	{
+		cerr << "Error: Cannot open gene trees file '"<<path<<"'"<<endl;
+		return EXIT_FAILURE;
+	}
+	vector<string> lines;
+	string line;
+	while (getline(in,line))
+	{
+		size_t start = line.find_first_not_of(" \t\r");
+		if (start==string::npos || line[start]=='#')
+		{ continue; }
+		size_t end = line.find_last_not_of(" \t\r");
+		lines.push_back(line.substr(start,end-start+1));
+	}
+	SpeciesTreeIndex species(SpeciesTree);
+	vector<string> records(lines.size());
+	vector<bool> done(lines.size(),false);
+	size_t next = 0, flushed = 0;
+	mutex lock;
+	if (nbThreads<1)
+	{ nbThreads = 1; }
+	vector<thread> workers;
+	for (int t=0;t<nbThreads;t++)
+	{
+		workers.push_back(thread([&]()
+		{
+			while (true)
+			{
+				size_t k;
+				{
+					lock_guard<mutex> guard(lock);
+					if (next>=lines.size())
+					{ return; }
+					k = next++;
+				}
+				string res = reconcileFamily(lines[k], SpeciesTree, species, mode);
+				lock_guard<mutex> guard(lock);
+				records[k] = res;
+				done[k] = true;
+				while (flushed<lines.size() && done[flushed])
+				{
+					cout << (flushed+1) << "\t" << records[flushed] << endl;
+					records[flushed].clear();
+					flushed++;
+				}
+			}
+		}));
+	}
+	for (int t=0;t<workers.size();t++)
+	{ workers[t].join(); }
+	return EXIT_SUCCESS;
 }
 
 
@@ -263,10 +447,14 @@ int main(int argc, char *argv[])
 	Tree * SpeciesTree = NULL;
 	runmode mode = PARSIMONY_MODE;
 	int nbBacktracks = 0;
+	double transferCost = 1.;
 	bool prettyPrint = false;
 	bool verbose = false;
 	bool showAsTrees = false;
+	bool showAsNHX = false;
 	string picFormat = "pdf";
+	string geneTreesFile = "";
+	int nbThreads = thread::hardware_concurrency();
 	for (int i=1;i<argc;i++)
 	{
 		string opt(argv[i]);
@@ -298,10 +486,37 @@ int main(int argc, char *argv[])
 		{
 			mode = PRINT_ALL_MODE;
 		}
+		else if (opt==MARGINALS_OPTION_SHORT  || opt==MARGINALS_OPTION_LONG)
+		{
+			mode = MARGINALS_MODE;
+		}
+		else if (opt==EVENTS_OPTION_SHORT  || opt==EVENTS_OPTION_LONG)
+		{
+			mode = EVENTS_MODE;
+		}
+		else if (opt==TRANSFERS_OPTION_SHORT  || opt==TRANSFERS_OPTION_LONG)
+		{
+			ensureNextParamAvail(opt, "transfer cost", i, argc,argv);
+			i++;
+			mode = TRANSFERS_MODE;
+			convertToDouble(string(argv[i]), transferCost);
+		}
 		else if (opt==INSIDE_OUTSIDE_OPTION_SHORT  || opt==INSIDE_OUTSIDE_OPTION_LONG)
 		{
 			mode = INSIDE_OUTSIDE_MODE;
 		}
+		else if (opt==GENE_TREES_OPTION_SHORT  || opt==GENE_TREES_OPTION_LONG)
+		{
+			ensureNextParamAvail(opt, "gene trees file", i, argc,argv);
+			i++;
+			geneTreesFile = argv[i];
+		}
+		else if (opt==THREADS_OPTION_SHORT  || opt==THREADS_OPTION_LONG)
+		{
+			ensureNextParamAvail(opt, "#threads", i, argc,argv);
+			i++;
+			nbThreads = atoi(argv[i]);
+		}
 		else if (opt==SET_BOLTZMANN_OPTION_SHORT)
 		{
 			ensureNextParamAvail(opt, "Boltzmann constant", i, argc,argv);
@@ -331,6 +546,10 @@ int main(int argc, char *argv[])
 			showAsTrees = true;
 			
 		}
+		else if (opt==NHX_OPTION_SHORT  || opt==NHX_OPTION_LONG)
+		{
+			showAsNHX = true;
+		}
 		else if (opt==DUP_ANNOTATIONS_OPTION_SHORT  || opt==DUP_ANNOTATIONS_OPTION_LONG)
 		{
 			mode = DUP_ANNOTATIONS_MODE;
@@ -355,6 +574,27 @@ int main(int argc, char *argv[])
 			
 		}	
 	}
+	if (geneTreesFile!="")
+	{
+		if (SpeciesTree==NULL && GeneTree!=NULL)
+		{
+			// Single positional tree in batch mode is the species tree
+			SpeciesTree = GeneTree;
+			GeneTree = NULL;
+		}
+		if (SpeciesTree==NULL)
+		{
+			cerr << "Error: Missing Species Tree"<<endl;
+			usage(argv[0]);
+			return EXIT_FAILURE;
+		}
+		if (mode!=PARSIMONY_MODE && mode!=PARTITION_FUNCTION_MODE && mode!=INSIDE_OUTSIDE_MODE)
+		{
+			cerr << "Error: Batch mode only supports options "<<MAX_LIKELIHOOD_OPTION_SHORT<<", "<<PARTITION_FUNCTION_OPTION_SHORT<<" and "<<INSIDE_OUTSIDE_OPTION_SHORT<<endl;
+			return EXIT_FAILURE;
+		}
+		return reconcileBatch(geneTreesFile, SpeciesTree, mode, nbThreads);
+	}
 	if (mode == DUP_ANNOTATIONS_MODE)
 	{
 		if (GeneTree!=NULL)
@@ -404,24 +644,24 @@ int main(int argc, char *argv[])
 			{
 				case (BACKTRACK_MODE):
 					{
-						vector<EditTree*> objs = stochasticReconciliations(GeneTree, SpeciesTree, nbBacktracks);
-						for (int i=0;i<objs.size();i++)
+						ScenarioPool pool;
+						stochasticReconciliations(GeneTree, SpeciesTree, nbBacktracks, pool);
+						for (int i=0;i<pool.size();i++)
 						{
-							EditTree * scenario = objs[i];
-							showReconciliation(scenario,GeneTree,SpeciesTree, showAsTrees);
-							delete scenario;
+							showReconciliation(pool,i,GeneTree,SpeciesTree, showAsTrees, showAsNHX);
 						}
 					}
 					break;
 				case (PARSIMONY_MODE):
 					{
-						EditTree* t = computeMaxParsimony(GeneTree, SpeciesTree);
-						if (t)
+						ScenarioPool pool;
+						if (computeMaxParsimony(GeneTree, SpeciesTree, pool))
 						{
-							showReconciliation(t, GeneTree,SpeciesTree, showAsTrees);
+							showReconciliation(pool, 0, GeneTree,SpeciesTree, showAsTrees, showAsNHX);
 	
 							if (prettyPrint)
 							{	
+								EditTree * t = pool.asEditTree(0, GeneTree, SpeciesTree);
 								cerr <<endl << "Edit sequence: "<<endl;
 								SpeciesTree->show(false,2,cerr); 
 								cerr << endl;
@@ -438,6 +678,7 @@ int main(int argc, char *argv[])
 									v[i]->asPicture(sb,picFormat); 
 									delete v[i];
 								}
+								delete t;
 							}
 						}
 						else
@@ -467,12 +708,75 @@ int main(int argc, char *argv[])
 						getProbasDupl(GeneTree, SpeciesTree, probas);
 						if (prettyPrint)
 						{
-							drawProbasSVG(GeneTree, SpeciesTree, probas);
+							drawProbas(GeneTree, SpeciesTree, probas);
 						}
 						printMatrix(GeneTree, SpeciesTree, probas);
 						freeMatrix(GeneTree, SpeciesTree, probas);
 					}
 					break;
+				case (MARGINALS_MODE):
+					{
+						ReconciliationMarginals marginals(GeneTree, SpeciesTreeIndex(SpeciesTree));
+						int n = GeneTree->size();
+						double** probas = new double*[n];
+						for (int t=0;t<NONE_TYPE;t++)
+						{
+							for(int i=0;i<n;i++) 
+							{ probas[i] = (double *) marginals.row((NodeType) t,i); }
+							cout << "Event:" << prettyOperationType((NodeType) t) << endl;
+							printMatrix(GeneTree, SpeciesTree, probas);
+						}
+						delete[] probas;
+					}
+					break;
+				case (TRANSFERS_MODE):
+					{
+						cout << "DTL cost:" << computeDTLParsimonyCost(GeneTree, SpeciesTree, transferCost)<<endl;
+						cout << "#DTL Reconciliations:" << countDTLReconciliations(GeneTree, SpeciesTree)<<endl;
+						TransferMarginals marginals(GeneTree, SpeciesTreeIndex(SpeciesTree), transferCost);
+						cout << "Partition Function:" << marginals.Z<<endl;
+						int n = GeneTree->size();
+						double** probas = new double*[n];
+						for (int t=0;t<NONE_TYPE;t++)
+						{
+							for(int i=0;i<n;i++) 
+							{ probas[i] = (double *) marginals.row((NodeType) t,i); }
+							cout << "Event:" << prettyOperationType((NodeType) t) << endl;
+							printMatrix(GeneTree, SpeciesTree, probas);
+						}
+						for(int i=0;i<n;i++) 
+						{ probas[i] = (double *) marginals.transferRow(i); }
+						cout << "Event:Transfer" << endl;
+						printMatrix(GeneTree, SpeciesTree, probas);
+						for(int i=0;i<n;i++) 
+						{ probas[i] = (double *) marginals.receptionRow(i); }
+						cout << "Event:Reception" << endl;
+						printMatrix(GeneTree, SpeciesTree, probas);
+						delete[] probas;
+					}
+					break;
+				case (EVENTS_MODE):
+					{
+						vector<double> dups, losses;
+						getExpectedEvents(GeneTree, SpeciesTree, dups, losses);
+						vector<Tree*> DfoS = computeDepthFirstOrder(SpeciesTree);
+						cout << "Species\tLabel\tE[Dup]\tE[Loss]"<<endl;
+						for(int j=0;j<DfoS.size();j++) 
+						{
+							cout << j << "\t" << DfoS[j]->getLabel() << "\t" << dups[j] << "\t" << losses[j] << endl;
+						}
+						vector<double> dist = getEventDistribution(GeneTree, SpeciesTree, false);
+						cout << "Dup distribution:";
+						for(int k=0;k<dist.size();k++) 
+						{ cout << (k==0? "" : ",") << dist[k]; }
+						cout << endl;
+						dist = getEventDistribution(GeneTree, SpeciesTree, true);
+						cout << "Loss distribution:";
+						for(int k=0;k<dist.size();k++) 
+						{ cout << (k==0? "" : ",") << dist[k]; }
+						cout << endl;
+					}
+					break;
 				case (PRINT_ALL_MODE):
 					{
 						vector<scenario_t> recs = genAllReconciliations(GeneTree, SpeciesTree);
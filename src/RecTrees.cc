@@ -160,14 +160,17 @@ void computeDepthFirstOrderRec(RecTree * t, vector<RecTree*> & result)
 	}
 }
 
-vector<RecTree*> computeDepthFirstOrder(RecTree * t)
+vector<RecTree*> computeDepthFirstOrder(RecTree * t, bool renumber)
 {
 	vector<RecTree *> result;
 	computeDepthFirstOrderRec(t, result);
-	for(int i=0;i<result.size();i++) 
+	if (renumber)
 	{
-		RecTree * t = result[i];
-		t->setIndex(i);
+		for(int i=0;i<result.size();i++) 
+		{
+			RecTree * t = result[i];
+			t->setIndex(i);
+		}
 	}
 	return result;
 }
@@ -373,6 +376,73 @@ bool sameSpecies(RecTree * t1, RecTree * t2)
      return b;
 }
 
+// Event names, as expected by extractEventType
+string nhxEventName(EventType t)
+{
+	switch(t)
+	{
+			case (GDup): return string("GDup");
+			case (GLos): return string("GLos");
+			case (Spec): return string("Spec");
+			case (Extant): return string("Extant");
+			default:
+				return string("Unknown");
+	}
+}
+
+RecTree * newRecNode(string lbl, RecTree * left, RecTree * right, EventType t, Tree * s)
+{
+	stringstream spec;
+	spec << s->getIndex();
+	return new RecTree(lbl, left, right, t, spec.str());
+}
+
+RecTree * toRecTreeRec(EditTree * rec, Tree * g, Tree * s)
+{
+	switch(rec->getNodeType())
+	{
+			case (DUP_TYPE):
+				return newRecNode(g->getLabel(), toRecTreeRec(rec->getLeft(), g->getLeft(), s),
+				                  toRecTreeRec(rec->getRight(), g->getRight(), s), GDup, s);
+			case (SPEC_AB_TYPE):
+				return newRecNode(g->getLabel(), toRecTreeRec(rec->getLeft(), g->getLeft(), s->getLeft()),
+				                  toRecTreeRec(rec->getRight(), g->getRight(), s->getRight()), Spec, s);
+			case (SPEC_BA_TYPE):
+				return newRecNode(g->getLabel(), toRecTreeRec(rec->getLeft(), g->getLeft(), s->getRight()),
+				                  toRecTreeRec(rec->getRight(), g->getRight(), s->getLeft()), Spec, s);
+			// Speciation followed by the loss of the copy of the gene in one child
+			case (LOSS_A_TYPE):
+				return newRecNode("", newRecNode("Loss", NULL, NULL, GLos, s->getLeft()),
+				                  toRecTreeRec(rec->getRight(), g, s->getRight()), Spec, s);
+			case (LOSS_B_TYPE):
+				return newRecNode("", toRecTreeRec(rec->getLeft(), g, s->getLeft()),
+				                  newRecNode("Loss", NULL, NULL, GLos, s->getRight()), Spec, s);
+			case (MATCH_TYPE):
+				return newRecNode(g->getLabel(), NULL, NULL, Extant, s);
+			default:
+				cerr << "Error: Weird edit operation type."<<endl;
+				exit(3);
+	}
+	return NULL;
+}
+
+RecTree* toRecTree(EditTree * rec, Tree * GeneTree, Tree * SpeciesTree)
+{
+	RecTree * t = toRecTreeRec(rec, GeneTree, SpeciesTree);
+	vector<RecTree*> dfo = computeDepthFirstOrder(t);
+	for(int i=0;i<dfo.size();i++) 
+	{
+		RecTree * n = dfo[i];
+		stringstream nd;
+		nd << i;
+		n->setND(nd.str());
+		stringstream comment;
+		comment << "&&NHX:Ev=" << nhxEventName(n->getEvent()) << ":S=" << n->getSpecies() << ":ND=" << i;
+		n->setComment(comment.str());
+	}
+	return t;
+}
+
 map<string, map<string,string> > loadAdjacencies(string path)
 {
   map<string, map<string,string> > adjacencies;
@@ -431,7 +501,10 @@ bool isAdjacent(RecTree * t1, RecTree * t2,  map<string, map<string,string> > &
 {
      string g1 = split(t1->getLabel(),'|')[0];
      string g2 = split(t2->getLabel(),'|')[0];
-     bool b = (adjacencies[g1].count(g2)>0)||(adjacencies[g2].count(g1)>0);
+     // Lookups only (no insertion), so that concurrent DPs can share the map
+     map<string, map<string,string> >::const_iterator it1 = adjacencies.find(g1);
+     map<string, map<string,string> >::const_iterator it2 = adjacencies.find(g2);
+     bool b = ((it1!=adjacencies.end()) && (it1->second.count(g2)>0))||((it2!=adjacencies.end()) && (it2->second.count(g1)>0));
      //cout << "    " << t1->getLabel() << " " << t2->getLabel() << " adjacents? " << b << endl;
      return b;
 }
@@ -30,6 +30,7 @@
 #include <iostream>
 #include <map>
 #include "Trees.hh"
+#include "EditTrees.hh"
 
 #ifndef REC_TREES_HH
 #define REC_TREES_HH
@@ -76,7 +77,9 @@ class RecTree: public Tree{
 		
 };
 
-vector<RecTree*> computeDepthFirstOrder(RecTree * t);
+// Lists the nodes in post-order. Unless renumber is false, the index of each
+// node is also set to its position in the list.
+vector<RecTree*> computeDepthFirstOrder(RecTree * t, bool renumber = true);
 int findDepthFirstOrder(RecTree * t,string GeneName);
 
 vector<RecTree*> computeInfixOrder(RecTree * t);
@@ -85,6 +88,12 @@ RecTree* parseNewickRecTree(string s);
 
 bool sameSpecies(RecTree * t1, RecTree * t2);
 
+// Builds the reconciled gene tree described by a backtracked reconciliation
+// (see computeMaxParsimony and stochasticReconciliations), with the same 
+// Ev/S/ND annotations as those read by parseNewickRecTree. Species are 
+// identified by their index in SpeciesTree, and losses are leaves 'Loss'.
+RecTree* toRecTree(EditTree * rec, Tree * GeneTree, Tree * SpeciesTree);
+
 
 //////////// Adjacencies //////////////
 
@@ -95,6 +104,11 @@ bool isAdjacent(RecTree * t1, RecTree * t2,  map<string, map<string,string> > &
 #define IsAdj(a,b,adjacencies) (isAdjacent(a,b,adjacencies)? ZERO : INF)
 #define IsntAdj(a,b,adjacencies) (isAdjacent(a,b,adjacencies)? INF : ZERO)
 
+// States of the cells of a DP table, when only some of them are (re)computed 
+#define CELL_SKIP 0
+#define CELL_COMPUTE 1
+#define CELL_KNOWN 2
+
 
 
 #endif
@@ -27,6 +27,9 @@
 
 #include "SVGDriver.hh"
 #include <fstream>
+#include <cmath>
+#include <cstdlib>
+#include <algorithm>
 
 using namespace std;
 
@@ -38,6 +41,13 @@ ostream & operator<< (ostream & o, const Color & c)
 	return o << "rgb(" << rpc << "%, " << gpc << "%, " << bpc << "%)";
 }
 
+static unsigned char toByte(double v)
+{
+	if (v<=0.) return 0;
+	if (v>=1.) return 255;
+	return (unsigned char) (v*255.+.5);
+}
+
 Point operator+ (const Point & p1, const Point & p2)
 {
 	return Point(p1.x+p2.x,p1.y+p2.y);
@@ -52,3 +62,442 @@ Point operator* (const Point & p,double k)
 {
 	return Point(k*p.x,k*p.y);
 }
+
+SVGFile::SVGFile(string path) : out(path.c_str())
+{
+	thickness = 1.0;
+	color = Color(0.,0.,0.);
+	fillClass = -1;
+	strokeClass = -1;
+	buf.reserve(SVG_BUFFER_SIZE+1024);
+	put("<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+		"<!DOCTYPE svg PUBLIC \"-//W3C//DTD SVG 1.1//EN\" \n"
+		"\"http://www.w3.org/Graphics/SVG/1.1/DTD/svg11.dtd\">\n"
+		"\n"
+		"<svg width=\"100%\" height=\"100%\" version=\"1.1\"\n"
+		"xmlns=\"http://www.w3.org/2000/svg\" xmlns:xlink=\"http://www.w3.org/1999/xlink\">\n");
+}
+
+SVGFile::~SVGFile()
+{
+	// Stylesheets apply to the whole document, wherever they appear
+	vector<const string *> decls(classes.size());
+	for (map<string,int>::const_iterator it=classes.begin();it!=classes.end();it++)
+	{ decls[it->second] = &it->first; }
+	put("<style type=\"text/css\"><![CDATA[\n");
+	for (int k=0;k<decls.size();k++)
+	{
+		put(".c");
+		put((double) k);
+		put("{");
+		put(*decls[k]);
+		put("}\n");
+		if (buf.size()>=SVG_BUFFER_SIZE)
+		{ flush(); }
+	}
+	put("]]></style>\n</svg>\n");
+	flush();
+	out.close();
+}
+
+void SVGFile::flush()
+{
+	out.write(buf.data(),buf.size());
+	buf.clear();
+}
+
+// Fixed-point, at most two decimals, no trailing zeros
+void SVGFile::put(double v)
+{
+	char tmp[32];
+	char * e = tmp+sizeof(tmp);
+	char * p = e;
+	bool neg = (v<0.);
+	unsigned long long n = (unsigned long long) ((neg? -v : v)*100.+.5);
+	int frac = (int) (n%100);
+	n /= 100;
+	if (frac!=0)
+	{
+		if (frac%10==0)
+		{ *--p = '0'+frac/10; }
+		else
+		{
+			*--p = '0'+frac%10;
+			*--p = '0'+frac/10;
+		}
+		*--p = '.';
+	}
+	do
+	{
+		*--p = '0'+(n%10);
+		n /= 10;
+	}
+	while (n!=0);
+	if (neg && (p[0]!='0' || p+1!=e))
+	{ *--p = '-'; }
+	buf.append(p,e-p);
+}
+
+void SVGFile::putColor(const Color & c)
+{
+	static const char * hex = "0123456789abcdef";
+	unsigned char rgb[3] = {toByte(c.r), toByte(c.g), toByte(c.b)};
+	char tmp[7];
+	tmp[0] = '#';
+	for (int k=0;k<3;k++)
+	{
+		tmp[1+2*k] = hex[rgb[k]>>4];
+		tmp[2+2*k] = hex[rgb[k]&15];
+	}
+	buf.append(tmp,7);
+}
+
+void SVGFile::putClass(int k)
+{
+	put(" class=\"c");
+	put((double) k);
+	put("\"");
+}
+
+void SVGFile::endElement()
+{
+	put("/>\n");
+	if (buf.size()>=SVG_BUFFER_SIZE)
+	{ flush(); }
+}
+
+int SVGFile::getClass(const string & decl)
+{
+	map<string,int>::iterator it = classes.find(decl);
+	if (it!=classes.end())
+	{ return it->second; }
+	int k = classes.size();
+	classes[decl] = k;
+	return k;
+}
+
+unsigned int SVGFile::packColor() const
+{
+	return (((unsigned int) toByte(color.a))<<24) | (((unsigned int) toByte(color.r))<<16)
+		| (((unsigned int) toByte(color.g))<<8) | ((unsigned int) toByte(color.b));
+}
+
+int SVGFile::getFillClass()
+{
+	if (fillClass==-1)
+	{
+		unsigned int key = packColor();
+		map<unsigned int,int>::iterator it = fillClasses.find(key);
+		if (it!=fillClasses.end())
+		{ return (fillClass = it->second); }
+		// Formats the declaration at the end of the buffer, then moves it out
+		size_t start = buf.size();
+		put("fill:");
+		putColor(color);
+		put(";stroke:none");
+		if (color.a!=1.)
+		{
+			put(";opacity:");
+			put(color.a);
+		}
+		string decl = buf.substr(start);
+		buf.resize(start);
+		fillClass = getClass(decl);
+		fillClasses[key] = fillClass;
+	}
+	return fillClass;
+}
+
+int SVGFile::getStrokeClass()
+{
+	if (strokeClass==-1)
+	{
+		unsigned int key = packColor();
+		map<unsigned int,int>::iterator it = strokeClasses.find(key);
+		if (it!=strokeClasses.end())
+		{ return (strokeClass = it->second); }
+		size_t start = buf.size();
+		put("fill:none;stroke:");
+		putColor(color);
+		put(";stroke-width:");
+		put(thickness);
+		if (color.a!=1.)
+		{
+			put(";opacity:");
+			put(color.a);
+		}
+		string decl = buf.substr(start);
+		buf.resize(start);
+		strokeClass = getClass(decl);
+		strokeClasses[key] = strokeClass;
+	}
+	return strokeClass;
+}
+
+int SVGFile::getTextClass(const char * anchor, double fontsize)
+{
+	size_t start = buf.size();
+	put("font-family:Verdana;font-size:");
+	put(fontsize);
+	put("px;text-anchor:");
+	put(anchor);
+	put(";fill:");
+	putColor(color);
+	string decl = buf.substr(start);
+	buf.resize(start);
+	return getClass(decl);
+}
+
+// Index of the <defs> entry for a shape of a given size, defined on first use
+int SVGFile::getShape(map<double,int> & shapes, const char * prefix, const char * element, double size)
+{
+	map<double,int>::iterator it = shapes.find(size);
+	if (it!=shapes.end())
+	{ return it->second; }
+	int k = shapes.size();
+	shapes[size] = k;
+	put("<defs><");
+	put(element);
+	put(" id=\"");
+	put(prefix);
+	put((double) k);
+	if (string(element)=="circle")
+	{
+		put("\" r=\"");
+		put(size);
+	}
+	else
+	{
+		put("\" x=\"");
+		put(-size/2.);
+		put("\" y=\"");
+		put(-size/2.);
+		put("\" width=\"");
+		put(size);
+		put("\" height=\"");
+		put(size);
+	}
+	put("\"/></defs>\n");
+	return k;
+}
+
+void SVGFile::drawLine(Point p1, Point p2)
+{
+	put("<line x1=\"");
+	put(p1.x);
+	put("\" y1=\"");
+	put(p1.y);
+	put("\" x2=\"");
+	put(p2.x);
+	put("\" y2=\"");
+	put(p2.y);
+	put("\"");
+	putClass(getStrokeClass());
+	endElement();
+}
+
+void SVGFile::drawString(Point p, string s, double fontsize)
+{
+	int k = getTextClass("middle",fontsize);
+	put("<text x=\"");
+	put(p.x);
+	put("\" y=\"");
+	put(p.y+(fontsize/3.));
+	put("\"");
+	putClass(k);
+	put(">");
+	put(s);
+	put("</text>\n");
+}
+
+void SVGFile::drawStringLeftAlign(Point p, string s, double fontsize)
+{
+	int k = getTextClass("start",fontsize);
+	put("<text x=\"");
+	put(p.x);
+	put("\" y=\"");
+	put(p.y+(fontsize/3.));
+	put("\"");
+	putClass(k);
+	put(">");
+	put(s);
+	put("</text>\n");
+}
+
+void SVGFile::drawStringRotated90(Point p, string s, double fontsize)
+{
+	double x = p.x-(fontsize/3.);
+	double y = p.y;
+	int k = getTextClass("middle",fontsize);
+	put("<text x=\"");
+	put(x);
+	put("\" y=\"");
+	put(y);
+	put("\"");
+	putClass(k);
+	put(" transform=\"rotate(90 ");
+	put(x);
+	put(" ");
+	put(y);
+	put(")\">");
+	put(s);
+	put("</text>\n");
+}
+
+void SVGFile::fillSquare(Point center, double side)
+{
+	int k = getShape(squares,"q","rect",side);
+	put("<use xlink:href=\"#q");
+	put((double) k);
+	put("\" x=\"");
+	put(center.x);
+	put("\" y=\"");
+	put(center.y);
+	put("\"");
+	putClass(getFillClass());
+	endElement();
+}
+
+void SVGFile::drawSquare(Point center, double side)
+{
+	int k = getShape(squares,"q","rect",side);
+	put("<use xlink:href=\"#q");
+	put((double) k);
+	put("\" x=\"");
+	put(center.x);
+	put("\" y=\"");
+	put(center.y);
+	put("\"");
+	putClass(getStrokeClass());
+	endElement();
+}
+
+void SVGFile::fillRect(Point corner, double width, double height)
+{
+	put("<rect x=\"");
+	put(corner.x);
+	put("\" y=\"");
+	put(corner.y);
+	put("\" width=\"");
+	put(width);
+	put("\" height=\"");
+	put(height);
+	put("\"");
+	putClass(getFillClass());
+	endElement();
+}
+
+void SVGFile::drawCircle(Point center, double radius)
+{
+	int k = getShape(circles,"o","circle",radius);
+	put("<use xlink:href=\"#o");
+	put((double) k);
+	put("\" x=\"");
+	put(center.x);
+	put("\" y=\"");
+	put(center.y);
+	put("\"");
+	putClass(getStrokeClass());
+	endElement();
+}
+
+void SVGFile::fillCircle(Point center, double radius)
+{
+	int k = getShape(circles,"o","circle",radius);
+	put("<use xlink:href=\"#o");
+	put((double) k);
+	put("\" x=\"");
+	put(center.x);
+	put("\" y=\"");
+	put(center.y);
+	put("\"");
+	putClass(getFillClass());
+	endElement();
+}
+
+void SVGFile::putPath(const vector<Point> & points)
+{
+	put("<path d=\"");
+	for (int i = 0; i < points.size(); i++)
+	{
+		put((i==0)? "M" : " L");
+		put(points[i].x);
+		put(" ");
+		put(points[i].y);
+	}
+	put(" z\"");
+}
+
+void SVGFile::drawPolygon(const vector<Point> & points)
+{
+	putPath(points);
+	putClass(getStrokeClass());
+	endElement();
+}
+
+void SVGFile::fillPolygon(const vector<Point> & points)
+{
+	putPath(points);
+	putClass(getFillClass());
+	endElement();
+}
+
+RasterImage::RasterImage(int w, int h) : width(w), height(h), pixels(3*(size_t)w*h,255)
+{
+	rgb[0] = rgb[1] = rgb[2] = 0;
+}
+
+void RasterImage::setColor(const Color & c)
+{
+	// Alpha is blended against the white background
+	rgb[0] = toByte(1.-c.a*(1.-c.r));
+	rgb[1] = toByte(1.-c.a*(1.-c.g));
+	rgb[2] = toByte(1.-c.a*(1.-c.b));
+}
+
+void RasterImage::fillRect(int x, int y, int w, int h)
+{
+	int x0 = max(x,0), x1 = min(x+w,width);
+	int y0 = max(y,0), y1 = min(y+h,height);
+	for (int b=y0;b<y1;b++)
+	{
+		unsigned char * p = &pixels[3*((size_t)b*width+x0)];
+		for (int a=x0;a<x1;a++)
+		{
+			*p++ = rgb[0];
+			*p++ = rgb[1];
+			*p++ = rgb[2];
+		}
+	}
+}
+
+void RasterImage::drawLine(Point p1, Point p2)
+{
+	// Bresenham
+	int x0 = (int) floor(p1.x), y0 = (int) floor(p1.y);
+	int x1 = (int) floor(p2.x), y1 = (int) floor(p2.y);
+	int dx = abs(x1-x0), sx = (x0<x1)? 1 : -1;
+	int dy = -abs(y1-y0), sy = (y0<y1)? 1 : -1;
+	int err = dx+dy;
+	while (true)
+	{
+		fillRect(x0,y0,1,1);
+		if (x0==x1 && y0==y1)
+		{ break; }
+		int e2 = 2*err;
+		if (e2>=dy)
+		{ err += dy; x0 += sx; }
+		if (e2<=dx)
+		{ err += dx; y0 += sy; }
+	}
+}
+
+bool RasterImage::writePPM(const string & path) const
+{
+	ofstream out(path.c_str(), ios::out | ios::binary);
+	if (!out)
+	{ return false; }
+	out << "P6\n" << width << " " << height << "\n255\n";
+	out.write((const char *) &pixels[0], pixels.size());
+	return out.good();
+}
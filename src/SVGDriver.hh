@@ -32,6 +32,7 @@
 #include <iostream>
 #include <string>
 #include <vector>
+#include <map>
 
 using namespace std;
 
@@ -93,146 +94,86 @@ class Color{
 
 ostream & operator<< (ostream & o, const Color & c);
 
+// SVG writer. Elements are formatted by hand into a buffer flushed to the file
+// every SVG_BUFFER_SIZE bytes; styles become CSS classes, listed once in a
+// stylesheet at the end of the file, and squares/circles of a given size are
+// defined once in <defs> and then instantiated with <use>.
+#define SVG_BUFFER_SIZE (1<<16)
+
 class SVGFile{
 	private:
 		ofstream out;
+		string buf;
 		Color color;
 		double thickness;
+		map<string,int> classes;
+		map<double,int> squares;
+		map<double,int> circles;
+		// Classes of the colors already seen, by packed RGBA value
+		map<unsigned int,int> fillClasses;
+		map<unsigned int,int> strokeClasses;
+		// Cached classes for the current color, -1 if not computed yet
+		int fillClass, strokeClass;
+
+		void flush();
+		void put(const char * s)
+		{ buf += s; }
+		void put(const string & s)
+		{ buf += s; }
+		void put(double v);
+		void putColor(const Color & c);
+		void putClass(int k);
+		void endElement();
+		int getClass(const string & decl);
+		unsigned int packColor() const;
+		int getFillClass();
+		int getStrokeClass();
+		int getTextClass(const char * anchor, double fontsize);
+		int getShape(map<double,int> & shapes, const char * prefix, const char * element, double size);
+		void putPath(const vector<Point> & points);
 	public:
-		
-		SVGFile(string path) : out(path.c_str()){
-			thickness = 1.0;
-			color = Color(0.,0.,0.);
-			out << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
-				<< "<!DOCTYPE svg PUBLIC \"-//W3C//DTD SVG 1.1//EN\" \n"
-				<< "\"http://www.w3.org/Graphics/SVG/1.1/DTD/svg11.dtd\">\n"
-				<< "\n"
-				<< "<svg width=\"100%\" height=\"100%\" version=\"1.1\"\n"
-				<< "xmlns=\"http://www.w3.org/2000/svg\">\n";
-		}
-		
-		~SVGFile(){
-			out << "</svg>\n";
-			out.close();
-		}
+		SVGFile(string path);
+		~SVGFile();
 
 		void setColor(const Color & c)
 		{
 			color = c;
-		}
-		
-		void drawLine(Point p1, Point p2)
-		{
-				out << "<line x1=\"" << p1.x << "\" y1=\"" << p1.y
-				<< "\" x2=\"" << p2.x << "\" y2=\"" << p2.y
-				<< "\" stroke=\"" << color
-				<< "\" stroke-width=\"" << thickness << "opacity:"<< color.getAlpha()<<";\" />\n";
-		}
-
-		void drawString(Point p, string s, double fontsize)
-		{
-			double x = p.x;
-			double y = (p.y+(fontsize/3.));
-			
-				out << "<text x=\""
-				<< x
-				<< "\" y=\""
-				<< y
-				<< "\" text-anchor=\"middle\" font-family=\"Verdana\" font-size=\""
-				<< fontsize << "\" fill=\"" << color << "\" >"
-				<< s << "</text>\n";
-		}
-
-		void drawStringLeftAlign(Point p, string s, double fontsize)
-		{
-			double x = p.x;
-			double y = (p.y+(fontsize/3.));
-			
-				out << "<text x=\""
-				<< x
-				<< "\" y=\""
-				<< y
-				<< "\" text-anchor=\"left\" font-family=\"Verdana\" font-size=\""
-				<< fontsize << "\" fill=\"" << color << "\" >"
-				<< s << "</text>\n";
+			fillClass = -1;
+			strokeClass = -1;
 		}
 
-		void drawStringRotated90(Point p, string s, double fontsize)
-		{
-			double x = p.x-(fontsize/3.);
-			double y = (p.y);
-			
-				out << "<text x=\""
-				<< x
-				<< "\" y=\""
-				<< y
-				<< "\" text-anchor=\"middle\" font-family=\"Verdana\" font-size=\""
-				<< fontsize << "\" fill=\"" << color << "\" transform=\"rotate(90 "<<x<<" "<<y<<")\" >"
-				<< s << "</text>\n";
-		}
-
-		void fillSquare(Point center, double side)
-		{
-			vector<Point> ps;
-			ps.push_back(Point(center.x-side/2.,center.y-side/2.));
-			ps.push_back(Point(center.x+side/2.,center.y-side/2.));
-			ps.push_back(Point(center.x+side/2.,center.y+side/2.));
-			ps.push_back(Point(center.x-side/2.,center.y+side/2.));
-			ps.push_back(Point(center.x-side/2.,center.y-side/2.));
-			fillPolygon(ps);
-		}
-		
-		void drawSquare(Point center, double side)
-		{
-			vector<Point> ps;
-			ps.push_back(Point(center.x-side/2.,center.y-side/2.));
-			ps.push_back(Point(center.x+side/2.,center.y-side/2.));
-			ps.push_back(Point(center.x+side/2.,center.y+side/2.));
-			ps.push_back(Point(center.x-side/2.,center.y+side/2.));
-			ps.push_back(Point(center.x-side/2.,center.y-side/2.));
-			drawPolygon(ps);
-		}
-
-		void drawCircle(Point center, double radius)
-		{
-			out << "<circle cx=\""<< center.x<<"\" cy=\""<< center.y<<"\" r=\""<< radius
-			<< "\" style=\"fill:none; stroke:" << color << "; stroke-width:" << thickness << "; opacity:"<< color.getAlpha()<<";\" />\n";
-		}
-
-		void fillCircle(Point center, double radius)
-		{
-			out << "<circle cx=\""<< center.x<<"\" cy=\""<< center.y<<"\" r=\""<< radius
-			<< "\" style=\"fill:" << color << "; stroke:none; stroke-width:" << thickness << ";opacity:"<< color.getAlpha()<<";\" />\n";
-		}
-		
-
-		void drawPolygon(vector<Point> points) {
-			out << "<path d=\"";
-			for (int i = 0; i < points.size(); i++) {
-				if (i == 0) {
-					out << "M " << points[i].x << " " << points[i].y
-							<< " ";
-				} else {
-					out << "L " << points[i].x << " " << points[i].y
-							<< " ";
-				}
-			}
-			out << "z\" style=\"fill:none; stroke:" << color << "; stroke-width:" << thickness << ";opacity:"<< color.getAlpha()<<";\"/>\n";
-		}
+		void drawLine(Point p1, Point p2);
+		void drawString(Point p, string s, double fontsize);
+		void drawStringLeftAlign(Point p, string s, double fontsize);
+		void drawStringRotated90(Point p, string s, double fontsize);
+		void fillSquare(Point center, double side);
+		void fillRect(Point corner, double width, double height);
+		void drawSquare(Point center, double side);
+		void drawCircle(Point center, double radius);
+		void fillCircle(Point center, double radius);
+		void drawPolygon(const vector<Point> & points);
+		void fillPolygon(const vector<Point> & points);
+};
 
-		void fillPolygon(vector<Point> points) {
-			out << "<path d=\"";
-			for (int i = 0; i < points.size(); i++) {
-				if (i == 0) {
-					out << "M " << points[i].x << " " << points[i].y
-							<< " ";
-				} else {
-					out << "L " << points[i].x << " " << points[i].y
-							<< " ";
-				}
-			}
-			out << "z\" style=\"fill:" << color << ";stroke:none; stroke-width:" << thickness << ";opacity:"<< color.getAlpha()<<";\"/>\n";
-		}
+// Raster counterpart of SVGFile, written as a binary PPM (P6) image
+class RasterImage{
+	private:
+		int width,height;
+		vector<unsigned char> pixels;
+		unsigned char rgb[3];
+	public:
+		RasterImage(int w, int h);
+
+		int getWidth() const
+		{ return width; }
+		int getHeight() const
+		{ return height; }
+
+		void setColor(const Color & c);
+		// Fills pixels [x,x+w)x[y,y+h), clipped to the image
+		void fillRect(int x, int y, int w, int h);
+		void drawLine(Point p1, Point p2);
+		bool writePPM(const string & path) const;
 };
 
 #endif
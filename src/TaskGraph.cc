@@ -0,0 +1,196 @@
+/*  DeClone: A software for computing and analyzing ancestral adjacency scenarios.
+ *  Copyright (C) 2015 Cedric Chauve, Yann Ponty, Ashok Rajaraman, Joao P.P. Zanetti
+ *
+ *  This file is part of DeClone.
+ *  
+ *  DeClone is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  DeClone is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with DeClone.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Contact: <yann.ponty@lix.polytechnique.fr>.
+ *
+ *
+ *  DeClone uses the Quickhull algorithm implementation programmed by 
+ *  Anatoly V. Tomilov. The code is available on <https://bitbucket.org/tomilov/quickhull/src/585267abb3a63794c04fc8325aa9ec9f726112ed/include/quickhull.hpp?at=master>.
+ *
+ *  Contact: <tomilovanatoliy@gmail.com>
+ */
+
+#include "TaskGraph.hh"
+
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <deque>
+#include <memory>
+
+int nbWorkerThreads = 0;
+
+int getNbWorkerThreads()
+{
+  if (nbWorkerThreads>0)
+  {
+    return nbWorkerThreads;
+  }
+  int n = thread::hardware_concurrency();
+  return (n>0)?n:1;
+}
+
+struct WorkerQueue{
+  mutex lock;
+  deque<int> tasks;
+};
+
+static bool popTask(WorkerQueue & q, int & t, bool oldest)
+{
+  lock_guard<mutex> guard(q.lock);
+  if (q.tasks.empty())
+  {
+    return false;
+  }
+  if (oldest)
+  {
+    t = q.tasks.front();
+    q.tasks.pop_front();
+  }
+  else
+  {
+    t = q.tasks.back();
+    q.tasks.pop_back();
+  }
+  return true;
+}
+
+static void pushTask(WorkerQueue & q, int t)
+{
+  lock_guard<mutex> guard(q.lock);
+  q.tasks.push_back(t);
+}
+
+void runTaskGraph(int n, const vector<int> & pending, 
+                  function<void(int,int)> execute, 
+                  function<void(int,vector<int>&)> dependents,
+                  int nbThreads)
+{
+  if (nbThreads<1)
+  {
+    nbThreads = 1;
+  }
+  unique_ptr<atomic<int>[]> counters(new atomic<int>[n]);
+  vector<WorkerQueue> queues(nbThreads);
+  int k = 0;
+  for (int t=0;t<n;t++)
+  {
+    counters[t] = pending[t];
+    if (pending[t]==0)
+    {
+      queues[k].tasks.push_back(t);
+      k = (k+1)%nbThreads;
+    }
+  }
+  atomic<int> remaining(n);
+
+  auto worker = [&](int id)
+  {
+    vector<int> next;
+    while (remaining.load()>0)
+    {
+      int t;
+      bool found = popTask(queues[id],t,false);
+      for (int s=1;(s<nbThreads) && !found;s++)
+      {
+        found = popTask(queues[(id+s)%nbThreads],t,true);
+      }
+      if (!found)
+      {
+        this_thread::yield();
+        continue;
+      }
+      execute(t,id);
+      next.clear();
+      dependents(t,next);
+      for (size_t i=0;i<next.size();i++)
+      {
+        if (--counters[next[i]]==0)
+        {
+          pushTask(queues[id],next[i]);
+        }
+      }
+      remaining--;
+    }
+  };
+
+  if (nbThreads==1)
+  {
+    worker(0);
+    return;
+  }
+  vector<thread> threads;
+  for (int id=1;id<nbThreads;id++)
+  {
+    threads.push_back(thread(worker,id));
+  }
+  worker(0);
+  for (size_t i=0;i<threads.size();i++)
+  {
+    threads[i].join();
+  }
+}
+
+static int nbChildren(RecTree * v)
+{
+  return (v->getLeft()?1:0) + (v->getRight()?1:0);
+}
+
+void runCellGraph(vector<RecTree*> & Dfo1, vector<RecTree*> & Dfo2, 
+                  function<void(RecTree*,RecTree*,int)> fill, 
+                  int nbThreads)
+{
+  int n1 = Dfo1.size();
+  int n2 = Dfo2.size();
+  if (nbThreads<=1)
+  {
+    for (int i=0;i<n1;i++)
+    {
+      for (int j=0;j<n2;j++)
+      { fill(Dfo1[i],Dfo2[j],0); }
+    }
+    return;
+  }
+  vector<int> pending(n1*n2);
+  for (int i=0;i<n1;i++)
+  {
+    for (int j=0;j<n2;j++)
+    {
+      pending[i*n2+j] = (1+nbChildren(Dfo1[i]))*(1+nbChildren(Dfo2[j]))-1;
+    }
+  }
+  runTaskGraph(n1*n2, pending, 
+    [&](int t, int k)
+    {
+      fill(Dfo1[t/n2],Dfo2[t%n2],k);
+    },
+    [&](int t, vector<int> & res)
+    {
+      int i = t/n2;
+      int j = t%n2;
+      int p1 = (Dfo1[i]->getParent()?Dfo1[i]->getParent()->getIndex():-1);
+      int p2 = (Dfo2[j]->getParent()?Dfo2[j]->getParent()->getIndex():-1);
+      if (p1!=-1)
+      { res.push_back(p1*n2+j); }
+      if (p2!=-1)
+      { res.push_back(i*n2+p2); }
+      if ((p1!=-1) && (p2!=-1))
+      { res.push_back(p1*n2+p2); }
+    },
+    nbThreads);
+}
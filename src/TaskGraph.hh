@@ -0,0 +1,60 @@
+/*  DeClone: A software for computing and analyzing ancestral adjacency scenarios.
+ *  Copyright (C) 2015 Cedric Chauve, Yann Ponty, Ashok Rajaraman, Joao P.P. Zanetti
+ *
+ *  This file is part of DeClone.
+ *  
+ *  DeClone is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  DeClone is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with DeClone.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Contact: <yann.ponty@lix.polytechnique.fr>.
+ *
+ *
+ *  DeClone uses the Quickhull algorithm implementation programmed by 
+ *  Anatoly V. Tomilov. The code is available on <https://bitbucket.org/tomilov/quickhull/src/585267abb3a63794c04fc8325aa9ec9f726112ed/include/quickhull.hpp?at=master>.
+ *
+ *  Contact: <tomilovanatoliy@gmail.com>
+ */
+
+#ifndef TASK_GRAPH_HH
+#define TASK_GRAPH_HH
+
+#include <vector>
+#include <functional>
+#include "RecTrees.hh"
+
+using namespace std;
+
+// Number of worker threads of the parallel DPs (0 = number of cores)
+extern int nbWorkerThreads;
+
+int getNbWorkerThreads();
+
+// Runs the tasks 0..n-1 of a dependency graph over a pool of threads. 
+// A task becomes ready once its pending[t] dependencies are done. Each thread 
+// keeps its own queue of ready tasks (last-in, first-out), and steals the oldest 
+// tasks of the other threads when its own queue is empty.
+//  - execute(t,k) runs task t on thread k (0<=k<nbThreads)
+//  - dependents(t,res) lists the tasks that wait for t
+void runTaskGraph(int n, const vector<int> & pending, 
+                  function<void(int,int)> execute, 
+                  function<void(int,vector<int>&)> dependents,
+                  int nbThreads);
+
+// Runs fill(v1,v2,k) for every pair of nodes (v1,v2) of two trees, numbered by 
+// computeDepthFirstOrder, once the pairs of their children (or themselves) in 
+// both trees are done, i.e. in a valid order for the DPs of DeClone
+void runCellGraph(vector<RecTree*> & Dfo1, vector<RecTree*> & Dfo2, 
+                  function<void(RecTree*,RecTree*,int)> fill, 
+                  int nbThreads);
+
+#endif
@@ -29,6 +29,7 @@
 #include <iostream>
 #include <fstream>
 #include <cstdlib>
+#include <map>
 
 #include "math.h"
 #include "utils.hh"
@@ -37,6 +38,7 @@ using namespace std;
 
 Tree::Tree(string lbl, Tree * left, Tree * right){
   this->label = lbl;
+  this->parent = NULL;
   setLeft(left);
   setRight(right);
   this->index = -1;
@@ -498,6 +500,27 @@ string formatLabel(string name, Tree * s)
 }
 
 
+// Value of a field 'key=value' of an NHX comment, "" if absent
+string getNHXField(const string & comment, const string & key)
+{
+	size_t start = 0;
+	while (start<=comment.size())
+	{
+		size_t end = comment.find(':',start);
+		if (end==string::npos)
+		{ end = comment.size(); }
+		size_t eq = comment.find('=',start);
+		if ((eq<end) && (comment.compare(start,eq-start,key)==0) && (eq-start==key.size()))
+		{
+			return comment.substr(eq+1,end-eq-1);
+		}
+		start = end+1;
+	}
+	return "";
+}
+
+// A gene leaf matches a species leaf having either the same label, or the 
+// label given by its NHX species field (S=...)
 bool extentCompatible(Tree * g, Tree * s)
 {
 	const string & slbl = s->getLabel();
@@ -506,18 +529,137 @@ bool extentCompatible(Tree * g, Tree * s)
 	{
 		return true;
 	}
-	else
+	return (slbl == getNHXField(g->getComment(),"S"));
+};
+
+SpeciesTreeIndex::SpeciesTreeIndex(Tree * SpeciesTree)
+{
+	dfo = computeDepthFirstOrder(SpeciesTree);
+	int n = dfo.size();
+	left.assign(n,-1);
+	right.assign(n,-1);
+	parent.assign(n,-1);
+	depth.assign(n,0);
+	for(int j=n-1;j>=0;j--) 
 	{
-		const string & gcom = g->getComment();
-	  std::size_t found = gcom.find(slbl);
-  	if (found!=std::string::npos)
+		Tree * s = dfo[j];
+		if (s->getLeft())
+		{ left[j] = s->getLeft()->getIndex(); }
+		if (s->getRight())
+		{ right[j] = s->getRight()->getIndex(); }
+		if (s->getParent())
 		{
-			if (gcom.substr(found-2,2)=="S=")
-			return true;
+			parent[j] = s->getParent()->getIndex();
+			depth[j] = depth[parent[j]]+1;
 		}
+		if (s->isLeaf())
+		{ leaves[s->getLabel()] = j; }
+	}
+	first.assign(n,-1);
+	if (n>0)
+	{ tour(n-1); }
+	sparse.push_back(euler);
+	for(int k=1;(1<<k)<=euler.size();k++) 
+	{
+		const vector<int> & prev = sparse[k-1];
+		vector<int> level(euler.size()-(1<<k)+1);
+		for(int i=0;i<level.size();i++) 
+		{ level[i] = shallowest(prev[i],prev[i+(1<<(k-1))]); }
+		sparse.push_back(level);
 	}
-	return false;
-};
+}
+
+// Euler tour, iterative to support deep (caterpillar) trees
+void SpeciesTreeIndex::tour(int root)
+{
+	vector<pair<int,int> > stack(1,pair<int,int>(root,0));
+	while (!stack.empty())
+	{
+		int i = stack.back().first;
+		int & step = stack.back().second;
+		if (step==0)
+		{ first[i] = euler.size(); }
+		euler.push_back(i);
+		int child = -1;
+		while (step<2 && child==-1)
+		{
+			child = (step==0)? left[i] : right[i];
+			step++;
+		}
+		if (child!=-1)
+		{ stack.push_back(pair<int,int>(child,0)); }
+		else
+		{ stack.pop_back(); }
+	}
+}
+
+int SpeciesTreeIndex::shallowest(int a, int b) const
+{
+	return (depth[a]<=depth[b])? a : b;
+}
+
+int SpeciesTreeIndex::size() const
+{
+	return dfo.size();
+}
+
+int SpeciesTreeIndex::lca(int a, int b) const
+{
+	int l = first[a], r = first[b];
+	if (l>r)
+	{ swap(l,r); }
+	int k = 0;
+	while ((2<<k)<=r-l+1)
+	{ k++; }
+	return shallowest(sparse[k][l],sparse[k][r-(1<<k)+1]);
+}
+
+LeafSpeciesIndex::LeafSpeciesIndex(Tree * GeneTree, Tree * SpeciesTree)
+{
+	resolve(GeneTree, SpeciesTreeIndex(SpeciesTree));
+}
+
+LeafSpeciesIndex::LeafSpeciesIndex(Tree * GeneTree, const SpeciesTreeIndex & s)
+{
+	resolve(GeneTree, s);
+}
+
+void LeafSpeciesIndex::resolve(Tree * GeneTree, const SpeciesTreeIndex & s)
+{
+	vector<Tree*> DfoG = computeDepthFirstOrder(GeneTree);
+	species.assign(DfoG.size(),-1);
+	for(int i=0;i<DfoG.size();i++) 
+	{
+		Tree * g = DfoG[i];
+		if (g->isLeaf())
+		{
+			map<string,int>::const_iterator it = s.leaves.find(g->getLabel());
+			if (it==s.leaves.end())
+			{ it = s.leaves.find(getNHXField(g->getComment(),"S")); }
+			if (it!=s.leaves.end())
+			{ species[i] = it->second; }
+		}
+	}
+}
+
+GeneSpeciesBands::GeneSpeciesBands(Tree * GeneTree, const SpeciesTreeIndex & s) : species(s)
+{
+	vector<Tree*> DfoG = computeDepthFirstOrder(GeneTree);
+	LeafSpeciesIndex leaves(GeneTree, s);
+	bottom.assign(DfoG.size(),-1);
+	for(int i=0;i<DfoG.size();i++) 
+	{
+		Tree * g = DfoG[i];
+		int a = (g->getLeft()?  bottom[g->getLeft()->getIndex()]:-1);
+		int b = (g->getRight()? bottom[g->getRight()->getIndex()]:-1);
+		if (g->isLeaf())
+		{ bottom[i] = leaves.getSpecies(i); }
+		else if (g->getLeft()==NULL || g->getRight()==NULL)
+		{ bottom[i] = max(a,b); }
+		else if (a!=-1 && b!=-1)
+		{ bottom[i] = s.lca(a,b); }
+	}
+}
 
 struct stringbuilder
 {
@@ -531,98 +673,174 @@ struct stringbuilder
    operator std::string() { return ss.str(); }
 };
 
-void drawProbasSVG(Tree * GeneTree, Tree * SpeciesTree, double** probas, const string & output)
+// Dot plot geometry shared by the vector and raster renderers. Coordinates are
+// in cell units, the cell (i,j) being centred on delta+space*Point(i,j).
+struct DotPlotLayout
 {
-	SVGFile svg(output);
-	double space = 25.;
-  string name1 = "Tree 1";
-  string name2 = "Tree 2";
-
-	vector<Tree*> InfG = computeInfixOrder(GeneTree);
-	vector<Tree*> InfS = computeInfixOrder(SpeciesTree);
-
-	vector<int> heightsG(InfG.size());
-	vector<int> posG(InfG.size());
-	for(int i=0;i<InfG.size();i++) 
+	vector<Tree*> InfG;
+	vector<Tree*> InfS;
+	vector<int> heightsG;
+	vector<int> posG;
+	vector<int> heightsS;
+	vector<int> posS;
+
+	DotPlotLayout(Tree * GeneTree, Tree * SpeciesTree)
 	{
+		InfG = computeInfixOrder(GeneTree);
+		InfS = computeInfixOrder(SpeciesTree);
+		heightsG.resize(InfG.size());
+		posG.resize(InfG.size());
+		for(int i=0;i<InfG.size();i++) 
+		{
 			Tree * g = InfG[i];
 			heightsG[g->getIndex()] = g->height();
 			posG[g->getIndex()] = i;
-	}
-	vector<int> heightsS(InfS.size());
-	vector<int> posS(InfS.size());
-	for(int j=0;j<InfS.size();j++) 
-	{
+		}
+		heightsS.resize(InfS.size());
+		posS.resize(InfS.size());
+		for(int j=0;j<InfS.size();j++) 
+		{
 			Tree * s = InfS[j];
 			heightsS[s->getIndex()] = s->height();
 			posS[s->getIndex()] = j;
+		}
 	}
 
-  Point delta = space*Point(2.,1.+heightsG[GeneTree->getIndex()]);	
-
-  Point xAxis = space*Point(((double)InfG.size()),0.);
-  Point yAxis = space*Point(0.,((double)InfS.size()));
+	Point delta(Tree * GeneTree, double space) const
+	{ return space*Point(2.,1.+heightsG[GeneTree->getIndex()]); }
 
-  //EditTree* parsimonious = computeMaxParsimony(GeneTree, SpeciesTree);
-  //NodeType** m = parsimonious->eventsAsMatrix(GeneTree,SpeciesTree);
-	for(int i=0;i<InfG.size();i++) 
+	// Gene tree above the matrix, species tree on its right
+	void treeSegments(vector<pair<Point,Point> > & segs) const
 	{
-		Tree * g = InfG[i];
-		for(int j=0;j<InfS.size();j++) 
+		for(int i=0;i<InfG.size();i++)
+		{
+			Tree * g = InfG[i];
+			Point p = Point(i, -heightsG[g->getIndex()]);
+			if (!g->isLeaf())
+			{
+				Point m = p+Point(0.,.5);
+				segs.push_back(make_pair(p,m));
+				Point dl = m+Point(posG[g->getLeft()->getIndex()]-posG[g->getIndex()],0.);
+				segs.push_back(make_pair(m,dl));
+				Point fl = dl+Point(0.,-(heightsG[g->getLeft()->getIndex()]-heightsG[g->getIndex()] +.5));
+				segs.push_back(make_pair(dl,fl));
+				Point dr = m+Point(posG[g->getRight()->getIndex()]-posG[g->getIndex()],0.);
+				segs.push_back(make_pair(m,dr));
+				Point fr = dr+Point(0.,-(heightsG[g->getRight()->getIndex()]-heightsG[g->getIndex()] +.5));
+				segs.push_back(make_pair(dr,fr));
+			}
+		}
+		for(int j=0;j<InfS.size();j++)
 		{
 			Tree * s = InfS[j];
-			double prob = probas[g->getIndex()][s->getIndex()];
-			//svg.setColor(Color(1.-prob,1.-prob,1.-prob));
-			svg.setColor(Color(1.-prob,.7*prob+1.-prob,1.-prob));
-			svg.fillSquare(delta+space*Point(i,j),space);
+			Point p = Point(InfG.size()-1+heightsS[s->getIndex()],j);
+			if (!s->isLeaf())
+			{
+				Point m = p+Point(-.5,0);
+				segs.push_back(make_pair(p,m));
+				Point dl = m+Point(0.,posS[s->getLeft()->getIndex()]-posS[s->getIndex()]);
+				segs.push_back(make_pair(m,dl));
+				Point fl = dl+Point(heightsS[s->getLeft()->getIndex()]-heightsS[s->getIndex()] +.5,0);
+				segs.push_back(make_pair(dl,fl));
+				Point dr = m+Point(0.,posS[s->getRight()->getIndex()]-posS[s->getIndex()]);
+				segs.push_back(make_pair(m,dr));
+				Point fr = dr+Point(heightsS[s->getRight()->getIndex()]-heightsS[s->getIndex()] +.5,0);
+				segs.push_back(make_pair(dr,fr));
+			}
 		}
 	}
-	// for(int i=0;i<InfG.size();i++) 
-	// {
-	// 	Tree * g = InfG[i];
-	// 	for(int j=0;j<InfS.size();j++) 
-	// 	{
-	// 		Tree * s = InfS[j];
-	// 		bool isParDup = (m[g->getIndex()][s->getIndex()]==DUP_TYPE);
-	// 		if(isParDup)
-	// 		{
-	// 			svg.setColor(Color(1.,.4,.4,.5));
-	// 			svg.fillCircle(delta+space*Point(i,j),.7*space);				
-	// 			double prob = probas[g->getIndex()][s->getIndex()];
-	// 			svg.setColor(Color(1.-prob,1.-prob,1.-prob));
-	// 			svg.fillSquare(delta+space*Point(i,j),space);
-	// 			svg.setColor(Color(1.,0.,0.));
-	// 			svg.drawCircle(delta+space*Point(i,j),.7*space);
-	// 		}
-	// 	}
-	// }
-
-	// freeMatrix(GeneTree, SpeciesTree, m);
+};
 
+// Block of cells [i,i+w)x[j,j+h) of the dot plot sharing a colour level
+struct DotPlotRect
+{
+	int i, j, w, h, level;
+};
 
-	
-	svg.setColor(Color(0.,0.,0.));
+#define DOTPLOT_LEVELS 255
 
-	for(int i=0;i<InfG.size();i++)
+static Color dotPlotColor(int level)
+{
+	double prob = ((double) level)/DOTPLOT_LEVELS;
+	return Color(1.-prob,.7*prob+1.-prob,1.-prob);
+}
+
+// Level of a probability, 0 (i.e. white) at or below threshold
+static int dotPlotLevel(double prob, double threshold)
+{ return (prob<=threshold)? 0 : (int) (min(prob,1.)*DOTPLOT_LEVELS+.5); }
+
+// Quantizes the probabilities to DOTPLOT_LEVELS levels, drops the cells at
+// or below threshold (or of level 0, i.e. white), merges each row into runs
+// of equal level, then stacks identical runs of consecutive rows.
+static void mergeDotPlotCells(const DotPlotLayout & layout, double** probas, double threshold, vector<DotPlotRect> & rects)
+{
+	int n = layout.InfG.size();
+	vector<int> openAt(n,-1);
+	vector<int> levels(n);
+	for(int j=0;j<layout.InfS.size();j++) 
 	{
-		Tree * g = InfG[i];
-		Point p = Point(i, -heightsG[g->getIndex()]);
-			
-		if (!g->isLeaf())
+		int s = layout.InfS[j]->getIndex();
+		for(int i=0;i<n;i++) 
 		{
-			Point m = p+Point(0.,.5);
-			svg.drawLine(delta+space*p,delta+space*m);
-			Point dl = m+Point(posG[g->getLeft()->getIndex()]-posG[g->getIndex()],0.);
-			svg.drawLine(delta+space*m,delta+space*dl);
-			Point fl = dl+Point(0.,-(heightsG[g->getLeft()->getIndex()]-heightsG[g->getIndex()] +.5));
-			svg.drawLine(delta+space*dl,delta+space*fl);
-			Point dr = m+Point(posG[g->getRight()->getIndex()]-posG[g->getIndex()],0.);
-			svg.drawLine(delta+space*m,delta+space*dr);
-			Point fr = dr+Point(0.,-(heightsG[g->getRight()->getIndex()]-heightsG[g->getIndex()] +.5));
-			svg.drawLine(delta+space*dr,delta+space*fr);
+			levels[i] = dotPlotLevel(probas[layout.InfG[i]->getIndex()][s],threshold);
 		}
+		int i = 0;
+		while (i<n)
+		{
+			int start = i;
+			int level = levels[i];
+			while (i<n && levels[i]==level)
+			{ i++; }
+			if (level==0)
+			{ continue; }
+			int k = openAt[start];
+			if (k!=-1 && rects[k].w==i-start && rects[k].level==level && rects[k].j+rects[k].h==j)
+			{ rects[k].h++; }
+			else
+			{
+				DotPlotRect r;
+				r.i = start; r.j = j; r.w = i-start; r.h = 1; r.level = level;
+				openAt[start] = rects.size();
+				rects.push_back(r);
+			}
+		}
+	}
+}
+
+void drawProbasSVG(Tree * GeneTree, Tree * SpeciesTree, double** probas, const string & output, double threshold)
+{
+	SVGFile svg(output);
+	double space = 25.;
+  string name1 = "Tree 1";
+  string name2 = "Tree 2";
+
+	DotPlotLayout layout(GeneTree, SpeciesTree);
+	const vector<Tree*> & InfG = layout.InfG;
+	const vector<Tree*> & InfS = layout.InfS;
+	const vector<int> & heightsG = layout.heightsG;
+	const vector<int> & heightsS = layout.heightsS;
+
+  Point delta = layout.delta(GeneTree,space);
+
+  Point xAxis = space*Point(((double)InfG.size()),0.);
+  Point yAxis = space*Point(0.,((double)InfS.size()));
+
+	vector<DotPlotRect> rects;
+	mergeDotPlotCells(layout, probas, threshold, rects);
+	for(int k=0;k<rects.size();k++) 
+	{
+		const DotPlotRect & r = rects[k];
+		svg.setColor(dotPlotColor(r.level));
+		svg.fillRect(delta+space*Point(r.i-.5,r.j-.5),space*r.w,space*r.h);
 	}
 
+	svg.setColor(Color(0.,0.,0.));
+
+	vector<pair<Point,Point> > segs;
+	layout.treeSegments(segs);
+	for(int k=0;k<segs.size();k++)
+	{ svg.drawLine(delta+space*segs[k].first,delta+space*segs[k].second); }
+
 	for(int i=0;i<=InfG.size();i++) 
 	{
 		Point orig = space*Point(i-.5,-.5);
@@ -645,26 +863,6 @@ void drawProbasSVG(Tree * GeneTree, Tree * SpeciesTree, double** probas, const s
 		}
 	}
 	
-
-	for(int j=0;j<InfS.size();j++)
-	{
-		Tree * s = InfS[j];
-		Point p = Point(InfG.size()-1+heightsS[s->getIndex()],j);
-		if (!s->isLeaf())
-		{
-			Point m = p+Point(-.5,0);
-			svg.drawLine(delta+space*p,delta+space*m);
-			Point dl = m+Point(0.,posS[s->getLeft()->getIndex()]-posS[s->getIndex()]);
-			svg.drawLine(delta+space*m,delta+space*dl);
-			Point fl = dl+Point(heightsS[s->getLeft()->getIndex()]-heightsS[s->getIndex()] +.5,0);
-			svg.drawLine(delta+space*dl,delta+space*fl);
-			Point dr = m+Point(0.,posS[s->getRight()->getIndex()]-posS[s->getIndex()]);
-			svg.drawLine(delta+space*m,delta+space*dr);
-			Point fr = dr+Point(heightsS[s->getRight()->getIndex()]-heightsS[s->getIndex()] +.5,0);
-			svg.drawLine(delta+space*dr,delta+space*fr);
-		}
-	}
-
 	for(int j=0;j<=InfS.size();j++)
 	{
 		Point orig = space*Point(-.5,j-.5);
@@ -723,3 +921,95 @@ void drawProbasSVG(Tree * GeneTree, Tree * SpeciesTree, double** probas, const s
 	}
 
 }
+
+// Raster dot plot, without labels, of at most DOTPLOT_MAX_PIXELS pixels per 
+// side: one square of pixels per cell if the layout fits, otherwise each 
+// pixel aggregates a block of cells, and gets the highest level of the block
+#define DOTPLOT_MAX_PIXELS 4096
+
+void drawProbasPPM(Tree * GeneTree, Tree * SpeciesTree, double** probas, const string & output, double threshold)
+{
+	DotPlotLayout layout(GeneTree, SpeciesTree);
+	int nG = layout.InfG.size();
+	int nS = layout.InfS.size();
+	// Extent of the layout, in cells
+	double ex = nG+layout.heightsS[SpeciesTree->getIndex()]+2.5;
+	double ey = nS+layout.heightsG[GeneTree->getIndex()]+1.5;
+	int block = (int) ceil(max(ex,ey)/DOTPLOT_MAX_PIXELS);
+	double space = (block==1)? max(1,min(25,(int) (DOTPLOT_MAX_PIXELS/max(ex,ey)))) : 1./block;
+	Point delta = layout.delta(GeneTree,space);
+	RasterImage img((int) ceil(space*ex),(int) ceil(space*ey));
+
+	if (block==1)
+	{
+		vector<DotPlotRect> rects;
+		mergeDotPlotCells(layout, probas, threshold, rects);
+		for(int k=0;k<rects.size();k++) 
+		{
+			const DotPlotRect & r = rects[k];
+			Point corner = delta+space*Point(r.i-.5,r.j-.5);
+			img.setColor(dotPlotColor(r.level));
+			img.fillRect((int) floor(corner.x),(int) floor(corner.y),(int) (space*r.w),(int) (space*r.h));
+		}
+	}
+	else
+	{
+		int bw = (nG+block-1)/block;
+		int bh = (nS+block-1)/block;
+		vector<int> levels(bw*bh,0);
+		for(int i=0;i<nG;i++) 
+		{
+			const double * row = probas[layout.InfG[i]->getIndex()];
+			int * bl = &levels[i/block];
+			for(int j=0;j<nS;j++) 
+			{
+				int & l = bl[(j/block)*bw];
+				l = max(l,dotPlotLevel(row[layout.InfS[j]->getIndex()],threshold));
+			}
+		}
+		for(int bj=0;bj<bh;bj++) 
+		{
+			for(int bi=0;bi<bw;bi++) 
+			{
+				int level = levels[bj*bw+bi];
+				if (level!=0)
+				{
+					Point corner = delta+space*Point(bi*block-.5,bj*block-.5);
+					img.setColor(dotPlotColor(level));
+					img.fillRect((int) floor(corner.x),(int) floor(corner.y),1,1);
+				}
+			}
+		}
+	}
+
+	img.setColor(Color(0.,0.,0.));
+	vector<pair<Point,Point> > segs;
+	layout.treeSegments(segs);
+	for(int k=0;k<segs.size();k++)
+	{ img.drawLine(delta+space*segs[k].first,delta+space*segs[k].second); }
+	// Grid lines only when cells are large enough to be told apart
+	if (block==1 && space>=4)
+	{
+		for(int i=0;i<=nG;i++) 
+		{
+			Point orig = delta+space*Point(i-.5,-.5);
+			img.drawLine(orig,orig+space*Point(0.,nS));
+		}
+		for(int j=0;j<=nS;j++) 
+		{
+			Point orig = delta+space*Point(-.5,j-.5);
+			img.drawLine(orig,orig+space*Point(nG,0.));
+		}
+	}
+	if (!img.writePPM(output))
+	{ cerr << "Error: Cannot write to '"<<output<<"'"<<endl; }
+}
+
+void drawProbas(Tree * GeneTree, Tree * SpeciesTree, double** probas, const string & output, double threshold)
+{
+	string ext = ".ppm";
+	if (output.size()>=ext.size() && output.compare(output.size()-ext.size(),ext.size(),ext)==0)
+	{ drawProbasPPM(GeneTree, SpeciesTree, probas, output, threshold); }
+	else
+	{ drawProbasSVG(GeneTree, SpeciesTree, probas, output, threshold); }
+}
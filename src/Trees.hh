@@ -27,6 +27,7 @@
 
 #include <vector>
 #include <string>
+#include <map>
 #include <iostream>
 #include "SVGDriver.hh"
 
@@ -49,7 +50,7 @@ public:
      Tree(string lbl, Tree * left, Tree * right);
      Tree(string lbl);
      Tree(Tree * t);
-     ~Tree();
+     virtual ~Tree();
 	
      string getLabel();
      void setLabel(string lbl);
@@ -101,11 +102,85 @@ vector<Tree*> computeInfixOrder(Tree * t);
 
 string formatLabel(string name, Tree * s);
 
+string getNHXField(const string & comment, const string & key);
 bool extentCompatible(Tree * g, Tree * s);
 
+// Tables of a species tree, computed once to reconcile many gene trees 
+// against it without touching the tree itself: depth-first order, indices of
+// the children/parent and depth of each node, leaves by label, and LCAs 
+// (range minimum queries over an Euler tour, with a sparse table)
+class SpeciesTreeIndex{
+private:
+     vector<int> euler;
+     vector<int> first;
+     vector<vector<int> > sparse;
+		
+     void tour(int i);
+     int shallowest(int a, int b) const;
+		
+public:
+     vector<Tree*> dfo;
+     vector<int> left, right, parent, depth;
+     map<string,int> leaves;
+		
+     SpeciesTreeIndex(Tree * SpeciesTree);
+     int size() const;
+     int lca(int a, int b) const;
+     bool isAncestor(int a, int b) const
+     { return lca(a,b)==a; }
+};
+
+// Species leaf matching each gene leaf (see extentCompatible), resolved once 
+// for a pair of trees, so that the base case of the reconciliation DPs is an
+// integer comparison of the indices of the nodes
+class LeafSpeciesIndex{
+private:
+     vector<int> species;
+		
+     void resolve(Tree * GeneTree, const SpeciesTreeIndex & s);
+		
+public:
+     LeafSpeciesIndex(Tree * GeneTree, Tree * SpeciesTree);
+     LeafSpeciesIndex(Tree * GeneTree, const SpeciesTreeIndex & s);
+     bool compatible(Tree * g, Tree * s) const
+     { return species[g->getIndex()]==s->getIndex(); }
+     bool compatible(int i, int j) const
+     { return species[i]==j; }
+     // Index of the species leaf of a gene leaf, -1 if none
+     int getSpecies(int i) const
+     { return species[i]; }
+};
+
+// Species nodes where each gene node may be mapped by a reconciliation: the 
+// ancestors of the LCA of the species of its leaves, indexed by their depth
+// (0 for the root). Gene nodes having some leaf without species have no band.
+class GeneSpeciesBands{
+private:
+     const SpeciesTreeIndex & species;
+     vector<int> bottom;
+		
+public:
+     GeneSpeciesBands(Tree * GeneTree, const SpeciesTreeIndex & s);
+     int size() const
+     { return bottom.size(); }
+     // LCA of gene node i, -1 if none
+     int getLCA(int i) const
+     { return bottom[i]; }
+     int width(int i) const
+     { return (bottom[i]==-1)? 0 : species.depth[bottom[i]]+1; }
+     bool contains(int i, int j) const
+     { return (bottom[i]!=-1) && species.isAncestor(j,bottom[i]); }
+};
+
 void reportError(string txt,int nbchar);
 void reportWarning(string txt,int nbchar);
 
-void drawProbasSVG(Tree * GeneTree, Tree * SpeciesTree, double** probas, const string & output = "dotplot.svg");
+// Dot plot of a gene x species probability matrix, either as SVG or, for
+// large matrices, as a raster PPM image. Cells at or below threshold are
+// left blank, and runs of cells of equal colour are drawn as one rectangle.
+void drawProbasSVG(Tree * GeneTree, Tree * SpeciesTree, double** probas, const string & output = "dotplot.svg", double threshold = 0.);
+void drawProbasPPM(Tree * GeneTree, Tree * SpeciesTree, double** probas, const string & output = "dotplot.ppm", double threshold = 0.);
+// Picks the raster renderer when output ends with '.ppm'
+void drawProbas(Tree * GeneTree, Tree * SpeciesTree, double** probas, const string & output = "dotplot.svg", double threshold = 0.);
 
 #endif